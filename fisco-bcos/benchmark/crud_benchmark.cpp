@@ -0,0 +1,255 @@
+/**
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ *
+ * @file crud_benchmark.cpp
+ * @brief compare the JSON and the ABI interface of CRUDPrecompiled
+ */
+
+#include "libinitializer/Initializer.h"
+#include "libledger/DBInitializer.h"
+#include "libprecompiled/CRUDPrecompiled.h"
+#include "libprecompiled/CompiledCondition.h"
+#include "libstorage/MemoryTableFactory2.h"
+#include "libstorage/MemoryTableFactoryFactory2.h"
+#include "libstorage/RocksDBStorage.h"
+#include <libconfig/GlobalConfigure.h>
+#include <libethcore/ABI.h>
+#include <boost/program_options.hpp>
+#include <cstdlib>
+#include <functional>
+
+using namespace std;
+using namespace dev;
+using namespace dev::db;
+using namespace dev::ledger;
+using namespace dev::storage;
+using namespace dev::blockverifier;
+using namespace dev::initializer;
+using namespace dev::precompiled;
+
+namespace po = boost::program_options;
+
+po::options_description main_options("Main for CRUD benchmark");
+
+po::variables_map initCommandLine(int argc, const char* argv[])
+{
+    main_options.add_options()("help,h", "help of CRUD benchmark")("path,p",
+        po::value<string>()->default_value("benchmark/crud/"), "[RocksDB path]")("keys,k",
+        po::value<int>()->default_value(10000), "the number of different keys")("value,v",
+        po::value<int>()->default_value(128), "the length of value")(
+        "random,r", "every test use a new rocksdb");
+    po::variables_map vm;
+    try
+    {
+        po::store(po::parse_command_line(argc, argv, main_options), vm);
+        po::notify(vm);
+    }
+    catch (...)
+    {
+        std::cout << "invalid input" << std::endl;
+        exit(0);
+    }
+    if (vm.count("help") || vm.count("h"))
+    {
+        std::cout << main_options << std::endl;
+        exit(0);
+    }
+    return vm;
+}
+
+int main(int argc, const char* argv[])
+{
+    boost::property_tree::ptree pt;
+    auto logInitializer = std::make_shared<LogInitializer>();
+    logInitializer->initLog(pt);
+    auto params = initCommandLine(argc, argv);
+    auto storagePath = params["path"].as<string>();
+    if (params.count("random"))
+    {
+        storagePath += to_string(utcTime());
+    }
+    auto keys = params["keys"].as<int>();
+    auto valueLength = params["value"].as<int>();
+    int64_t blockNumber = 0;
+    g_BCOSConfig.setSupportedVersion("2.7.0", V2_7_0);
+
+    string value;
+    value.resize(valueLength);
+    cout << "rocksdb path    : " << storagePath << endl;
+    cout << "value length(B) : " << valueLength << endl;
+    for (int i = 0; i < valueLength; ++i)
+    {
+        value[i] = '0' + rand() % 10;
+    }
+
+    auto storage = createRocksDBStorage(storagePath, bytes(), false, false);
+    auto tableFactoryFactory = std::make_shared<dev::storage::MemoryTableFactoryFactory2>();
+    tableFactoryFactory->setStorage(storage);
+    auto tableFactory = tableFactoryFactory->newTableFactory(dev::h256(), blockNumber);
+    auto context = std::make_shared<ExecutiveContext>();
+    context->setMemoryTableFactory(tableFactory);
+
+    auto crudPrecompiled = std::make_shared<CRUDPrecompiled>();
+    auto precompiledGasFactory = std::make_shared<PrecompiledGasFactory>(0);
+    auto precompiledExecResultFactory = std::make_shared<PrecompiledExecResultFactory>();
+    precompiledExecResultFactory->setPrecompiledGasFactory(precompiledGasFactory);
+    crudPrecompiled->setPrecompiledExecResultFactory(precompiledExecResultFactory);
+
+    auto statetable = tableFactory->openTable(SYS_CURRENT_STATE);
+    auto entry = statetable->newEntry();
+    entry->setField(SYS_VALUE, "0");
+    entry->setField(SYS_KEY, SYS_KEY_CURRENT_NUMBER);
+    statetable->insert(SYS_KEY_CURRENT_NUMBER, entry);
+    tableFactory->commitDB(h256(0), blockNumber++);
+    tableFactory = tableFactoryFactory->newTableFactory(dev::h256(), blockNumber);
+    context->setMemoryTableFactory(tableFactory);
+
+    auto commitData = [&](int64_t block) {
+        auto statetable = tableFactory->openTable(SYS_CURRENT_STATE);
+        auto entry = statetable->newEntry();
+        entry->setField(SYS_VALUE, to_string(block));
+        entry->setField(SYS_KEY, SYS_KEY_CURRENT_NUMBER);
+        statetable->update(SYS_KEY_CURRENT_NUMBER, entry, statetable->newCondition());
+        tableFactory->commitDB(h256(0), block);
+        tableFactory = tableFactoryFactory->newTableFactory(dev::h256(), block + 1);
+        context->setMemoryTableFactory(tableFactory);
+    };
+
+    auto performance = [&](const string& description, int count, std::function<void()> operation) {
+        auto now = std::chrono::steady_clock::now();
+        operation();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - now;
+        cout << "time used(s)=" << std::setiosflags(std::ios::fixed) << std::setprecision(3)
+             << elapsed.count() << " rounds=" << count << " tps=" << count / elapsed.count() << "|"
+             << description << flush;
+        now = std::chrono::steady_clock::now();
+        commitData(blockNumber++);
+        elapsed = std::chrono::steady_clock::now() - now;
+        cout << " | commit time(s)=" << elapsed.count() << endl;
+    };
+
+    string tableName("crud_bench");
+    tableFactory->createTable(
+        getTableName(tableName), "key", "item_id,item_name,item_value", false, Address());
+    commitData(blockNumber++);
+
+    dev::eth::ContractABI abi;
+    auto call = [&](bytes const& param) {
+        return crudPrecompiled->call(context, bytesConstRef(&param))->execResult();
+    };
+    auto toJson = [](vector<pair<string, string>> const& fields) {
+        Json::Value entryJson;
+        for (auto const& field : fields)
+        {
+            entryJson[field.first] = field.second;
+        }
+        return Json::FastWriter().write(entryJson);
+    };
+    vector<string> fields = {"item_id", "item_name", "item_value"};
+    auto valuesOf = [&](int i) {
+        return vector<string>{to_string(i), "name" + to_string(i % 100), value};
+    };
+
+    // the inputs are encoded before the measurement, only the precompiled is measured
+    vector<bytes> jsonInserts, abiInserts, jsonSelects, abiSelects;
+    for (int i = 0; i < keys; ++i)
+    {
+        auto values = valuesOf(i);
+        vector<pair<string, string>> entryFields;
+        for (size_t j = 0; j < fields.size(); ++j)
+        {
+            entryFields.emplace_back(fields[j], values[j]);
+        }
+        jsonInserts.push_back(abi.abiIn("insert(string,string,string,string)", tableName,
+            "json" + to_string(i % 100), toJson(entryFields), string("")));
+        abiInserts.push_back(abi.abiIn("insert(string,string,string[],string[],string)", tableName,
+            "abi" + to_string(i % 100), fields, values, string("")));
+
+        string condition = "{\"item_id\":{\"eq\":\"" + to_string(i) +
+                           "\"},\"item_name\":{\"ne\":\"\"},\"limit\":{\"limit\":\"0,10\"}}";
+        jsonSelects.push_back(abi.abiIn("select(string,string,string,string)", tableName,
+            "json" + to_string(i % 100), condition, string("")));
+        abiSelects.push_back(abi.abiIn("select(string,string,string[],int256[],string[],string)",
+            tableName, "abi" + to_string(i % 100),
+            vector<string>{"item_id", "item_name", "limit"},
+            vector<s256>{s256(int(InterfaceOpcode::EQ)), s256(int(InterfaceOpcode::NE)),
+                s256(int(InterfaceOpcode::Limit))},
+            vector<string>{to_string(i), "", "0,10"}, string("")));
+    }
+
+    performance("CRUD JSON insert", keys, [&]() {
+        for (auto const& param : jsonInserts)
+        {
+            call(param);
+        }
+    });
+    performance("CRUD ABI insert", keys, [&]() {
+        for (auto const& param : abiInserts)
+        {
+            call(param);
+        }
+    });
+    clearCompiledCache();
+    performance("CRUD JSON select, cold decode cache", keys, [&]() {
+        for (auto const& param : jsonSelects)
+        {
+            call(param);
+        }
+    });
+    performance("CRUD JSON select, warm decode cache", keys, [&]() {
+        for (auto const& param : jsonSelects)
+        {
+            call(param);
+        }
+    });
+    performance("CRUD ABI select", keys, [&]() {
+        for (auto const& param : abiSelects)
+        {
+            call(param);
+        }
+    });
+
+    // decoding only, without the storage
+    vector<string> conditions;
+    for (int i = 0; i < keys; ++i)
+    {
+        conditions.push_back("{\"item_id\":{\"eq\":\"" + to_string(i) +
+                             "\"},\"item_name\":{\"ne\":\"\"},\"limit\":{\"limit\":\"0,10\"}}");
+    }
+    clearCompiledCache();
+    performance("decode JSON condition, cold", keys, [&]() {
+        for (auto const& condition : conditions)
+        {
+            compileCondition(condition);
+        }
+    });
+    performance("decode JSON condition, warm", keys, [&]() {
+        for (auto const& condition : conditions)
+        {
+            compileCondition(condition);
+        }
+    });
+    performance("decode ABI condition", keys, [&]() {
+        for (int i = 0; i < keys; ++i)
+        {
+            compileCondition(vector<string>{"item_id", "item_name", "limit"},
+                vector<s256>{s256(int(InterfaceOpcode::EQ)), s256(int(InterfaceOpcode::NE)),
+                    s256(int(InterfaceOpcode::Limit))},
+                vector<string>{to_string(i), "", "0,10"});
+        }
+    });
+    return 0;
+}
@@ -0,0 +1,129 @@
+/**
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ *
+ * @file dag_benchmark.cpp
+ * @brief the overhead of scheduling the transactions by the DAG of the parallel execution, the
+ * transactions do nothing or spin for a while, so the time is spent in the DAG
+ */
+
+#include <libblockverifier/DAG.h>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <thread>
+
+using namespace std;
+using namespace dev;
+using namespace dev::blockverifier;
+
+namespace
+{
+/// the transaction writes one of the _keyNum keys at random, _keyNum is 0 if no conflict
+void buildDAG(DAG& _dag, ID _txNum, size_t _threadNum, ID _keyNum)
+{
+    _dag.init(_txNum, _threadNum);
+    if (_keyNum > 0)
+    {
+        std::mt19937 random(_txNum);
+        std::vector<ID> lastOfKey(_keyNum, INVALID_ID);
+        for (ID id = 0; id < _txNum; ++id)
+        {
+            auto& last = lastOfKey[random() % _keyNum];
+            if (last != INVALID_ID)
+            {
+                _dag.addEdge(last, id);
+            }
+            last = id;
+        }
+    }
+    _dag.generate();
+}
+
+void executeTx(int64_t _workNs)
+{
+    if (_workNs <= 0)
+    {
+        return;
+    }
+    auto end = std::chrono::steady_clock::now() + std::chrono::nanoseconds(_workNs);
+    while (std::chrono::steady_clock::now() < end)
+    {
+    }
+}
+
+void benchmark(ID _txNum, size_t _threadNum, ID _keyNum, int64_t _workNs, size_t _rounds)
+{
+    int64_t buildNs = 0;
+    int64_t runNs = 0;
+    for (size_t round = 0; round < _rounds; ++round)
+    {
+        DAG dag;
+        auto start = std::chrono::steady_clock::now();
+        buildDAG(dag, _txNum, _threadNum, _keyNum);
+        auto built = std::chrono::steady_clock::now();
+        std::vector<std::thread> workers;
+        for (size_t worker = 0; worker < _threadNum; ++worker)
+        {
+            workers.emplace_back([&dag, worker, _workNs]() {
+                while (!dag.hasFinished())
+                {
+                    for (ID id = dag.waitPop(worker); id != INVALID_ID;
+                         id = dag.consume(id, worker))
+                    {
+                        executeTx(_workNs);
+                    }
+                }
+            });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+        auto finished = std::chrono::steady_clock::now();
+        buildNs += std::chrono::duration_cast<std::chrono::nanoseconds>(built - start).count();
+        runNs += std::chrono::duration_cast<std::chrono::nanoseconds>(finished - built).count();
+    }
+    double txs = (double)_txNum * _rounds;
+    // the cpu time of the threads not spent in the transactions, including the time waiting for
+    // the conflicting transactions, which is the pure scheduling overhead when keyNum is 0
+    double overheadNs = ((double)runNs * _threadNum - txs * _workNs) / txs;
+    cout << "txs: " << _txNum << ", threads: " << _threadNum << ", keys: " << _keyNum
+         << ", work: " << _workNs << " ns" << endl;
+    cout << "  build " << buildNs / txs << " ns/tx, run " << runNs / txs << " ns/tx, "
+         << txs * 1e9 / runNs << " tx/s, scheduling overhead " << overheadNs
+         << " cpu ns/tx" << endl;
+}
+}  // namespace
+
+int main(int argc, const char* argv[])
+{
+    if (argc < 2)
+    {
+        cout << "usage: " << argv[0] << " txNum [threadNum] [keyNum] [workNs] [rounds]" << endl;
+        cout << "  keyNum is the number of the keys the transactions conflict on, 0 for none"
+             << endl;
+        return 1;
+    }
+    ID txNum = std::max(1, atoi(argv[1]));
+    size_t threadNum = argc > 2 ? std::max(1, atoi(argv[2])) :
+                                  std::max(std::thread::hardware_concurrency(), 1u);
+    ID keyNum = argc > 3 ? std::max(0, atoi(argv[3])) : 0;
+    int64_t workNs = argc > 4 ? std::max(0, atoi(argv[4])) : 0;
+    size_t rounds = argc > 5 ? std::max(1, atoi(argv[5])) : 10;
+
+    benchmark(txNum, threadNum, keyNum, workNs, rounds);
+    return 0;
+}
@@ -0,0 +1,417 @@
+/**
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ *
+ * @file replay_benchmark.cpp
+ * @brief re-execute the recorded blocks of a node offline, check the roots and report the time
+ * cost of every phase
+ */
+
+#include "libinitializer/GlobalConfigureInitializer.h"
+#include "libinitializer/BoostLogInitializer.h"
+#include "libledger/DBInitializer.h"
+#include "libledger/LedgerParam.h"
+#include "libstorage/BinLogHandler.h"
+#include "libstorage/MemoryTableFactoryFactory2.h"
+#include <libblockchain/BlockChainImp.h>
+#include <libblockverifier/BlockVerifier.h>
+#include <boost/bind.hpp>
+#include <boost/program_options.hpp>
+#include <iomanip>
+
+using namespace std;
+using namespace dev;
+using namespace dev::eth;
+using namespace dev::ledger;
+using namespace dev::storage;
+using namespace dev::blockchain;
+using namespace dev::blockverifier;
+using namespace dev::initializer;
+
+namespace po = boost::program_options;
+
+po::options_description main_options("Main for replay benchmark");
+
+po::variables_map initCommandLine(int argc, const char* argv[])
+{
+    main_options.add_options()("help,h", "help of replay benchmark")("config,c",
+        po::value<string>()->default_value("./config.ini"), "config file path of the node")(
+        "group,g", po::value<int>()->default_value(1), "the group to replay")("source,s",
+        po::value<string>()->default_value("rocksdb"),
+        "read the blocks from the RocksDB of the node (rocksdb) or the binary log (binlog)")(
+        "from,f", po::value<int64_t>()->default_value(1),
+        "the first block measured, the blocks before it are replayed to build the parent state")(
+        "to,t", po::value<int64_t>()->default_value(-1),
+        "the last block replayed, -1 is the latest")(
+        "mode,m", po::value<string>()->default_value("both"),
+        "execute the blocks in serial, parallel or both")("arena,a",
+        po::value<bool>()->default_value(true),
+        "allocate the objects dying with the block in the block arena, or by tcmalloc if false")(
+        "work,w",
+        po::value<string>()->default_value("replay/"),
+        "the directory of the replayed state, the replay continues from its height")(
+        "verbose,v", "print the time cost of every block");
+    po::variables_map vm;
+    try
+    {
+        po::store(po::parse_command_line(argc, argv, main_options), vm);
+        po::notify(vm);
+    }
+    catch (...)
+    {
+        std::cout << "invalid input" << std::endl;
+        exit(0);
+    }
+    /// help information
+    if (vm.count("help") || vm.count("h"))
+    {
+        std::cout << main_options << std::endl;
+        exit(0);
+    }
+
+    return vm;
+}
+
+/// the blocks recorded by the node
+class BlockSource
+{
+public:
+    virtual ~BlockSource() {}
+    virtual int64_t number() = 0;
+    /// @return the encoded block, nullptr if not found
+    virtual std::shared_ptr<bytes> blockData(int64_t _number) = 0;
+};
+
+/// read the blocks from the storage of the node
+class StorageBlockSource : public BlockSource
+{
+public:
+    StorageBlockSource(Storage::Ptr _storage, bool _enableHexBlock)
+    {
+        auto tableFactoryFactory = std::make_shared<MemoryTableFactoryFactory2>();
+        tableFactoryFactory->setStorage(_storage);
+        m_blockChain = std::make_shared<BlockChainImp>();
+        m_blockChain->setStateStorage(_storage);
+        m_blockChain->setTableFactoryFactory(tableFactoryFactory);
+        m_blockChain->setEnableHexBlock(_enableHexBlock);
+    }
+    int64_t number() override { return m_blockChain->number(); }
+    std::shared_ptr<bytes> blockData(int64_t _number) override
+    {
+        return m_blockChain->getBlockRLPByNumber(_number);
+    }
+
+private:
+    std::shared_ptr<BlockChainImp> m_blockChain;
+};
+
+/// read the blocks from the SYS_HASH_2_BLOCK data in the binary log
+class BinLogBlockSource : public BlockSource
+{
+public:
+    BinLogBlockSource(std::string const& _path, bool _enableHexBlock)
+      : m_binLog(_path), m_enableHexBlock(_enableHexBlock)
+    {}
+    int64_t number() override { return m_binLog.getLastBlockNum(); }
+    std::shared_ptr<bytes> blockData(int64_t _number) override
+    {
+        auto blocksData = m_binLog.getMissingBlocksFromBinLog(_number - 1, _number);
+        auto it = blocksData->find(_number);
+        if (it == blocksData->end())
+        {
+            return nullptr;
+        }
+        for (auto const& tableData : it->second)
+        {
+            if (tableData->info->name != SYS_HASH_2_BLOCK || tableData->newEntries->size() == 0)
+            {
+                continue;
+            }
+            auto entry = tableData->newEntries->get(0);
+            if (m_enableHexBlock)
+            {
+                return std::make_shared<bytes>(fromHex(entry->getField(SYS_VALUE)));
+            }
+            auto data = entry->getFieldConst(SYS_VALUE);
+            return std::make_shared<bytes>(data.begin(), data.end());
+        }
+        return nullptr;
+    }
+
+private:
+    BinLogHandler m_binLog;
+    bool m_enableHexBlock;
+};
+
+/// the accumulated time cost of the replayed blocks, in microseconds
+struct ReplayStat
+{
+    std::string mode;
+    int64_t blocks = 0;
+    int64_t txs = 0;
+    uint64_t decode = 0;
+    uint64_t initContext = 0;
+    uint64_t dagBuild = 0;
+    uint64_t execution = 0;
+    uint64_t hash = 0;
+    uint64_t commit = 0;
+    // the objects allocated in the block arenas, 0 if the arena is disabled
+    uint64_t arenaAllocations = 0;
+
+    void add(ExecuteBlockTimeCost const& _timeCost)
+    {
+        initContext += _timeCost.initContext;
+        dagBuild += _timeCost.dagBuild;
+        execution += _timeCost.execution;
+        hash += _timeCost.hash;
+    }
+    uint64_t total() const { return decode + initContext + dagBuild + execution + hash + commit; }
+};
+
+bool enableHexBlock(std::shared_ptr<LedgerParamInterface> _param)
+{
+    auto const& type = _param->mutableStorageParam().type;
+    if (!dev::stringCmpIgnoreCase(type, "External") || !dev::stringCmpIgnoreCase(type, "MySQL"))
+    {
+        return g_BCOSConfig.version() < V2_6_0;
+    }
+    return g_BCOSConfig.version() < V2_2_0;
+}
+
+void printStat(ReplayStat const& _stat)
+{
+    auto ms = [](uint64_t _us) { return (double)_us / 1000; };
+    cout << std::fixed << std::setprecision(2) << setw(10) << _stat.mode << setw(8)
+         << _stat.blocks << setw(10) << _stat.txs << setw(12) << ms(_stat.decode) << setw(12)
+         << ms(_stat.initContext) << setw(12) << ms(_stat.dagBuild) << setw(12)
+         << ms(_stat.execution) << setw(12) << ms(_stat.hash) << setw(12) << ms(_stat.commit)
+         << setw(12) << ms(_stat.total()) << setw(12)
+         << (_stat.total() == 0 ? 0 : (double)_stat.txs * 1000000 / _stat.total()) << setw(14)
+         << _stat.arenaAllocations << endl;
+}
+
+int replay(po::variables_map const& _params)
+{
+    auto configPath = _params["config"].as<string>();
+    auto groupID = _params["group"].as<int>();
+    auto mode = _params["mode"].as<string>();
+    if (mode != "serial" && mode != "parallel" && mode != "both")
+    {
+        cout << "invalid mode " << mode << endl;
+        return -1;
+    }
+    bool verbose = _params.count("verbose");
+
+    boost::property_tree::ptree pt;
+    boost::property_tree::read_ini(configPath, pt);
+    // only the errors are logged to the work directory, the logs of every block disturb the time
+    // cost and the logs of the node
+    pt.put("log.level", "error");
+    pt.put("log.log_path", _params["work"].as<string>() + "/log");
+    auto logInitializer = std::make_shared<LogInitializer>();
+    logInitializer->initLog(pt);
+    /// init global config. must init before DB, for compatibility
+    initGlobalConfig(pt);
+
+    auto genesisPath = pt.get<string>("group.group_config_path", "conf/") + "/group." +
+                       to_string(groupID) + ".genesis";
+    auto sourceParam = std::make_shared<LedgerParam>();
+    sourceParam->init(genesisPath, pt.get<string>("group.group_data_path", "data/"));
+
+    std::shared_ptr<BlockSource> source;
+    if (_params["source"].as<string>() == "binlog")
+    {
+        source = std::make_shared<BinLogBlockSource>(
+            sourceParam->baseDir() + "/BinaryLogs", enableHexBlock(sourceParam));
+    }
+    else if (!dev::stringCmpIgnoreCase(sourceParam->mutableStorageParam().type, "RocksDB"))
+    {
+        auto storage =
+            createRocksDBStorage(sourceParam->mutableStorageParam().path, bytes(), false, false);
+        source = std::make_shared<StorageBlockSource>(storage, enableHexBlock(sourceParam));
+    }
+    else
+    {
+        cout << "the blocks of " << sourceParam->mutableStorageParam().type
+             << " storage can only be read from the binary log" << endl;
+        return -1;
+    }
+
+    // the replayed state is always in RocksDB, with the cache of the node
+    auto param = std::make_shared<LedgerParam>();
+    param->init(genesisPath, _params["work"].as<string>());
+    param->mutableStorageParam().type = "RocksDB";
+    param->mutableStorageParam().path = param->baseDir() + "/block/RocksDB";
+    param->mutableStorageParam().binaryLog = false;
+    auto dbInitializer = std::make_shared<DBInitializer>(param, groupID);
+    dbInitializer->initStorageDB();
+    auto blockChain = std::make_shared<BlockChainImp>();
+    blockChain->setStateStorage(dbInitializer->storage());
+    blockChain->setTableFactoryFactory(dbInitializer->tableFactoryFactory());
+    blockChain->setEnableHexBlock(enableHexBlock(param));
+    blockChain->checkAndBuildGenesisBlock(
+        param, getBlockNumberFromStorage(dbInitializer->storage()) == -1);
+    auto genesis = blockChain->getBlockByNumber(0);
+    auto sourceGenesis = source->blockData(0);
+    if (sourceGenesis && Block(*sourceGenesis, CheckTransaction::None).headerHash() !=
+                             genesis->headerHash())
+    {
+        cout << "the genesis block is different from the node" << endl;
+        return -1;
+    }
+    dbInitializer->initState(genesis->headerHash());
+    blockChain->setStateFactory(dbInitializer->stateFactory());
+    dbInitializer->setSyncNumForCachedStorage(blockChain->number());
+
+    auto blockVerifier = std::make_shared<BlockVerifier>(true);
+    blockVerifier->setExecutiveContextFactory(dbInitializer->executiveContextFactory());
+    blockVerifier->setNumberHash(boost::bind(&BlockChainImp::numberHash, blockChain, _1));
+    blockVerifier->setEvmFlags(param->mutableGenesisParam().evmFlags);
+    blockVerifier->setEnableBlockArena(_params["arena"].as<bool>());
+
+    auto from = _params["from"].as<int64_t>();
+    auto to = _params["to"].as<int64_t>();
+    if (to < 0 || to > source->number())
+    {
+        to = source->number();
+    }
+    if (blockChain->number() >= from)
+    {
+        cout << "the replayed state is at block " << blockChain->number()
+             << ", remove the work directory to measure from block " << from << endl;
+        return -1;
+    }
+    cout << "replay block " << blockChain->number() + 1 << " to " << to << ", measure from "
+         << from << ", mode " << mode << endl;
+
+    ReplayStat serialStat;
+    serialStat.mode = "serial";
+    ReplayStat parallelStat;
+    parallelStat.mode = "parallel";
+    for (int64_t number = blockChain->number() + 1; number <= to; ++number)
+    {
+        auto data = source->blockData(number);
+        if (!data)
+        {
+            cout << "block " << number << " not found" << endl;
+            return -1;
+        }
+        auto decodeStart = utcSteadyTimeUs();
+        // recover the senders as the sync module does
+        auto block = std::make_shared<Block>(*data, CheckTransaction::Everything);
+        auto decodeTime = utcSteadyTimeUs() - decodeStart;
+
+        auto parent = blockChain->getBlockByNumber(number - 1);
+        BlockInfo parentInfo{
+            parent->header().hash(), parent->header().number(), parent->header().stateRoot()};
+        // the verifier compares the roots with the recorded header, throws if not the same
+        ExecutiveContext::Ptr context;
+        ExecuteBlockTimeCost serialTimeCost;
+        ExecuteBlockTimeCost parallelTimeCost;
+        uint64_t serialAllocations = 0;
+        uint64_t parallelAllocations = 0;
+        auto arenaAllocations = [](ExecutiveContext::Ptr const& _context) -> uint64_t {
+            return _context && _context->arena() ? _context->arena()->allocations() : 0;
+        };
+        try
+        {
+            if (mode != "parallel")
+            {
+                auto serialBlock = mode == "both" ? std::make_shared<Block>(*block) : block;
+                context =
+                    blockVerifier->serialExecuteBlock(*serialBlock, parentInfo, &serialTimeCost);
+                serialAllocations = arenaAllocations(context);
+            }
+            if (mode != "serial")
+            {
+                context =
+                    blockVerifier->parallelExecuteBlock(*block, parentInfo, &parallelTimeCost);
+                parallelAllocations = arenaAllocations(context);
+            }
+        }
+        catch (std::exception& e)
+        {
+            cout << "block " << number << " is not the same after replayed, "
+                 << boost::diagnostic_information(e) << endl;
+            return -1;
+        }
+
+        auto commitStart = utcSteadyTimeUs();
+        if (blockChain->commitBlock(block, context) != CommitResult::OK)
+        {
+            cout << "commit block " << number << " failed" << endl;
+            return -1;
+        }
+        auto commitTime = utcSteadyTimeUs() - commitStart;
+
+        if (number < from)
+        {
+            continue;
+        }
+        auto txs = block->transactions()->size();
+        for (auto stat : {&serialStat, &parallelStat})
+        {
+            auto const& timeCost = stat == &serialStat ? serialTimeCost : parallelTimeCost;
+            auto allocations = stat == &serialStat ? serialAllocations : parallelAllocations;
+            if ((stat == &serialStat && mode == "parallel") ||
+                (stat == &parallelStat && mode == "serial"))
+            {
+                continue;
+            }
+            stat->blocks++;
+            stat->txs += txs;
+            stat->decode += decodeTime;
+            stat->commit += commitTime;
+            stat->add(timeCost);
+            stat->arenaAllocations += allocations;
+            if (verbose)
+            {
+                cout << "block " << number << " " << stat->mode << " txs=" << txs
+                     << " decode=" << decodeTime << "us init=" << timeCost.initContext
+                     << "us dag=" << timeCost.dagBuild << "us execute=" << timeCost.execution
+                     << "us hash=" << timeCost.hash << "us commit=" << commitTime
+                     << "us arenaAllocations=" << allocations << endl;
+            }
+        }
+    }
+
+    cout << setw(10) << "mode" << setw(8) << "blocks" << setw(10) << "txs" << setw(12)
+         << "decode(ms)" << setw(12) << "init(ms)" << setw(12) << "dag(ms)" << setw(12)
+         << "execute(ms)" << setw(12) << "hash(ms)" << setw(12) << "commit(ms)" << setw(12)
+         << "total(ms)" << setw(12) << "tps" << setw(14) << "arenaAllocs" << endl;
+    if (mode != "parallel")
+    {
+        printStat(serialStat);
+    }
+    if (mode != "serial")
+    {
+        printStat(parallelStat);
+    }
+    return 0;
+}
+
+int main(int argc, const char* argv[])
+{
+    auto params = initCommandLine(argc, argv);
+    try
+    {
+        return replay(params);
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << boost::diagnostic_information(e) << std::endl;
+        return -1;
+    }
+}
@@ -0,0 +1,120 @@
+/**
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ *
+ * @file sm2_benchmark.cpp
+ * @brief compare the legacy SM2 verify with the fast verify, the precomputed public keys and the
+ * parallel batch verify
+ */
+
+#include <libconfig/GlobalConfigure.h>
+#include <libdevcrypto/Common.h>
+#include <libdevcrypto/CryptoInterface.h>
+#include <libdevcrypto/SM2Signature.h>
+#include <libdevcrypto/sm2/sm2.h>
+#include <chrono>
+#include <iostream>
+
+using namespace std;
+using namespace dev;
+
+namespace
+{
+template <typename F>
+void benchmark(std::string const& _name, size_t _count, F _f)
+{
+    auto start = std::chrono::steady_clock::now();
+    size_t failed = _f();
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start)
+                       .count();
+    cout << _name << ": " << (double)elapsed / _count << " us/op, "
+         << (elapsed > 0 ? _count * 1000000 / elapsed : 0) << " ops/s, failed " << failed
+         << endl;
+}
+}  // namespace
+
+int main(int argc, const char* argv[])
+{
+    if (argc < 2)
+    {
+        cout << "usage: " << argv[0] << " count [keyCount]" << endl;
+        return 1;
+    }
+    size_t count = std::max(1, atoi(argv[1]));
+    // the sealers of a typical group
+    size_t keyCount = argc > 2 ? std::max(1, atoi(argv[2])) : 4;
+    g_BCOSConfig.setUseSMCrypto(true);
+    crypto::initSMCrypto();
+
+    std::vector<KeyPair> keyPairs;
+    h512s pubKeys;
+    std::vector<std::shared_ptr<crypto::Signature>> sigs;
+    h256s hashes;
+    std::vector<bytes> signDatas;
+    for (size_t i = 0; i < keyCount; ++i)
+    {
+        keyPairs.push_back(KeyPair::create());
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto const& keyPair = keyPairs[i % keyCount];
+        h256 hash = crypto::Hash(to_string(i));
+        auto sig = sm2Sign(keyPair, hash);
+        bytes signData(sig->r.begin(), sig->r.end());
+        signData.insert(signData.end(), sig->s.begin(), sig->s.end());
+        pubKeys.push_back(keyPair.pub());
+        sigs.push_back(sig);
+        hashes.push_back(hash);
+        signDatas.push_back(signData);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start)
+                       .count();
+    cout << "sign: " << (double)elapsed / count << " us/op" << endl;
+
+    benchmark("legacy verify", count, [&]() {
+        size_t failed = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            failed += !SM2::getInstance().verify(signDatas[i].data(), signDatas[i].size(),
+                hashes[i].data(), h256::size, pubKeys[i].data());
+        }
+        return failed;
+    });
+    benchmark("fast verify", count, [&]() {
+        size_t failed = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            failed += !SM2::getInstance().fastVerify(
+                signDatas[i].data(), hashes[i].data(), h256::size, pubKeys[i]);
+        }
+        return failed;
+    });
+    sm2PrecomputePublicKeys(1, h512s(pubKeys.begin(), pubKeys.begin() + keyCount));
+    benchmark("fast verify with precomputed keys", count, [&]() {
+        size_t failed = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            failed += !SM2::getInstance().fastVerify(
+                signDatas[i].data(), hashes[i].data(), h256::size, pubKeys[i]);
+        }
+        return failed;
+    });
+    benchmark("batch verify with precomputed keys", count,
+        [&]() { return sm2BatchVerify(pubKeys, sigs, hashes).size(); });
+    return 0;
+}
@@ -0,0 +1,193 @@
+/**
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ *
+ * @file txpool_benchmark.cpp
+ * @brief the latency of fetching the transactions for the sealing block from the txpool, with the
+ * sealing cursor and with rescanning the queue for every fetch
+ */
+
+#include <libblockchain/BlockChainInterface.h>
+#include <libdevcrypto/Common.h>
+#include <libp2p/Service.h>
+#include <libtxpool/TxPool.h>
+#include <chrono>
+#include <iostream>
+
+using namespace std;
+using namespace dev;
+using namespace dev::eth;
+using namespace dev::txpool;
+using namespace dev::blockchain;
+
+namespace
+{
+/// a chain with only the genesis block
+class GenesisBlockChain : public BlockChainInterface
+{
+public:
+    GenesisBlockChain() : m_genesis(std::make_shared<Block>()) {}
+    int64_t number() override { return 0; }
+    h256 numberHash(int64_t) override { return m_genesis->headerHash(); }
+    Transaction::Ptr getTxByHash(h256 const&) override { return nullptr; }
+    LocalisedTransaction::Ptr getLocalisedTxByHash(h256 const&) override { return nullptr; }
+    TransactionReceipt::Ptr getTransactionReceiptByHash(h256 const&) override { return nullptr; }
+    LocalisedTransactionReceipt::Ptr getLocalisedTxReceiptByHash(h256 const&) override
+    {
+        return nullptr;
+    }
+    std::shared_ptr<Block> getBlockByHash(h256 const&, int64_t) override { return m_genesis; }
+    std::shared_ptr<Block> getBlockByNumber(int64_t) override { return m_genesis; }
+    std::shared_ptr<bytes> getBlockRLPByNumber(int64_t) override { return nullptr; }
+    CommitResult commitBlock(
+        std::shared_ptr<Block>, std::shared_ptr<dev::blockverifier::ExecutiveContext>) override
+    {
+        return CommitResult::OK;
+    }
+    std::pair<int64_t, int64_t> totalTransactionCount() override { return std::make_pair(0, 0); }
+    std::pair<int64_t, int64_t> totalFailedTransactionCount() override
+    {
+        return std::make_pair(0, 0);
+    }
+    bytes getCode(Address) override { return bytes(); }
+    std::shared_ptr<std::vector<NonceKeyType>> getNonces(int64_t) override
+    {
+        return std::make_shared<std::vector<NonceKeyType>>();
+    }
+    std::pair<LocalisedTransaction::Ptr,
+        std::vector<std::pair<std::vector<std::string>, std::vector<std::string>>>>
+    getTransactionByHashWithProof(h256 const&) override
+    {
+        return std::make_pair(nullptr,
+            std::vector<std::pair<std::vector<std::string>, std::vector<std::string>>>());
+    }
+    std::pair<LocalisedTransactionReceipt::Ptr,
+        std::vector<std::pair<std::vector<std::string>, std::vector<std::string>>>>
+    getTransactionReceiptByHashWithProof(h256 const&, LocalisedTransaction&) override
+    {
+        return std::make_pair(nullptr,
+            std::vector<std::pair<std::vector<std::string>, std::vector<std::string>>>());
+    }
+    bool checkAndBuildGenesisBlock(
+        std::shared_ptr<dev::ledger::LedgerParamInterface>, bool) override
+    {
+        return true;
+    }
+    h512s sealerList() override { return h512s(); }
+    h512s observerList() override { return h512s(); }
+    std::string getSystemConfigByKey(std::string const&, int64_t) override { return ""; }
+
+private:
+    std::shared_ptr<Block> m_genesis;
+};
+
+class BenchmarkTxPool : public TxPool
+{
+public:
+    using TxPool::TxPool;
+    using TxPool::batchImport;
+};
+
+/// fetch _blockSize transactions by _step for every call, the first _sealedSize transactions of
+/// the queue are avoided as they are in the blocks under consensus
+void benchmark(std::string const& _name, std::shared_ptr<BenchmarkTxPool> _txPool,
+    Transactions const& _txs, size_t _sealedSize, size_t _blockSize, size_t _step, bool _cursor)
+{
+    h256Hash avoid;
+    for (size_t i = 0; i < _sealedSize; ++i)
+    {
+        avoid.insert(_txs[i]->sha3());
+    }
+    size_t fetched = 0;
+    size_t calls = 0;
+    int64_t maxElapsed = 0;
+    auto start = std::chrono::steady_clock::now();
+    while (fetched < _blockSize)
+    {
+        auto callStart = std::chrono::steady_clock::now();
+        std::shared_ptr<Transactions> txs;
+        if (_cursor)
+        {
+            txs = _txPool->topTransactions(_step, avoid, true);
+        }
+        else
+        {
+            // every fetch scans from the beginning of the queue
+            txs = _txPool->topTransactions(_step, avoid, false);
+            for (auto const& tx : *txs)
+            {
+                avoid.insert(tx->sha3());
+            }
+        }
+        int64_t callElapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - callStart)
+                                  .count();
+        maxElapsed = std::max(maxElapsed, callElapsed);
+        ++calls;
+        if (txs->empty())
+        {
+            break;
+        }
+        fetched += txs->size();
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start)
+                       .count();
+    cout << _name << ": fetched " << fetched << " txs in " << calls << " calls, "
+         << (double)elapsed / calls << " us/call, max " << maxElapsed << " us" << endl;
+}
+}  // namespace
+
+int main(int argc, const char* argv[])
+{
+    if (argc < 2)
+    {
+        cout << "usage: " << argv[0] << " poolSize [blockSize] [step]" << endl;
+        return 1;
+    }
+    size_t poolSize = std::max(1, atoi(argv[1]));
+    size_t blockSize = argc > 2 ? std::max(1, atoi(argv[2])) : 1000;
+    // the sealer fetches the transactions imported since the last fetch
+    size_t step = argc > 3 ? std::max(1, atoi(argv[3])) : 10;
+    blockSize = std::min(blockSize, poolSize);
+
+    auto blockChain = std::make_shared<GenesisBlockChain>();
+    auto txPool = std::make_shared<BenchmarkTxPool>(std::make_shared<dev::p2p::Service>(),
+        blockChain, getGroupProtoclID(1, dev::eth::ProtocolID::TxPool), poolSize);
+    txPool->setMaxBlockLimit(1000);
+    txPool->setMaxMemoryLimit(INT64_MAX);
+
+    auto keyPair = KeyPair::create();
+    Transactions txs;
+    std::string str = "txpool benchmark";
+    for (size_t i = 0; i < poolSize; ++i)
+    {
+        auto tx = std::make_shared<Transaction>(
+            u256(0), u256(0), u256(100000000), Address(), bytes(str.begin(), str.end()), u256(i));
+        tx->setBlockLimit(u256(500));
+        tx->updateSignature(crypto::Sign(keyPair, tx->sha3(WithoutSignature)));
+        txs.push_back(tx);
+    }
+    auto results = txPool->batchImport(txs);
+    auto imported = std::count(results.begin(), results.end(), ImportResult::Success);
+    // the transactions imported in the same millisecond are not ordered by the import order
+    auto pending = txPool->pendingList();
+    cout << "pool size: " << imported << ", block size: " << blockSize << ", step: " << step
+         << endl;
+
+    benchmark("rescan", txPool, *pending, poolSize - blockSize, blockSize, step, false);
+    benchmark("cursor", txPool, *pending, poolSize - blockSize, blockSize, step, true);
+    return 0;
+}
@@ -23,6 +23,7 @@
 #include "TxDAG.h"
 #include "libstorage/StorageException.h"
 #include "libstoragestate/StorageState.h"
+#include <libdevcore/Metrics.h>
 #include <libethcore/Exceptions.h>
 #include <libethcore/PrecompiledContract.h>
 #include <libethcore/TransactionReceipt.h>
@@ -38,6 +39,32 @@ using namespace dev::blockverifier;
 using namespace dev::executive;
 using namespace dev::storage;
 
+namespace
+{
+// compared with the allocations by tcmalloc when the arena is disabled
+void recordArenaUsage(ExecutiveContext::Ptr const& _context, int64_t _blockNumber)
+{
+    auto const& arena = _context->arena();
+    if (!arena)
+    {
+        return;
+    }
+    static auto allocationsMetric =
+        MetricsRegistry::instance().counter("bcos_block_arena_allocations_total",
+            "number of the objects allocated in the arenas of the executed blocks");
+    static auto bytesMetric = MetricsRegistry::instance().counter(
+        "bcos_block_arena_bytes_total", "bytes allocated in the arenas of the executed blocks");
+    auto allocations = arena->allocations();
+    auto allocatedBytes = arena->allocatedBytes();
+    allocationsMetric->inc(allocations);
+    bytesMetric->inc(allocatedBytes);
+    BLOCKVERIFIER_LOG(DEBUG) << LOG_BADGE("executeBlock") << LOG_DESC("Block arena usage")
+                             << LOG_KV("num", _blockNumber) << LOG_KV("allocations", allocations)
+                             << LOG_KV("allocatedBytes", allocatedBytes)
+                             << LOG_KV("reservedBytes", arena->reservedBytes());
+}
+}  // namespace
+
 ExecutiveContext::Ptr BlockVerifier::executeBlock(Block& block, BlockInfo const& parentBlockInfo)
 {
     // return nullptr prepare to exit when g_BCOSConfig.shouldExit is true
@@ -77,7 +104,7 @@ ExecutiveContext::Ptr BlockVerifier::executeBlock(Block& block, BlockInfo const&
 }
 
 ExecutiveContext::Ptr BlockVerifier::serialExecuteBlock(
-    Block& block, BlockInfo const& parentBlockInfo)
+    Block& block, BlockInfo const& parentBlockInfo, ExecuteBlockTimeCost* _timeCost)
 {
     BLOCKVERIFIER_LOG(INFO) << LOG_DESC("executeBlock]Executing block")
                             << LOG_KV("txNum", block.transactions()->size())
@@ -92,8 +119,14 @@ ExecutiveContext::Ptr BlockVerifier::serialExecuteBlock(
                             << LOG_KV("parentStateRoot", parentBlockInfo.stateRoot);
 
     uint64_t startTime = utcTime();
+    uint64_t phaseTime = utcSteadyTimeUs();
 
     ExecutiveContext::Ptr executiveContext = std::make_shared<ExecutiveContext>();
+    if (m_enableBlockArena)
+    {
+        // released in bulk when the context is dropped after the block is committed
+        executiveContext->setArena(std::make_shared<BlockArena>());
+    }
     try
     {
         m_executiveContextFactory->initExecutiveContext(
@@ -119,6 +152,11 @@ ExecutiveContext::Ptr BlockVerifier::serialExecuteBlock(
                              << LOG_KV("txNum", block.transactions()->size())
                              << LOG_KV("num", block.blockHeader().number());
     uint64_t pastTime = utcTime();
+    if (_timeCost)
+    {
+        _timeCost->initContext = utcSteadyTimeUs() - phaseTime;
+        phaseTime = utcSteadyTimeUs();
+    }
 
     try
     {
@@ -152,6 +190,11 @@ ExecutiveContext::Ptr BlockVerifier::serialExecuteBlock(
                              << LOG_KV("time(ms)", utcTime() - pastTime)
                              << LOG_KV("txNum", block.transactions()->size())
                              << LOG_KV("num", block.blockHeader().number());
+    if (_timeCost)
+    {
+        _timeCost->execution = utcSteadyTimeUs() - phaseTime;
+        phaseTime = utcSteadyTimeUs();
+    }
 
     h256 stateRoot = executiveContext->getState()->rootHash();
     // set stateRoot in receipts
@@ -172,6 +215,11 @@ ExecutiveContext::Ptr BlockVerifier::serialExecuteBlock(
     {
         block.header().setDBhash(executiveContext->getMemoryTableFactory()->hash());
     }
+    if (_timeCost)
+    {
+        _timeCost->hash = utcSteadyTimeUs() - phaseTime;
+    }
+    recordArenaUsage(executiveContext, block.blockHeader().number());
 
     // if executeBlock is called by consensus module, no need to compare receiptRoot and stateRoot
     // since origin value is empty if executeBlock is called by sync module, need to compare
@@ -214,7 +262,7 @@ ExecutiveContext::Ptr BlockVerifier::serialExecuteBlock(
 }
 
 ExecutiveContext::Ptr BlockVerifier::parallelExecuteBlock(
-    Block& block, BlockInfo const& parentBlockInfo)
+    Block& block, BlockInfo const& parentBlockInfo, ExecuteBlockTimeCost* _timeCost)
 
 {
     BLOCKVERIFIER_LOG(INFO) << LOG_DESC("[executeBlock]Executing block")
@@ -226,7 +274,12 @@ ExecutiveContext::Ptr BlockVerifier::parallelExecuteBlock(
 
     auto start_time = utcTime();
     auto record_time = utcTime();
+    uint64_t phaseTime = utcSteadyTimeUs();
     ExecutiveContext::Ptr executiveContext = std::make_shared<ExecutiveContext>();
+    if (m_enableBlockArena)
+    {
+        executiveContext->setArena(std::make_shared<BlockArena>());
+    }
     try
     {
         m_executiveContextFactory->initExecutiveContext(
@@ -245,6 +298,11 @@ ExecutiveContext::Ptr BlockVerifier::parallelExecuteBlock(
 
     auto initExeCtx_time_cost = utcTime() - record_time;
     record_time = utcTime();
+    if (_timeCost)
+    {
+        _timeCost->initContext = utcSteadyTimeUs() - phaseTime;
+        phaseTime = utcSteadyTimeUs();
+    }
 
     BlockHeader tmpHeader = block.blockHeader();
     block.clearAllReceipts();
@@ -253,7 +311,8 @@ ExecutiveContext::Ptr BlockVerifier::parallelExecuteBlock(
     record_time = utcTime();
 
     shared_ptr<TxDAG> txDag = make_shared<TxDAG>();
-    txDag->init(executiveContext, block.transactions(), block.blockHeader().number());
+    txDag->init(
+        executiveContext, block.transactions(), block.blockHeader().number(), m_threadNum);
 
 
     txDag->setTxExecuteFunc([&](Transaction::Ptr _tr, ID _txId, Executive::Ptr _executive) {
@@ -265,6 +324,11 @@ ExecutiveContext::Ptr BlockVerifier::parallelExecuteBlock(
     });
     auto initDag_time_cost = utcTime() - record_time;
     record_time = utcTime();
+    if (_timeCost)
+    {
+        _timeCost->dagBuild = utcSteadyTimeUs() - phaseTime;
+        phaseTime = utcSteadyTimeUs();
+    }
 
     auto parallelTimeOut = utcSteadyTime() + 30000;  // 30 timeout
 
@@ -273,7 +337,8 @@ ExecutiveContext::Ptr BlockVerifier::parallelExecuteBlock(
         tbb::atomic<bool> isWarnedTimeout(false);
         tbb::parallel_for(tbb::blocked_range<unsigned int>(0, m_threadNum),
             [&](const tbb::blocked_range<unsigned int>& _r) {
-                (void)_r;
+                // the ranges are disjoint, the first of which is the worker of the DAG
+                auto worker = _r.begin();
                 EnvInfo envInfo(block.blockHeader(), m_pNumberHash, 0);
                 envInfo.setPrecompiledEngine(executiveContext);
                 auto executive = createAndInitExecutive();
@@ -291,7 +356,7 @@ ExecutiveContext::Ptr BlockVerifier::parallelExecuteBlock(
                             << LOG_KV("blockNumber", block.blockHeader().number());
                     }
 
-                    txDag->executeUnit(executive);
+                    txDag->executeUnit(executive, worker);
                 }
             });
     }
@@ -311,6 +376,11 @@ ExecutiveContext::Ptr BlockVerifier::parallelExecuteBlock(
     }
     auto exe_time_cost = utcTime() - record_time;
     record_time = utcTime();
+    if (_timeCost)
+    {
+        _timeCost->execution = utcSteadyTimeUs() - phaseTime;
+        phaseTime = utcSteadyTimeUs();
+    }
 
     h256 stateRoot = executiveContext->getState()->rootHash();
     auto getRootHash_time_cost = utcTime() - record_time;
@@ -337,6 +407,11 @@ ExecutiveContext::Ptr BlockVerifier::parallelExecuteBlock(
     }
     auto setStateRoot_time_cost = utcTime() - record_time;
     record_time = utcTime();
+    if (_timeCost)
+    {
+        _timeCost->hash = utcSteadyTimeUs() - phaseTime;
+    }
+    recordArenaUsage(executiveContext, block.blockHeader().number());
     // Consensus module execute block, receiptRoot is empty, skip this judgment
     // The sync module execute block, receiptRoot is not empty, need to compare BlockHeader
     if (tmpHeader.receiptsRoot() != h256())
@@ -372,6 +447,8 @@ ExecutiveContext::Ptr BlockVerifier::parallelExecuteBlock(
     BLOCKVERIFIER_LOG(DEBUG) << LOG_BADGE("executeBlock") << LOG_DESC("Para execute block takes")
                              << LOG_KV("time(ms)", utcTime() - start_time)
                              << LOG_KV("txNum", block.transactions()->size())
+                             << LOG_KV("criticalPath", txDag->criticalPath())
+                             << LOG_KV("achievedParallelism", txDag->parallelism())
                              << LOG_KV("blockNumber", block.blockHeader().number())
                              << LOG_KV("blockHash", block.headerHash())
                              << LOG_KV("stateRoot", block.header().stateRoot())
@@ -415,6 +492,46 @@ TransactionReceipt::Ptr BlockVerifier::executeTransaction(
     return execute(_t, executiveContext, executive);
 }
 
+std::vector<std::shared_ptr<std::vector<std::string>>> BlockVerifier::getTxsCriticals(
+    BlockHeader const& _blockHeader, Transactions const& _txs)
+{
+    std::vector<std::shared_ptr<std::vector<std::string>>> txsCriticals(_txs.size());
+    ExecutiveContext::Ptr executiveContext;
+    {
+        // the context only reads the parallel configs, reuse it until a new block is committed
+        std::lock_guard<std::mutex> l(x_criticalsContext);
+        if (!m_criticalsContext || m_criticalsContextHash != _blockHeader.hash())
+        {
+            auto context = std::make_shared<ExecutiveContext>();
+            BlockInfo blockInfo{
+                _blockHeader.hash(), _blockHeader.number(), _blockHeader.stateRoot()};
+            try
+            {
+                m_executiveContextFactory->initExecutiveContext(
+                    blockInfo, _blockHeader.stateRoot(), context);
+            }
+            catch (exception& e)
+            {
+                BLOCKVERIFIER_LOG(ERROR)
+                    << LOG_DESC("[getTxsCriticals] Error during initExecutiveContext")
+                    << LOG_KV("errorMsg", boost::diagnostic_information(e));
+                return txsCriticals;
+            }
+            m_criticalsContext = context;
+            m_criticalsContextHash = _blockHeader.hash();
+        }
+        executiveContext = m_criticalsContext;
+    }
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, _txs.size()),
+        [&](const tbb::blocked_range<size_t>& _range) {
+            for (size_t i = _range.begin(); i < _range.end(); ++i)
+            {
+                txsCriticals[i] = executiveContext->getTxCriticals(*_txs[i]);
+            }
+        });
+    return txsCriticals;
+}
+
 dev::eth::TransactionReceipt::Ptr BlockVerifier::execute(dev::eth::Transaction::Ptr _t,
     dev::blockverifier::ExecutiveContext::Ptr executiveContext, Executive::Ptr executive)
 {
@@ -65,15 +65,19 @@ public:
     virtual ~BlockVerifier() {}
 
     ExecutiveContext::Ptr executeBlock(dev::eth::Block& block, BlockInfo const& parentBlockInfo);
-    ExecutiveContext::Ptr serialExecuteBlock(
-        dev::eth::Block& block, BlockInfo const& parentBlockInfo);
-    ExecutiveContext::Ptr parallelExecuteBlock(
-        dev::eth::Block& block, BlockInfo const& parentBlockInfo);
+    /// @param _timeCost: if not null, filled with the time cost of the phases
+    ExecutiveContext::Ptr serialExecuteBlock(dev::eth::Block& block,
+        BlockInfo const& parentBlockInfo, ExecuteBlockTimeCost* _timeCost = nullptr);
+    ExecutiveContext::Ptr parallelExecuteBlock(dev::eth::Block& block,
+        BlockInfo const& parentBlockInfo, ExecuteBlockTimeCost* _timeCost = nullptr);
 
 
     dev::eth::TransactionReceipt::Ptr executeTransaction(
         const dev::eth::BlockHeader& blockHeader, dev::eth::Transaction::Ptr _t);
 
+    std::vector<std::shared_ptr<std::vector<std::string>>> getTxsCriticals(
+        dev::eth::BlockHeader const& _blockHeader, dev::eth::Transactions const& _txs) override;
+
     dev::eth::TransactionReceipt::Ptr execute(dev::eth::Transaction::Ptr _t,
         dev::blockverifier::ExecutiveContext::Ptr executiveContext,
         dev::executive::Executive::Ptr executive);
@@ -91,6 +95,8 @@ public:
 
     dev::executive::Executive::Ptr createAndInitExecutive();
     void setEvmFlags(VMFlagType const& _evmFlags) { m_evmFlags = _evmFlags; }
+    /// allocate the objects dying with the executed block in a BlockArena
+    void setEnableBlockArena(bool _enableBlockArena) { m_enableBlockArena = _enableBlockArena; }
 
 private:
     ExecutiveContextFactory::Ptr m_executiveContextFactory;
@@ -102,6 +108,12 @@ private:
     std::atomic<int64_t> m_executingNumber = {0};
 
     VMFlagType m_evmFlags = 0;
+    bool m_enableBlockArena = false;
+
+    /// the context to get the criticals of the transactions to be sealed on the latest block
+    ExecutiveContext::Ptr m_criticalsContext;
+    dev::h256 m_criticalsContextHash;
+    std::mutex x_criticalsContext;
 };
 
 }  // namespace blockverifier
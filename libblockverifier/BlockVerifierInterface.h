@@ -53,6 +53,14 @@ public:
 
     virtual dev::eth::TransactionReceipt::Ptr executeTransaction(
         const dev::eth::BlockHeader& blockHeader, dev::eth::Transaction::Ptr _t) = 0;
+
+    /// get the critical fields of the transactions on the state of the given block, a null
+    /// critical fields means the transaction conflicts with all the others
+    virtual std::vector<std::shared_ptr<std::vector<std::string>>> getTxsCriticals(
+        dev::eth::BlockHeader const&, dev::eth::Transactions const& _txs)
+    {
+        return std::vector<std::shared_ptr<std::vector<std::string>>>(_txs.size());
+    }
 };
 }  // namespace blockverifier
 }  // namespace dev
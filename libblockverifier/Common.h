@@ -41,5 +41,15 @@ struct BlockInfo
     int64_t number;
     dev::h256 stateRoot;
 };
+
+/// the time cost of the phases of executing a block, in microseconds
+struct ExecuteBlockTimeCost
+{
+    uint64_t initContext = 0;
+    uint64_t dagBuild = 0;
+    uint64_t execution = 0;
+    // calculate the state root, receipt root and dbHash
+    uint64_t hash = 0;
+};
 }  // namespace blockverifier
 }  // namespace dev
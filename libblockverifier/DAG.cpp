@@ -22,129 +22,305 @@
 
 #include "DAG.h"
 #include <libconfig/GlobalConfigure.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
 using namespace std;
 using namespace dev;
 using namespace dev::blockverifier;
 
+namespace
+{
+// the capacity of the deque of every worker, the vertexes out of it go to the overflow queue
+const size_t c_maxDequeCapacity = 4096;
+// the idle worker spins, then yields, then sleeps before waitPop gives up
+const size_t c_spinRounds = 64;
+const size_t c_yieldRounds = 256;
+const std::chrono::microseconds c_idleSleep(50);
+const std::chrono::milliseconds c_maxIdle(10);
+}  // namespace
+
+WorkStealingDeque::WorkStealingDeque(size_t _capacity)
+{
+    size_t capacity = 1;
+    while (capacity < _capacity)
+    {
+        capacity <<= 1;
+    }
+    m_buffer.reset(new std::atomic<ID>[capacity]);
+    m_mask = capacity - 1;
+}
+
+bool WorkStealingDeque::push(ID _id)
+{
+    auto bottom = m_bottom.load(std::memory_order_relaxed);
+    if (bottom - m_top.load() > m_mask)
+    {
+        return false;
+    }
+    m_buffer[bottom & m_mask].store(_id, std::memory_order_relaxed);
+    m_bottom.store(bottom + 1);
+    return true;
+}
+
+ID WorkStealingDeque::pop()
+{
+    auto bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+    // reserve the bottom before checking the top, the thieves see it before taking the last one
+    m_bottom.store(bottom);
+    auto top = m_top.load();
+    if (top > bottom)
+    {
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return INVALID_ID;
+    }
+    ID id = m_buffer[bottom & m_mask].load(std::memory_order_relaxed);
+    if (top == bottom)
+    {
+        // the last one, race with the thieves
+        if (!m_top.compare_exchange_strong(top, top + 1))
+        {
+            id = INVALID_ID;
+        }
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return id;
+}
+
+ID WorkStealingDeque::steal()
+{
+    auto top = m_top.load();
+    auto bottom = m_bottom.load();
+    if (top >= bottom)
+    {
+        return INVALID_ID;
+    }
+    ID id = m_buffer[top & m_mask].load(std::memory_order_relaxed);
+    if (!m_top.compare_exchange_strong(top, top + 1))
+    {
+        // stolen by the others or popped by the owner
+        return INVALID_ID;
+    }
+    return id;
+}
+
 DAG::~DAG()
 {
     clear();
 }
 
-void DAG::init(ID _maxSize)
+void DAG::init(ID _maxSize, size_t _workerNum)
 {
     clear();
+    m_inDegrees.reset(new std::atomic<ID>[_maxSize]);
     for (ID i = 0; i < _maxSize; ++i)
-        m_vtxs.emplace_back(make_shared<Vertex>());
+    {
+        m_inDegrees[i].store(0, std::memory_order_relaxed);
+    }
     m_totalVtxs = _maxSize;
     m_totalConsume = 0;
+
+    _workerNum = std::max(_workerNum, (size_t)1);
+    auto capacity =
+        std::min(((size_t)_maxSize + _workerNum - 1) / _workerNum, c_maxDequeCapacity);
+    for (size_t i = 0; i < _workerNum; ++i)
+    {
+        m_deques.emplace_back(new WorkStealingDeque(capacity));
+    }
 }
 
 void DAG::addEdge(ID _f, ID _t)
 {
-    if (_f >= m_vtxs.size() && _t >= m_vtxs.size())
+    if (_f >= m_totalVtxs || _t >= m_totalVtxs)
         return;
-    m_vtxs[_f]->outEdge.emplace_back(_t);
-    m_vtxs[_t]->inDegree += 1;
+    m_addedEdges.emplace_back(_f, _t);
+    m_inDegrees[_t].fetch_add(1, std::memory_order_relaxed);
     // PARA_LOG(TRACE) << LOG_BADGE("DAG") << LOG_DESC("Add edge") << LOG_KV("from", _f)
     //                << LOG_KV("to", _t);
 }
 
 void DAG::generate()
 {
-    for (ID id = 0; id < m_vtxs.size(); ++id)
+    // lay the out edges of every vertex side by side, in the order of adding
+    m_edgeOffsets.assign(m_totalVtxs + 1, 0);
+    for (auto const& edge : m_addedEdges)
+    {
+        ++m_edgeOffsets[edge.first + 1];
+    }
+    for (ID id = 0; id < m_totalVtxs; ++id)
+    {
+        m_edgeOffsets[id + 1] += m_edgeOffsets[id];
+    }
+    m_edges.resize(m_addedEdges.size());
+    std::vector<ID> cursors(m_edgeOffsets.begin(), m_edgeOffsets.end() - 1);
+    for (auto const& edge : m_addedEdges)
+    {
+        m_edges[cursors[edge.first]++] = edge.second;
+    }
+    m_addedEdges = std::vector<std::pair<ID, ID>>();
+
+    // deal the tops to the workers in turn and push them backward, so that the owners pop the
+    // smaller IDs first, the tops out of the deques wait in the overflow queue in order
+    std::vector<ID> tops;
+    for (ID id = 0; id < m_totalVtxs; ++id)
+    {
+        if (m_inDegrees[id].load(std::memory_order_relaxed) == 0)
+        {
+            tops.emplace_back(id);
+        }
+    }
+    size_t dealtSize = std::min(tops.size(), m_deques.size() * m_deques[0]->capacity());
+    for (size_t i = dealtSize; i > 0; --i)
+    {
+        push(tops[i - 1], (i - 1) % m_deques.size());
+    }
+    for (size_t i = dealtSize; i < tops.size(); ++i)
     {
-        if (m_vtxs[id]->inDegree == 0)
-            m_topLevel.push(id);
+        m_overflow.push(tops[i]);
     }
+    computeLongestPath(tops);
 
-    // PARA_LOG(TRACE) << LOG_BADGE("DAG") << LOG_DESC("generate")
-    //                << LOG_KV("queueSize", m_topLevel.size());
-    // for (ID id = 0; id < m_vtxs.size(); id++)
+    // PARA_LOG(TRACE) << LOG_BADGE("DAG") << LOG_DESC("generate");
+    // for (ID id = 0; id < m_totalVtxs; id++)
     // printVtx(id);
 }
 
-ID DAG::waitPop(bool _needWait)
+void DAG::computeLongestPath(IDs const& _tops)
+{
+    // visit the vertexes in topological order, the level of a vertex is one more than the deepest
+    // vertex pointing to it
+    std::vector<ID> inDegrees(m_totalVtxs);
+    for (ID id = 0; id < m_totalVtxs; ++id)
+    {
+        inDegrees[id] = m_inDegrees[id].load(std::memory_order_relaxed);
+    }
+    std::vector<ID> levels(m_totalVtxs, 1);
+    IDs visiting(_tops);
+    m_longestPath = 0;
+    for (size_t i = 0; i < visiting.size(); ++i)
+    {
+        ID id = visiting[i];
+        m_longestPath = std::max(m_longestPath, levels[id]);
+        for (ID e = m_edgeOffsets[id]; e < m_edgeOffsets[id + 1]; ++e)
+        {
+            ID to = m_edges[e];
+            levels[to] = std::max(levels[to], levels[id] + 1);
+            if (--inDegrees[to] == 0)
+            {
+                visiting.emplace_back(to);
+            }
+        }
+    }
+}
+
+ID DAG::waitPop(size_t _worker, bool _needWait)
 {
-    // Note: concurrent_queue of TBB can't be used with boost::conditional_variable
-    //       the try_pop will already be false
-    std::unique_lock<std::mutex> ul(x_topLevel);
-    ID top = INVALID_ID;
-    cv_topLevel.wait_for(ul, std::chrono::milliseconds(10), [&]() {
-        auto has = m_topLevel.try_pop(top);
-        if (has)
+    // no lock and no condition variable, the idle worker backs off by itself
+    std::chrono::steady_clock::time_point sleepStart;
+    for (size_t round = 0;; ++round)
+    {
+        ID top = pop(_worker);
+        // process-exit related:
+        // if the g_BCOSConfig.shouldExit is true (may be the storage has exceptioned)
+        // return INVALID_ID
+        if (top != INVALID_ID || hasFinished() || !_needWait || g_BCOSConfig.shouldExit.load())
         {
-            return true;
+            return top;
         }
-        else if (m_totalConsume >= m_totalVtxs)
+        if (round < c_spinRounds)
         {
-            return true;
+            continue;
         }
-        else if (!_needWait)
+        if (round < c_yieldRounds)
         {
-            return true;
+            std::this_thread::yield();
+            continue;
         }
-        // process-exit related:
-        // if the g_BCOSConfig.shouldExit is true (may be the storage has exceptioned)
-        // return true, will pop INVALID_ID
-        else if (g_BCOSConfig.shouldExit.load())
+        if (round == c_yieldRounds)
         {
-            return true;
+            sleepStart = std::chrono::steady_clock::now();
         }
-
-        return false;
-    });
-    return top;
+        else if (std::chrono::steady_clock::now() - sleepStart >= c_maxIdle)
+        {
+            return INVALID_ID;
+        }
+        std::this_thread::sleep_for(c_idleSleep);
+    }
 }
 
-ID DAG::consume(ID _id)
+ID DAG::consume(ID _id, size_t _worker)
 {
-    ID producedNum = 0;
     ID nextId = INVALID_ID;
-    ID lastDegree = INVALID_ID;
-    for (ID id : m_vtxs[_id]->outEdge)
+    for (ID i = m_edgeOffsets[_id]; i < m_edgeOffsets[_id + 1]; ++i)
     {
-        auto vtx = m_vtxs[id];
+        ID id = m_edges[i];
+        if (m_inDegrees[id].fetch_sub(1) == 1)
         {
-            lastDegree = vtx->inDegree.fetch_sub(1);
-        }
-        if (lastDegree == 1)
-        {
-            ++producedNum;
-            if (producedNum == 1)
+            // run the first new top at once in this worker, the others may be stolen
+            if (nextId == INVALID_ID)
             {
                 nextId = id;
             }
             else
             {
-                m_topLevel.push(id);
-                cv_topLevel.notify_one();
+                push(id, _worker);
             }
         }
     }
+    m_totalConsume.fetch_add(1);
+    // PARA_LOG(TRACE) << LOG_BADGE("DAG") << LOG_DESC("consumed") << LOG_KV("ID", _id);
+    return nextId;
+}
 
-    if (m_totalConsume.fetch_add(1) + 1 == m_totalVtxs)
+ID DAG::pop(size_t _worker)
+{
+    ID id = m_deques[_worker]->pop();
+    if (id != INVALID_ID)
     {
-        cv_topLevel.notify_all();
+        return id;
+    }
+    if (m_overflow.try_pop(id))
+    {
+        return id;
+    }
+    // steal from the other workers in turn, starting from the next one
+    for (size_t i = 1; i < m_deques.size(); ++i)
+    {
+        id = m_deques[(_worker + i) % m_deques.size()]->steal();
+        if (id != INVALID_ID)
+        {
+            return id;
+        }
+    }
+    return INVALID_ID;
+}
+
+void DAG::push(ID _id, size_t _worker)
+{
+    if (!m_deques[_worker]->push(_id))
+    {
+        m_overflow.push(_id);
     }
-    // PARA_LOG(TRACE) << LOG_BADGE("TbbCqDAG") << LOG_DESC("consumed")
-    //                << LOG_KV("queueSize", m_topLevel.size());
-    // for (ID id = 0; id < m_vtxs.size(); id++)
-    // printVtx(id);
-    return nextId;
 }
 
 void DAG::clear()
 {
-    m_vtxs = std::vector<std::shared_ptr<Vertex>>();
-    // XXXX m_topLevel.clear();
+    m_inDegrees.reset();
+    m_edgeOffsets = std::vector<ID>();
+    m_edges = std::vector<ID>();
+    m_addedEdges = std::vector<std::pair<ID, ID>>();
+    m_deques.clear();
+    m_overflow.clear();
+    m_totalVtxs = 0;
+    m_longestPath = 0;
 }
 
 void DAG::printVtx(ID _id)
 {
-    for (ID id : m_vtxs[_id]->outEdge)
+    for (ID i = m_edgeOffsets[_id]; i < m_edgeOffsets[_id + 1]; ++i)
     {
         PARA_LOG(TRACE) << LOG_BADGE("DAG") << LOG_DESC("VertexEdge") << LOG_KV("ID", _id)
-                        << LOG_KV("inDegree", m_vtxs[_id]->inDegree) << LOG_KV("edge", id);
+                        << LOG_KV("inDegree", m_inDegrees[_id].load())
+                        << LOG_KV("edge", m_edges[i]);
     }
 }
\ No newline at end of file
@@ -23,12 +23,11 @@
 
 #pragma once
 #include "Common.h"
-#include <libdevcore/Guards.h>
 #include <tbb/concurrent_queue.h>
-#include <condition_variable>
+#include <atomic>
 #include <cstdint>
-#include <queue>
-#include <thread>
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace dev
@@ -39,22 +38,45 @@ using ID = uint32_t;
 using IDs = std::vector<ID>;
 static const ID INVALID_ID = (ID(0) - 1);
 
-struct Vertex
+/**
+ * @brief The Chase-Lev deque of the vertices ready to run. The owner worker pushes and pops at the
+ * bottom, the other workers steal from the top, all without lock.
+ * The capacity is fixed, push fails when the deque is full.
+ */
+class WorkStealingDeque
 {
-    std::atomic<ID> inDegree;
-    std::vector<ID> outEdge;
+public:
+    // _capacity is rounded up to the power of 2
+    explicit WorkStealingDeque(size_t _capacity);
+
+    // Called by the owner
+    bool push(ID _id);
+    ID pop();
+
+    // Called by the other workers
+    ID steal();
+
+    size_t capacity() const { return m_mask + 1; }
+
+private:
+    std::unique_ptr<std::atomic<ID>[]> m_buffer;
+    int64_t m_mask = 0;
+    // the thieves and the owner update top and bottom respectively, keep them in their own lines
+    std::atomic<int64_t> m_top{0};
+    char m_padding[64];
+    std::atomic<int64_t> m_bottom{0};
 };
 
 class DAG
 {
-    // Just algorithm, not thread safe
+    // Build the DAG in one thread, then run it by several workers at the same time
 public:
     DAG(){};
     ~DAG();
 
     // Init DAG basic memory, should call before other function
-    // _maxSize is max ID + 1
-    void init(ID _maxSize);
+    // _maxSize is max ID + 1, _workerNum is the number of workers running the DAG
+    void init(ID _maxSize, size_t _workerNum = 1);
 
     // Add edge between vertex
     void addEdge(ID _f, ID _t);
@@ -62,26 +84,47 @@ public:
     // Generate DAG
     void generate();
 
-    // Wait until topLevel is not empty, return INVALID_ID if DAG reach the end
-    ID waitPop(bool _needWait = true);
+    // Pop a vertex without in-edge for _worker, return INVALID_ID if DAG reach the end, or no
+    // vertex comes out after a while, or _needWait is false and no vertex is ready
+    // (thread safe for the different workers)
+    ID waitPop(size_t _worker, bool _needWait = true);
+
+    // Consume the top, return one of the new tops and push the others to the deque of _worker
+    // (thread safe for the different workers)
+    ID consume(ID _id, size_t _worker);
+
+    // Has all the vertexes been consumed?
+    bool hasFinished() const { return m_totalConsume.load() >= m_totalVtxs; }
 
-    // Consume the top and add new top in top queue (thread safe)
-    ID consume(ID _id);
+    ID consumedNumber() const { return m_totalConsume.load(); }
 
-    // Clear all data of this class (thread safe)
+    // The number of vertexes on the longest path, valid after generate
+    ID longestPath() const { return m_longestPath; }
+
+    // Clear all data of this class
     void clear();
 
 private:
-    std::vector<std::shared_ptr<Vertex>> m_vtxs;
-    tbb::concurrent_queue<ID> m_topLevel;
+    ID pop(size_t _worker);
+    void push(ID _id, size_t _worker);
+    void computeLongestPath(IDs const& _tops);
+
+    // the flat vertexes, the out edges of vertex i are m_edges[m_edgeOffsets[i]:m_edgeOffsets[i+1]]
+    std::unique_ptr<std::atomic<ID>[]> m_inDegrees;
+    std::vector<ID> m_edgeOffsets;
+    std::vector<ID> m_edges;
+    std::vector<std::pair<ID, ID>> m_addedEdges;
+
+    std::vector<std::unique_ptr<WorkStealingDeque>> m_deques;
+    // the vertexes overflowing the deques
+    tbb::concurrent_queue<ID> m_overflow;
 
     ID m_totalVtxs = 0;
-    std::atomic<ID> m_totalConsume;
+    ID m_longestPath = 0;
+    std::atomic<ID> m_totalConsume{0};
 
 private:
     void printVtx(ID _id);
-    mutable std::mutex x_topLevel;
-    std::condition_variable cv_topLevel;
 };
 
 }  // namespace blockverifier
@@ -154,12 +154,13 @@ void ExecutiveContext::dbCommit(Block& block)
     m_memoryTableFactory->commitDB(block.header().hash(), block.header().number());
 }
 
-std::shared_ptr<std::vector<std::string>> ExecutiveContext::getTxCriticals(const Transaction& _tx)
+bool ExecutiveContext::getTxCriticalFields(
+    const Transaction& _tx, std::vector<std::string>& _criticals)
 {
     if (_tx.isCreation())
     {
         // Not to parallel contract creation transaction
-        return nullptr;
+        return false;
     }
 
     auto p = getPrecompiled(_tx.receiveAddress());
@@ -168,21 +169,17 @@ std::shared_ptr<std::vector<std::string>> ExecutiveContext::getTxCriticals(const
         // Precompile transaction
         if (p->isParallelPrecompiled())
         {
-            auto ret = make_shared<vector<string>>(p->getParallelTag(ref(_tx.data())));
-            for (string& critical : *ret)
-            {
-                critical += _tx.receiveAddress().hex();
-            }
-            return ret;
+            _criticals = p->getParallelTag(_tx.dataRef());
+            return true;
         }
         else
         {
-            return nullptr;
+            return false;
         }
     }
     else
     {
-        uint32_t selector = dev::precompiled::getParamFunc(ref(_tx.data()));
+        uint32_t selector = dev::precompiled::getParamFunc(_tx.dataRef());
 
         auto receiveAddress = _tx.receiveAddress();
         std::shared_ptr<dev::precompiled::ParallelConfig> config = nullptr;
@@ -190,9 +187,10 @@ std::shared_ptr<std::vector<std::string>> ExecutiveContext::getTxCriticals(const
         // Note: Only when initializing DAG, get ParallelConfig, will not get ParallelConfig during
         // transaction execution
         auto parallelKey = std::make_pair(receiveAddress, selector);
-        if (m_parallelConfigCache.count(parallelKey))
+        auto it = m_parallelConfigCache.find(parallelKey);
+        if (it != m_parallelConfigCache.end())
         {
-            config = m_parallelConfigCache[parallelKey];
+            config = it->second;
         }
         // miss the cache, fetch ParallelConfig from the table and cache the config
         else
@@ -204,57 +202,60 @@ std::shared_ptr<std::vector<std::string>> ExecutiveContext::getTxCriticals(const
 
         if (config == nullptr)
         {
-            return nullptr;
+            return false;
         }
-        else
+        // the param types are parsed once for all the blocks by getParallelConfig
+        if (!config->criticalParamsType)
         {
-            {  // Testing code
-                // bytesConstRef data = parallelConfigPrecompiled->getParamData(ref(_tx.data()));
-                auto res = make_shared<vector<string>>();
-
-                ABIFunc af;
-                bool isOk = af.parser(config->functionName);
-                if (!isOk)
-                {
-                    EXECUTIVECONTEXT_LOG(DEBUG)
-                        << LOG_DESC("[getTxCriticals] parser function signature failed, ")
-                        << LOG_KV("func signature", config->functionName);
-
-                    return nullptr;
-                }
-
-                auto paramTypes = af.getParamsType();
-                if (paramTypes.size() < (size_t)config->criticalSize)
-                {
-                    EXECUTIVECONTEXT_LOG(DEBUG)
-                        << LOG_DESC("[getTxCriticals] params type less than  criticalSize")
-                        << LOG_KV("func signature", config->functionName)
-                        << LOG_KV("func criticalSize", config->criticalSize)
-                        << LOG_KV("input data", toHex(_tx.data()));
-
-                    return nullptr;
-                }
-
-                paramTypes.resize((size_t)config->criticalSize);
+            return false;
+        }
 
-                ContractABI abi;
-                isOk = abi.abiOutByFuncSelector(ref(_tx.data()).cropped(4), paramTypes, *res);
-                if (!isOk)
-                {
-                    EXECUTIVECONTEXT_LOG(DEBUG) << LOG_DESC("[getTxCriticals] abiout failed, ")
-                                                << LOG_KV("func signature", config->functionName)
-                                                << LOG_KV("input data", toHex(_tx.data()));
+        ContractABI abi;
+        bool isOk = abi.abiOutByFuncSelector(
+            _tx.dataRef().cropped(4), *config->criticalParamsType, _criticals);
+        if (!isOk)
+        {
+            EXECUTIVECONTEXT_LOG(DEBUG) << LOG_DESC("[getTxCriticals] abiout failed, ")
+                                        << LOG_KV("func signature", config->functionName)
+                                        << LOG_KV("input data", toHex(_tx.data()));
 
-                    return nullptr;
-                }
+            return false;
+        }
+        return true;
+    }
+}
 
-                for (string& critical : *res)
-                {
-                    critical += _tx.receiveAddress().hex();
-                }
+std::shared_ptr<std::vector<std::string>> ExecutiveContext::getTxCriticals(const Transaction& _tx)
+{
+    auto criticals = make_shared<vector<string>>();
+    if (!getTxCriticalFields(_tx, *criticals))
+    {
+        return nullptr;
+    }
+    auto receiveAddress = _tx.receiveAddress().hex();
+    for (string& critical : *criticals)
+    {
+        critical += receiveAddress;
+    }
+    return criticals;
+}
 
-                return res;
-            }
-        }
+std::shared_ptr<CriticalKeys> ExecutiveContext::getTxCriticalKeys(const Transaction& _tx)
+{
+    std::vector<std::string> criticals;
+    if (!getTxCriticalFields(_tx, criticals))
+    {
+        return nullptr;
+    }
+    auto keys = make_shared<CriticalKeys>();
+    keys->reserve(criticals.size());
+    auto addressHash = std::hash<Address>()(_tx.receiveAddress());
+    for (auto const& critical : criticals)
+    {
+        // mix the hashes as boost::hash_combine
+        CriticalKey key = std::hash<std::string>()(critical);
+        key ^= addressHash + 0x9e3779b97f4a7c15ULL + (key << 6) + (key >> 2);
+        keys->emplace_back(key);
     }
+    return keys;
 }
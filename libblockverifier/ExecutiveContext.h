@@ -22,6 +22,7 @@
 
 #include "Common.h"
 #include "libprecompiled/Precompiled.h"
+#include <libdevcore/BlockArena.h>
 #include <libdevcore/Common.h>
 #include <libdevcore/FixedHash.h>
 #include <libdevcrypto/Common.h>
@@ -38,6 +39,7 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <vector>
 
 namespace dev
 {
@@ -59,6 +61,11 @@ struct ParallelConfig;
 }  // namespace precompiled
 namespace blockverifier
 {
+/// the critical field of the transaction hashed with the receive address, the transactions with
+/// the same key conflict, a hash collision only adds a needless conflict
+using CriticalKey = uint64_t;
+using CriticalKeys = std::vector<CriticalKey>;
+
 class ExecutiveContext : public std::enable_shared_from_this<ExecutiveContext>
 {
 public:
@@ -125,13 +132,24 @@ public:
         return m_memoryTableFactory;
     }
 
+    /// the arena of the objects dying with the block, null if the context doesn't execute a block
+    BlockArena::Ptr const& arena() const { return m_arena; }
+    void setArena(BlockArena::Ptr _arena) { m_arena = _arena; }
+
     uint64_t txGasLimit() const { return m_txGasLimit; }
     void setTxGasLimit(uint64_t _txGasLimit) { m_txGasLimit = _txGasLimit; }
 
     // Get transaction criticals, return nullptr if critical to all
     std::shared_ptr<std::vector<std::string>> getTxCriticals(const dev::eth::Transaction& _tx);
 
+    // Get the keys of transaction criticals, return nullptr if critical to all
+    std::shared_ptr<CriticalKeys> getTxCriticalKeys(const dev::eth::Transaction& _tx);
+
 private:
+    // Get transaction criticals without the receive address, return false if critical to all
+    bool getTxCriticalFields(
+        const dev::eth::Transaction& _tx, std::vector<std::string>& _criticals);
+
     tbb::concurrent_unordered_map<Address, std::shared_ptr<precompiled::Precompiled>,
         std::hash<Address>>
         m_address2Precompiled;
@@ -141,6 +159,7 @@ private:
     std::unordered_map<Address, dev::eth::PrecompiledContract> m_precompiledContract;
     std::shared_ptr<dev::storage::TableFactory> m_memoryTableFactory;
     uint64_t m_txGasLimit = 300000000;
+    BlockArena::Ptr m_arena;
 
     std::shared_ptr<dev::precompiled::PrecompiledExecResultFactory> m_precompiledExecResultFactory;
     std::shared_ptr<dev::precompiled::ParallelConfigPrecompiled> m_parallelConfigPrecompiled;
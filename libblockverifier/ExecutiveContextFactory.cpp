@@ -52,6 +52,7 @@ void ExecutiveContextFactory::initExecutiveContext(
 {
     auto memoryTableFactory =
         m_tableFactoryFactory->newTableFactory(blockInfo.hash, blockInfo.number);
+    memoryTableFactory->setArena(context->arena());
     context->setPrecompiledExecResultFactory(m_precompiledExecResultFactory);
     auto tableFactoryPrecompiled = std::make_shared<dev::precompiled::TableFactoryPrecompiled>();
     tableFactoryPrecompiled->setMemoryTableFactory(memoryTableFactory);
@@ -22,8 +22,11 @@
 
 #include "TxDAG.h"
 #include "Common.h"
+#include <tbb/concurrent_unordered_map.h>
+#include <tbb/concurrent_vector.h>
+#include <tbb/enumerable_thread_specific.h>
 #include <tbb/parallel_for.h>
-#include <map>
+#include <algorithm>
 
 using namespace std;
 using namespace dev;
@@ -34,77 +37,111 @@ using namespace dev::executive;
 #define DAG_LOG(LEVEL) LOG(LEVEL) << LOG_BADGE("DAG")
 
 // Generate DAG according with given transactions
-void TxDAG::init(
-    ExecutiveContext::Ptr _ctx, std::shared_ptr<dev::eth::Transactions> _txs, int64_t _blockHeight)
+void TxDAG::init(ExecutiveContext::Ptr _ctx, std::shared_ptr<dev::eth::Transactions> _txs,
+    int64_t _blockHeight, size_t _workerNum)
 {
     DAG_LOG(TRACE) << LOG_DESC("Begin init transaction DAG") << LOG_KV("blockHeight", _blockHeight)
                    << LOG_KV("transactionNum", _txs->size());
 
     m_txs = _txs;
-    m_dag.init(_txs->size());
+    ID txsSize = _txs->size();
+    m_dag.init(txsSize, _workerNum);
 
-    // get criticals
-    std::vector<std::shared_ptr<std::vector<std::string>>> txsCriticals;
-    auto txsSize = _txs->size();
-    txsCriticals.resize(txsSize);
+    // get the critical keys and group the transactions by key
+    std::vector<std::shared_ptr<CriticalKeys>> txsKeys(txsSize);
+    tbb::concurrent_unordered_map<CriticalKey, tbb::concurrent_vector<ID>> txsOfKey;
     tbb::parallel_for(
-        tbb::blocked_range<uint64_t>(0, txsSize), [&](const tbb::blocked_range<uint64_t>& range) {
-            for (uint64_t i = range.begin(); i < range.end(); i++)
+        tbb::blocked_range<ID>(0, txsSize), [&](const tbb::blocked_range<ID>& _range) {
+            for (ID id = _range.begin(); id < _range.end(); ++id)
             {
-                auto& tx = (*_txs)[i];
-                txsCriticals[i] = _ctx->getTxCriticals(*tx);
+                txsKeys[id] = _ctx->getTxCriticalKeys(*(*_txs)[id]);
+                if (txsKeys[id])
+                {
+                    for (auto key : *txsKeys[id])
+                    {
+                        txsOfKey[key].push_back(id);
+                    }
+                }
             }
         });
 
-    CriticalField<string> latestCriticals;
-
+    // Normal transaction: Conflict with all transaction, it splits the block into segments
+    // the normal transactions before and after every transaction
+    IDs normalBefore(txsSize, INVALID_ID);
+    IDs normalAfter(txsSize, INVALID_ID);
+    ID lastNormal = INVALID_ID;
     for (ID id = 0; id < txsSize; ++id)
     {
-#if 0
-        auto& tx = _txs[id];
-        // Is para transaction?
-        auto criticals = _ctx->getTxCriticals(tx);
-#endif
-        auto criticals = txsCriticals[id];
-        if (criticals)
+        normalBefore[id] = lastNormal;
+        if (!txsKeys[id])
         {
-            // DAG transaction: Conflict with certain critical fields
-            // Get critical field
+            lastNormal = id;
+        }
+    }
+    lastNormal = INVALID_ID;
+    for (ID id = txsSize; id > 0; --id)
+    {
+        normalAfter[id - 1] = lastNormal;
+        if (!txsKeys[id - 1])
+        {
+            lastNormal = id - 1;
+        }
+    }
 
-            // Add edge between critical transaction
-            for (string const& c : *criticals)
+    // DAG transaction: Conflict with the last transaction of the same key in the segment, or the
+    // normal transaction beginning the segment, the normal transaction ending the segment
+    // conflicts with the last transaction of every key
+    tbb::enumerable_thread_specific<std::vector<std::pair<ID, ID>>> edges;
+    tbb::parallel_for(txsOfKey.range(),
+        [&](tbb::concurrent_unordered_map<CriticalKey, tbb::concurrent_vector<ID>>::range_type&
+                _range) {
+            auto& localEdges = edges.local();
+            IDs ids;
+            for (auto it = _range.begin(); it != _range.end(); ++it)
             {
-                ID pId = latestCriticals.get(c);
-                if (pId != INVALID_ID)
+                ids.assign(it->second.begin(), it->second.end());
+                std::sort(ids.begin(), ids.end());
+                ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+                for (size_t i = 0; i < ids.size(); ++i)
                 {
-                    m_dag.addEdge(pId, id);  // add DAG edge
+                    ID id = ids[i];
+                    if (i > 0 && normalBefore[ids[i - 1]] == normalBefore[id])
+                    {
+                        localEdges.emplace_back(ids[i - 1], id);
+                    }
+                    else if (normalBefore[id] != INVALID_ID)
+                    {
+                        localEdges.emplace_back(normalBefore[id], id);
+                    }
+                    bool lastInSegment =
+                        i + 1 == ids.size() || normalBefore[ids[i + 1]] != normalBefore[id];
+                    if (lastInSegment && normalAfter[id] != INVALID_ID)
+                    {
+                        localEdges.emplace_back(id, normalAfter[id]);
+                    }
                 }
             }
-
-            for (string const& c : *criticals)
-            {
-                latestCriticals.update(c, id);
-            }
+        });
+    for (ID id = 0; id < txsSize; ++id)
+    {
+        if (!txsKeys[id] && normalBefore[id] != INVALID_ID)
+        {
+            m_dag.addEdge(normalBefore[id], id);
         }
-        else
+    }
+    for (auto const& localEdges : edges)
+    {
+        for (auto const& edge : localEdges)
         {
-            // Normal transaction: Conflict with all transaction
-            latestCriticals.foreachField([&](std::pair<string, ID> _fieldAndId) {
-                ID pId = _fieldAndId.second;
-                // Add edge from all critical transaction
-                m_dag.addEdge(pId, id);
-                return true;
-            });
-
-            // set all critical to my id
-            latestCriticals.setCriticalAll(id);
+            m_dag.addEdge(edge.first, edge.second);  // add DAG edge
         }
     }
 
     // Generate DAG
     m_dag.generate();
 
-    m_totalParaTxs = _txs->size();
+    m_totalParaTxs = txsSize;
+    m_criticalPath = m_dag.longestPath();
 
     DAG_LOG(TRACE) << LOG_DESC("End init transaction DAG") << LOG_KV("blockHeight", _blockHeight);
 }
@@ -115,26 +152,21 @@ void TxDAG::setTxExecuteFunc(ExecuteTxFunc const& _f)
     f_executeTx = _f;
 }
 
-int TxDAG::executeUnit(Executive::Ptr _executive)
+int TxDAG::executeUnit(Executive::Ptr _executive, size_t _worker)
 {
-    // PARA_LOG(TRACE) << LOG_DESC("executeUnit") << LOG_KV("exeCnt", m_exeCnt)
+    // PARA_LOG(TRACE) << LOG_DESC("executeUnit") << LOG_KV("exeCnt", haveExecuteNumber())
     //              << LOG_KV("total", m_txs->size());
     int exeCnt = 0;
-    ID id = m_dag.waitPop();
+    ID id = m_dag.waitPop(_worker);
     while (id != INVALID_ID)
     {
         do
         {
             exeCnt += 1;
             f_executeTx((*m_txs)[id], id, _executive);
-            id = m_dag.consume(id);
+            id = m_dag.consume(id, _worker);
         } while (id != INVALID_ID);
-        id = m_dag.waitPop();
-    }
-    if (exeCnt > 0)
-    {
-        Guard l(x_exeCnt);
-        m_exeCnt += exeCnt;
+        id = m_dag.waitPop(_worker);
     }
     return exeCnt;
 }
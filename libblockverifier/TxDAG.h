@@ -47,8 +47,8 @@ public:
 
     // Called by thread
     // Execute a unit in DAG
-    // This function can be parallel
-    virtual int executeUnit(dev::executive::Executive::Ptr) = 0;
+    // This function can be parallel, every thread with its own _worker
+    virtual int executeUnit(dev::executive::Executive::Ptr, size_t _worker) = 0;
 
     virtual void getHaventRun(){};
 };
@@ -59,9 +59,9 @@ public:
     TxDAG() : m_dag() {}
     virtual ~TxDAG() {}
 
-    // Generate DAG according with given transactions
+    // Generate DAG according with given transactions, to be executed by _workerNum threads
     void init(ExecutiveContext::Ptr _ctx, std::shared_ptr<dev::eth::Transactions> _txs,
-        int64_t _blockHeight);
+        int64_t _blockHeight, size_t _workerNum = 1);
 
     // Set transaction execution function
     void setTxExecuteFunc(ExecuteTxFunc const& _f);
@@ -73,17 +73,25 @@ public:
     // directly
     bool hasFinished() override
     {
-        return (m_exeCnt >= m_totalParaTxs) || (g_BCOSConfig.shouldExit.load());
+        return m_dag.hasFinished() || (g_BCOSConfig.shouldExit.load());
     }
 
     // Called by thread
     // Execute a unit in DAG
-    // This function can be parallel
-    int executeUnit(dev::executive::Executive::Ptr _executive) override;
+    // This function can be parallel, _worker is in [0, _workerNum) given to init
+    int executeUnit(dev::executive::Executive::Ptr _executive, size_t _worker) override;
 
     ID paraTxsNumber() { return m_totalParaTxs; }
 
-    ID haveExecuteNumber() { return m_exeCnt; }
+    ID haveExecuteNumber() { return m_dag.consumedNumber(); }
+
+    /// the number of transactions on the longest dependency chain
+    ID criticalPath() const { return m_criticalPath; }
+    /// the transactions can be executed at the same time on average
+    double parallelism() const
+    {
+        return m_criticalPath == 0 ? 0 : (double)m_totalParaTxs / m_criticalPath;
+    }
 
 private:
     ExecuteTxFunc f_executeTx;
@@ -91,51 +99,8 @@ private:
 
     DAG m_dag;
 
-    ID m_exeCnt = 0;
     ID m_totalParaTxs = 0;
-
-    mutable std::mutex x_exeCnt;
-};
-
-template <typename T>
-class CriticalField
-{
-public:
-    ID get(T const& _c)
-    {
-        auto it = m_criticals.find(_c);
-        if (it == m_criticals.end())
-        {
-            if (m_criticalAll != INVALID_ID)
-                return m_criticalAll;
-            return INVALID_ID;
-        }
-        return it->second;
-    }
-
-    void update(T const& _c, ID _txId) { m_criticals[_c] = _txId; }
-
-    void foreachField(std::function<bool(std::pair<T, ID>)> const& _f)
-    {
-        for (auto _fieldAndId : m_criticals)
-        {
-            if (!_f(_fieldAndId))
-                break;
-        }
-
-        if (m_criticalAll != INVALID_ID)
-            _f(std::pair<T, ID>(T(), m_criticalAll));
-    }
-
-    void setCriticalAll(ID _id)
-    {
-        m_criticalAll = _id;
-        m_criticals.clear();
-    }
-
-private:
-    std::map<T, ID> m_criticals;
-    ID m_criticalAll = INVALID_ID;
+    ID m_criticalPath = 0;
 };
 
 }  // namespace blockverifier
@@ -39,6 +39,7 @@ enum VERSION : uint32_t
     V2_4_0 = 0x02040000,
     V2_5_0 = 0x02050000,
     V2_6_0 = 0x02060000,
+    V2_7_0 = 0x02070000,
 };
 
 enum ProtocolVersion : uint32_t
@@ -0,0 +1,79 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : model the TxDAG of the sealing block to pack transactions conflict-aware
+ * @file: ConflictPacker.cpp
+ */
+#include "ConflictPacker.h"
+#include <algorithm>
+
+using namespace dev::consensus;
+
+size_t ConflictPacker::level(Criticals const& _criticals) const
+{
+    // conflict with all the transactions touching any critical field
+    if (!_criticals)
+    {
+        return m_maxFieldLevel + 1;
+    }
+    size_t level = 0;
+    for (auto const& critical : *_criticals)
+    {
+        auto it = m_fieldLevels.find(critical);
+        level = std::max(level, it == m_fieldLevels.end() ? m_barrierLevel : it->second);
+    }
+    return level + 1;
+}
+
+bool ConflictPacker::tryPack(Criticals const& _criticals, bool _force)
+{
+    auto txLevel = level(_criticals);
+    if (txLevel > m_maxDepth && !_force)
+    {
+        return false;
+    }
+    if (_criticals)
+    {
+        for (auto const& critical : *_criticals)
+        {
+            m_fieldLevels[critical] = txLevel;
+        }
+        if (!_criticals->empty())
+        {
+            m_maxFieldLevel = std::max(m_maxFieldLevel, txLevel);
+        }
+    }
+    else
+    {
+        m_fieldLevels.clear();
+        m_barrierLevel = txLevel;
+        m_maxFieldLevel = txLevel;
+    }
+    m_criticalPath = std::max(m_criticalPath, txLevel);
+    ++m_packedTxs;
+    return true;
+}
+
+void ConflictPacker::reset(size_t _maxDepth)
+{
+    m_fieldLevels.clear();
+    m_barrierLevel = 0;
+    m_maxFieldLevel = 0;
+    m_criticalPath = 0;
+    m_packedTxs = 0;
+    m_maxDepth = std::max(_maxDepth, (size_t)1);
+}
@@ -0,0 +1,73 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : model the TxDAG of the sealing block to pack transactions conflict-aware
+ * @file: ConflictPacker.h
+ */
+#pragma once
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace dev
+{
+namespace consensus
+{
+/**
+ * @brief Tracks the level every transaction would take in the TxDAG built by the BlockVerifier
+ * for the sealing block, the level of the deepest transaction is the critical path of the block.
+ * A transaction with null criticals conflicts with all the others, the same as in TxDAG.
+ */
+class ConflictPacker
+{
+public:
+    using Ptr = std::shared_ptr<ConflictPacker>;
+    using Criticals = std::shared_ptr<std::vector<std::string>>;
+
+    /// @param _maxDepth: the transactions deepening the critical path over it are deferred
+    ConflictPacker(size_t _maxDepth) { reset(_maxDepth); }
+
+    /// the level the transaction would take if packed now, starts from 1
+    size_t level(Criticals const& _criticals) const;
+    /// pack the transaction if its level is within maxDepth or _force is true
+    /// @return true if the transaction is packed
+    bool tryPack(Criticals const& _criticals, bool _force = false);
+    void reset(size_t _maxDepth);
+
+    size_t criticalPath() const { return m_criticalPath; }
+    size_t packedTxs() const { return m_packedTxs; }
+    size_t maxDepth() const { return m_maxDepth; }
+    /// the transactions the TxDAG can execute at the same time on average
+    double parallelism() const
+    {
+        return m_criticalPath == 0 ? 0 : (double)m_packedTxs / m_criticalPath;
+    }
+
+private:
+    /// the level of the latest transaction touching the critical field
+    std::unordered_map<std::string, size_t> m_fieldLevels;
+    /// the level of the latest transaction conflicting with all, the default of unknown fields
+    size_t m_barrierLevel = 0;
+    /// max of m_barrierLevel and m_fieldLevels
+    size_t m_maxFieldLevel = 0;
+    size_t m_criticalPath = 0;
+    size_t m_packedTxs = 0;
+    size_t m_maxDepth = 1;
+};
+}  // namespace consensus
+}  // namespace dev
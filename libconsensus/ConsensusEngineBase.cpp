@@ -22,6 +22,8 @@
  * @date: 2018-09-28
  */
 #include "ConsensusEngineBase.h"
+#include <libconfig/GlobalConfigure.h>
+#include <libdevcrypto/SM2Signature.h>
 using namespace dev::eth;
 using namespace dev::db;
 using namespace dev::blockverifier;
@@ -52,6 +54,11 @@ void ConsensusEngineBase::stop()
     }
     ENGINE_LOG(INFO) << "[Stop ConsensusEngineBase]";
     m_startConsensusEngine = false;
+    if (g_BCOSConfig.SMCrypto())
+    {
+        // release the precomputed tables of the sealers only this group has
+        dev::sm2PrecomputePublicKeys(m_groupId, dev::h512s());
+    }
     doneWorking();
     if (isWorking())
     {
@@ -180,6 +187,11 @@ void ConsensusEngineBase::updateConsensusNodeList()
             for (dev::h512 node : m_sealerList)
                 s2 << node.abridged() << ",";
         }
+        // the signatures of the sealers are verified frequently by the consensus
+        if (m_sealerListUpdated && g_BCOSConfig.SMCrypto())
+        {
+            dev::sm2PrecomputePublicKeys(m_groupId, sealerList);
+        }
         s2 << "Observers:";
         dev::h512s observerList = m_blockChain->observerList();
         for (dev::h512 node : observerList)
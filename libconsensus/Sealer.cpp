@@ -128,6 +128,15 @@ void Sealer::doWork(bool wait)
                 m_signalled.wait_for(l, boost::chrono::milliseconds(1));
                 return;
             }
+            if (m_conflictPacker && shouldHandleBlock())
+            {
+                SEAL_LOG(DEBUG) << LOG_DESC("[conflictAwarePacking] seal block")
+                                << LOG_KV("sealingNum", m_sealing.block->blockHeader().number())
+                                << LOG_KV("txNum", m_sealing.block->getTransactionSize())
+                                << LOG_KV("criticalPath", m_conflictPacker->criticalPath())
+                                << LOG_KV("maxDepth", m_conflictPacker->maxDepth())
+                                << LOG_KV("expectedParallelism", m_conflictPacker->parallelism());
+            }
             if (shouldHandleBlock())
                 handleBlock();
         }
@@ -145,11 +154,75 @@ void Sealer::doWork(bool wait)
  */
 void Sealer::loadTransactions(uint64_t const& transToFetch)
 {
+    if (m_conflictPacker)
+    {
+        loadTransactionsConflictAware(transToFetch);
+        return;
+    }
     /// fetch transactions and update m_transactionSet
     m_sealing.block->appendTransactions(
         m_txPool->topTransactions(transToFetch, m_sealing.m_transactionSet, true));
 }
 
+/**
+ * @brief: load the transactions not deepening the critical path of the sealing block over
+ * maxDepth in import order, the transactions waited for m_maxPackingDelay are always loaded
+ * @param transToFetch: max transactions to fetch
+ */
+void Sealer::loadTransactionsConflictAware(uint64_t const& transToFetch)
+{
+    /// the deferred transactions are not added into m_transactionSet, retry them next time
+    auto candidates = m_txPool->topTransactions(
+        transToFetch * c_packingWindow, m_sealing.m_transactionSet, false);
+    if (candidates->empty())
+    {
+        return;
+    }
+    Transactions newCandidates;
+    for (auto const& tx : *candidates)
+    {
+        if (!m_txsCriticals.count(tx->sha3()))
+        {
+            newCandidates.push_back(tx);
+        }
+    }
+    if (!newCandidates.empty())
+    {
+        // only the header of the parent is required, which is cached without decoding the txs
+        auto parentHeaderInfo = m_blockChain->getBlockHeaderInfo(m_blockChain->number());
+        if (!parentHeaderInfo)
+        {
+            SEAL_LOG(WARNING) << LOG_DESC(
+                                     "loadTransactionsConflictAware: get parent header failed")
+                              << LOG_KV("number", m_blockChain->number());
+            return;
+        }
+        auto criticals =
+            m_blockVerifier->getTxsCriticals(*(parentHeaderInfo->first), newCandidates);
+        for (size_t i = 0; i < newCandidates.size(); ++i)
+        {
+            m_txsCriticals[newCandidates[i]->sha3()] = criticals[i];
+        }
+    }
+
+    auto loadedTxs = std::make_shared<Transactions>();
+    auto currentTime = u256(utcTime());
+    for (auto const& tx : *candidates)
+    {
+        if (loadedTxs->size() >= transToFetch)
+        {
+            break;
+        }
+        bool expired = (tx->importTime() + m_maxPackingDelay <= currentTime);
+        if (m_conflictPacker->tryPack(m_txsCriticals[tx->sha3()], expired))
+        {
+            loadedTxs->push_back(tx);
+            m_sealing.m_transactionSet.insert(tx->sha3());
+        }
+    }
+    m_sealing.block->appendTransactions(loadedTxs);
+}
+
 /// check whether the blocksync module is syncing
 bool Sealer::isBlockSyncing()
 {
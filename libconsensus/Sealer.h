@@ -27,6 +27,7 @@
  * @ modification: rename Consensus.h to Sealer.h
  */
 #pragma once
+#include "ConflictPacker.h"
 #include "ConsensusEngineBase.h"
 #include <libblockchain/BlockChainInterface.h>
 #include <libdevcore/Worker.h>
@@ -123,6 +124,20 @@ public:
         m_consensusEngine->setBlockFactory(_blockFactory);
     }
 
+    /**
+     * @brief pack the transactions according to their critical fields to shorten the critical
+     * path of the TxDAG, the transactions deepening the critical path are deferred to the next
+     * blocks until they have waited for _maxPackingDelay milliseconds in the transaction pool
+     * @param _blockVerifier: get the critical fields of the transactions
+     */
+    void enableConflictAwarePacking(
+        dev::blockverifier::BlockVerifierInterface::Ptr _blockVerifier, uint64_t _maxPackingDelay)
+    {
+        m_blockVerifier = _blockVerifier;
+        m_maxPackingDelay = _maxPackingDelay;
+        m_conflictPacker = std::make_shared<ConflictPacker>(maxPackingDepth());
+    }
+
 protected:
     void reportNewBlock();
     /// sealing block
@@ -130,6 +145,13 @@ protected:
     virtual bool shouldWait(bool const& wait) const;
     /// load transactions from transaction pool
     void loadTransactions(uint64_t const& transToFetch);
+    void loadTransactionsConflictAware(uint64_t const& transToFetch);
+    /// the critical path with which every thread of the TxDAG executes the same number of txs
+    size_t maxPackingDepth()
+    {
+        size_t threadNum = std::max(std::thread::hardware_concurrency(), (unsigned int)1);
+        return (maxBlockCanSeal() + threadNum - 1) / threadNum;
+    }
     virtual bool checkTxsEnough(uint64_t maxTxsCanSeal)
     {
         uint64_t tx_num = m_sealing.block->getTransactionSize();
@@ -158,6 +180,11 @@ protected:
                         << LOG_KV("sealingNum", m_sealing.block->blockHeader().number());
         m_blockSync->noteSealingBlockNumber(m_blockChain->number());
         resetSealingBlock(m_sealing, filter, resetNextLeader);
+        if (m_conflictPacker)
+        {
+            m_conflictPacker->reset(maxPackingDepth());
+            m_txsCriticals.clear();
+        }
     }
     /// reset the sealing block before loadTransactions
     void resetSealingBlock(
@@ -220,6 +247,16 @@ protected:
     /// the maximum transaction number that can be sealed in a block
     uint64_t m_maxBlockCanSeal = 1000;
     mutable SharedMutex x_maxBlockCanSeal;
+
+    /// conflict-aware packing, disabled if m_conflictPacker is null
+    dev::blockverifier::BlockVerifierInterface::Ptr m_blockVerifier;
+    ConflictPacker::Ptr m_conflictPacker;
+    /// the critical fields of the transactions considered for the sealing block
+    std::unordered_map<h256, ConflictPacker::Criticals> m_txsCriticals;
+    uint64_t m_maxPackingDelay = 1000;
+    /// consider at most c_packingWindow times of the transactions to fetch, so that a
+    /// transaction is never overtaken by too many later ones
+    static const uint64_t c_packingWindow = 4;
 };
 }  // namespace consensus
 }  // namespace dev
@@ -856,6 +856,7 @@ void PBFTEngine::execBlock(Sealing& sealing, PrepareReq::Ptr _req, std::ostrings
     record_time = utcTime();
     sealing.p_execContext = executeBlock(*sealing.block);
     auto exec_time_cost = utcTime() - record_time;
+    m_executeBlockMetric->observe(exec_time_cost);
     PBFTENGINE_LOG(INFO)
         << LOG_DESC("execBlock") << LOG_KV("blkNum", sealing.block->header().number())
         << LOG_KV("reqIdx", _req->idx) << LOG_KV("hash", sealing.block->header().hash().abridged())
@@ -1180,6 +1181,9 @@ void PBFTEngine::checkAndSave()
             /// drop handled transactions
             if (ret == CommitResult::OK)
             {
+                m_commitBlockMetric->observe(commitBlock_time_cost);
+                m_committedBlocksMetric->inc();
+                m_committedTxsMetric->inc(p_block->getTransactionSize());
                 dropHandledTransactions(p_block);
                 auto dropTxs_time_cost = utcTime() - record_time;
                 record_time = utcTime();
@@ -29,6 +29,7 @@
 #include "TimeManager.h"
 #include <libconsensus/ConsensusEngineBase.h>
 #include <libdevcore/FileSystem.h>
+#include <libdevcore/Metrics.h>
 #include <libdevcore/ThreadPool.h>
 #include <libdevcore/concurrent_queue.h>
 #include <libstorage/Storage.h>
@@ -79,21 +80,27 @@ public:
         /// register checkSealerList to blockSync for check SealerList
         m_blockSync->registerConsensusVerifyHandler(boost::bind(&PBFTEngine::checkBlock, this, _1));
 
-        m_threadPool =
-            std::make_shared<dev::ThreadPool>("pbftPool-" + std::to_string(m_groupId), 1);
+        m_threadPool = dev::createSerialWorker("pbftPool-" + std::to_string(m_groupId));
         m_broacastTargetsFilter = boost::bind(&PBFTEngine::getIndexBySealer, this, _1);
 
         m_consensusSet = std::make_shared<std::set<dev::h512>>();
 
-        m_messageHandler =
-            std::make_shared<dev::ThreadPool>("PBFTMsg-" + std::to_string(m_groupId), 1);
-        m_prepareWorker =
-            std::make_shared<dev::ThreadPool>("PBFTWork-" + std::to_string(m_groupId), 1);
+        m_messageHandler = dev::createSerialWorker("PBFTMsg-" + std::to_string(m_groupId));
+        m_prepareWorker = dev::createSerialWorker("PBFTWork-" + std::to_string(m_groupId));
 
-        m_destructorThread =
-            std::make_shared<dev::ThreadPool>("PBFTAsync-" + std::to_string(m_groupId), 1);
+        m_destructorThread = dev::createSerialWorker("PBFTAsync-" + std::to_string(m_groupId));
         m_cachedForwardMsg =
             std::make_shared<std::map<dev::h256, std::pair<int64_t, PBFTMsgPacket::Ptr>>>();
+
+        auto groupLabel = metrics::groupLabel(m_groupId);
+        m_executeBlockMetric = MetricsRegistry::instance().histogram(
+            "bcos_block_execute_ms", "time to execute a block in milliseconds", groupLabel);
+        m_commitBlockMetric = MetricsRegistry::instance().histogram(
+            "bcos_block_commit_ms", "time to commit a block in milliseconds", groupLabel);
+        m_committedBlocksMetric = MetricsRegistry::instance().counter(
+            "bcos_block_committed_total", "blocks committed by the consensus", groupLabel);
+        m_committedTxsMetric = MetricsRegistry::instance().counter(
+            "bcos_tx_committed_total", "transactions committed by the consensus", groupLabel);
     }
 
     void setBaseDir(std::string const& _path) { m_baseDir = _path; }
@@ -752,6 +759,11 @@ protected:
     // Make object destructive overhead asynchronous
     dev::ThreadPool::Ptr m_destructorThread;
     bool m_enablePrepareWithTxsHash = false;
+
+    MetricHistogram::Ptr m_executeBlockMetric;
+    MetricHistogram::Ptr m_commitBlockMetric;
+    MetricCounter::Ptr m_committedBlocksMetric;
+    MetricCounter::Ptr m_committedTxsMetric;
 };
 }  // namespace consensus
 }  // namespace dev
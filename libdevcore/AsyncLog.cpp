@@ -0,0 +1,337 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : asynchronous log backend, the records are passed to boost log on a background thread
+ * @file: AsyncLog.cpp
+ */
+#include "AsyncLog.h"
+#include "Common.h"
+#include <boost/date_time/c_local_time_adjustor.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/log/attributes/constant.hpp>
+#include <boost/log/attributes/mutable_constant.hpp>
+#include <boost/log/attributes/scoped_attribute.hpp>
+#include <boost/log/core.hpp>
+#include <algorithm>
+
+using namespace std;
+using namespace dev;
+
+namespace
+{
+const int64_t c_idleSleepMs = 2;
+const int64_t c_reportIntervalSeconds = 10;
+
+/// the message buffer reused by the records of a thread
+class LogBuffer : public std::streambuf
+{
+public:
+    LogBuffer() : stream(this) {}
+    void reset()
+    {
+        message.clear();
+        stream.clear();
+        stream.flags(std::ios_base::dec | std::ios_base::skipws);
+        stream.precision(6);
+        stream.width(0);
+        stream.fill(' ');
+    }
+
+    std::string message;
+    std::ostream stream;
+
+protected:
+    int_type overflow(int_type _c) override
+    {
+        if (!traits_type::eq_int_type(_c, traits_type::eof()))
+        {
+            message.push_back(traits_type::to_char_type(_c));
+        }
+        return traits_type::not_eof(_c);
+    }
+    std::streamsize xsputn(char const* _s, std::streamsize _n) override
+    {
+        message.append(_s, _n);
+        return _n;
+    }
+};
+
+// the buffers of the records being formatted on this thread, a record may be nested in the
+// arguments of another one
+thread_local std::vector<std::unique_ptr<LogBuffer>> t_logBuffers;
+thread_local size_t t_logDepth = 0;
+}  // namespace
+
+LogRecordStream::LogRecordStream(Logger& _logger, LogLevel _level)
+  : m_logger(_logger), m_level(_level)
+{
+    // the fatal log aborts in the sink, never dropped or delayed
+    if (m_level == LogLevel::FATAL || !AsyncLogger::instance().running())
+    {
+        // the same as BOOST_LOG_SEV, the record is skipped if filtered out
+        m_record = m_logger.open_record(
+            boost::log::keywords::severity = (boost::log::trivial::severity_level)m_level);
+        if (!m_record)
+        {
+            m_active = false;
+            return;
+        }
+        m_recordStream = StreamProvider::allocate_compound(m_record);
+        m_stream = &m_recordStream->stream.stream();
+        return;
+    }
+    if (t_logBuffers.size() <= t_logDepth)
+    {
+        t_logBuffers.emplace_back(new LogBuffer());
+    }
+    auto& buffer = *t_logBuffers[t_logDepth++];
+    buffer.reset();
+    m_stream = &buffer.stream;
+    m_message = &buffer.message;
+}
+
+LogRecordStream::~LogRecordStream()
+{
+    if (m_recordStream)
+    {
+        StreamProvider::release_compound(m_recordStream);
+    }
+    if (m_message)
+    {
+        t_logDepth--;
+    }
+}
+
+void LogRecordStream::commit()
+{
+    m_active = false;
+    if (m_message)
+    {
+        AsyncLogger::instance().push(m_logger, m_level, *m_message);
+        return;
+    }
+    m_logger.push_record(boost::move(m_recordStream->stream.get_record()));
+}
+
+/// the logger of the background thread, with the time of the caller instead of the current time
+class AsyncLogger::BackgroundLogger
+{
+public:
+    explicit BackgroundLogger(std::string const& _channel)
+      : logger(boost::log::keywords::channel = _channel),
+        timeStamp(boost::posix_time::ptime())
+    {
+        // the source-specific attribute takes precedence over the global TimeStamp
+        logger.add_attribute("TimeStamp", timeStamp);
+    }
+    Logger logger;
+    boost::log::attributes::mutable_constant<boost::posix_time::ptime> timeStamp;
+};
+
+AsyncLogger& AsyncLogger::instance()
+{
+    static AsyncLogger logger;
+    return logger;
+}
+
+void AsyncLogger::start(size_t _ringSize)
+{
+    if (m_running || _ringSize == 0)
+    {
+        return;
+    }
+    m_ringSize = 1;
+    while (m_ringSize < _ringSize)
+    {
+        m_ringSize <<= 1;
+    }
+    m_generation++;
+    m_lastReportTime = std::chrono::steady_clock::now();
+    m_running = true;
+    m_thread = std::make_shared<std::thread>([this]() {
+        dev::pthread_setThreadName("asyncLog");
+        workLoop();
+    });
+    LOG(INFO) << LOG_BADGE("AsyncLogger") << LOG_DESC("start") << LOG_KV("ringSize", m_ringSize);
+}
+
+void AsyncLogger::stop()
+{
+    if (!m_running)
+    {
+        return;
+    }
+    m_running = false;
+    // wait for the records being pushed by the callers that saw the logger running, they are
+    // drained below, the later records are written by the callers
+    std::vector<std::shared_ptr<LogRing>> rings;
+    {
+        std::lock_guard<std::mutex> l(x_rings);
+        rings = m_rings;
+    }
+    for (auto const& ring : rings)
+    {
+        while (ring->pushing)
+        {
+            std::this_thread::yield();
+        }
+    }
+    if (m_thread && m_thread->get_id() != std::this_thread::get_id())
+    {
+        m_thread->join();
+        // the records pushed after the last drain of the background thread
+        drain();
+    }
+    m_thread.reset();
+    std::lock_guard<std::mutex> l(x_rings);
+    m_rings.clear();
+}
+
+AsyncLogger::LogRing* AsyncLogger::threadRing()
+{
+    thread_local std::shared_ptr<LogRing> t_ring;
+    if (!t_ring || t_ring->generation != m_generation)
+    {
+        t_ring = std::make_shared<LogRing>(m_ringSize, m_generation);
+        std::lock_guard<std::mutex> l(x_rings);
+        m_rings.push_back(t_ring);
+    }
+    return t_ring.get();
+}
+
+bool AsyncLogger::push(Logger& _logger, LogLevel _level, std::string const& _message)
+{
+    auto ring = threadRing();
+    ring->pushing = true;
+    // stopped after the record started, stop() waits for the rings being pushed before the last
+    // drain, so the record is either drained or written here
+    if (!m_running)
+    {
+        ring->pushing = false;
+        BOOST_LOG_SEV(_logger, (boost::log::trivial::severity_level)_level) << _message;
+        return true;
+    }
+    auto tail = ring->tail.load(std::memory_order_relaxed);
+    if (tail - ring->head.load(std::memory_order_acquire) >= ring->entries.size())
+    {
+        ring->pushing = false;
+        m_droppedLogs++;
+        return false;
+    }
+    auto& entry = ring->entries[tail & (ring->entries.size() - 1)];
+    entry.logger = &_logger;
+    entry.level = _level;
+    entry.time = std::chrono::system_clock::now();
+    // assign to reuse the capacity of the entry
+    entry.groupId.assign(logGroupId());
+    entry.message.assign(_message);
+    ring->tail.store(tail + 1, std::memory_order_release);
+    ring->pushing = false;
+    return true;
+}
+
+size_t AsyncLogger::drain()
+{
+    std::vector<std::shared_ptr<LogRing>> rings;
+    {
+        std::lock_guard<std::mutex> l(x_rings);
+        // the ring of the exited thread is released after drained
+        m_rings.erase(std::remove_if(m_rings.begin(), m_rings.end(),
+                          [](std::shared_ptr<LogRing> const& _ring) {
+                              return _ring.use_count() == 1 &&
+                                     _ring->head.load() == _ring->tail.load();
+                          }),
+            m_rings.end());
+        rings = m_rings;
+    }
+    size_t written = 0;
+    for (auto const& ring : rings)
+    {
+        auto head = ring->head.load(std::memory_order_relaxed);
+        auto tail = ring->tail.load(std::memory_order_acquire);
+        for (; head < tail; ++head)
+        {
+            write(ring->entries[head & (ring->entries.size() - 1)]);
+            ring->head.store(head + 1, std::memory_order_release);
+            written++;
+        }
+    }
+    return written;
+}
+
+void AsyncLogger::write(LogEntry const& _entry)
+{
+    auto it = m_backgroundLoggers.find(_entry.logger);
+    if (it == m_backgroundLoggers.end())
+    {
+        it = m_backgroundLoggers
+                 .emplace(_entry.logger, std::make_shared<BackgroundLogger>(_entry.logger->channel()))
+                 .first;
+    }
+    auto& backgroundLogger = *it->second;
+    auto time = std::chrono::system_clock::to_time_t(_entry.time);
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+        _entry.time.time_since_epoch() % std::chrono::seconds(1))
+                  .count();
+    backgroundLogger.timeStamp.set(
+        boost::date_time::c_local_adjustor<boost::posix_time::ptime>::utc_to_local(
+            boost::posix_time::from_time_t(time) + boost::posix_time::microseconds(us)));
+    auto severity = (boost::log::trivial::severity_level)_entry.level;
+    if (_entry.groupId.empty())
+    {
+        BOOST_LOG_SEV(backgroundLogger.logger, severity) << _entry.message;
+        return;
+    }
+    BOOST_LOG_SCOPED_THREAD_ATTR(
+        "GroupId", boost::log::attributes::constant<std::string>(_entry.groupId));
+    BOOST_LOG_SEV(backgroundLogger.logger, severity) << _entry.message;
+}
+
+void AsyncLogger::reportDroppedLogs()
+{
+    auto now = std::chrono::steady_clock::now();
+    if (std::chrono::duration_cast<std::chrono::seconds>(now - m_lastReportTime).count() <
+        c_reportIntervalSeconds)
+    {
+        return;
+    }
+    m_lastReportTime = now;
+    uint64_t droppedLogs = m_droppedLogs;
+    if (droppedLogs == m_reportedDroppedLogs)
+    {
+        return;
+    }
+    BOOST_LOG_SEV(FileLoggerHandler, boost::log::trivial::warning)
+        << LOG_BADGE("AsyncLogger") << LOG_DESC("drop logs for the ring is full")
+        << LOG_KV("dropped", droppedLogs - m_reportedDroppedLogs)
+        << LOG_KV("totalDropped", droppedLogs);
+    m_reportedDroppedLogs = droppedLogs;
+}
+
+void AsyncLogger::workLoop()
+{
+    while (m_running)
+    {
+        if (drain() == 0)
+        {
+            reportDroppedLogs();
+            std::this_thread::sleep_for(std::chrono::milliseconds(c_idleSleepMs));
+        }
+    }
+    // write the records left
+    drain();
+}
@@ -0,0 +1,99 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : asynchronous log backend, the records are passed to boost log on a background thread
+ * @file: AsyncLog.h
+ */
+#pragma once
+#include "Log.h"
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dev
+{
+/**
+ * @brief Every thread writes the formatted records to its own single-producer single-consumer
+ * ring, the background thread takes them out and passes them to the boost log core and sinks, so
+ * that the callers never wait for the lock of the boost log core. The records are dropped and
+ * counted when the ring of the caller is full.
+ */
+class AsyncLogger
+{
+public:
+    static AsyncLogger& instance();
+    ~AsyncLogger() { stop(); }
+
+    /// @param _ringSize: the records can be buffered by every thread, rounded up to power of 2
+    void start(size_t _ringSize);
+    /// write the buffered records and the records being pushed, and stop the background thread
+    void stop();
+    bool running() const { return m_running; }
+
+    /// @return false if the ring of the current thread is full and the record is dropped
+    bool push(Logger& _logger, LogLevel _level, std::string const& _message);
+    uint64_t droppedLogs() const { return m_droppedLogs; }
+
+private:
+    struct LogEntry
+    {
+        Logger* logger = nullptr;
+        LogLevel level = LogLevel::INFO;
+        std::chrono::system_clock::time_point time;
+        std::string groupId;
+        std::string message;
+    };
+    struct LogRing
+    {
+        LogRing(size_t _size, uint64_t _generation) : entries(_size), generation(_generation) {}
+        std::vector<LogEntry> entries;
+        // the rings of the previous start are no longer drained
+        uint64_t generation;
+        // the next entry to read, written by the background thread
+        std::atomic<uint64_t> head = {0};
+        // the next entry to write, written by the owner thread
+        std::atomic<uint64_t> tail = {0};
+        // the owner thread is pushing a record
+        std::atomic_bool pushing = {false};
+    };
+    class BackgroundLogger;
+
+    LogRing* threadRing();
+    void workLoop();
+    size_t drain();
+    void write(LogEntry const& _entry);
+    void reportDroppedLogs();
+
+    std::atomic_bool m_running = {false};
+    size_t m_ringSize = 0;
+    std::atomic<uint64_t> m_generation = {0};
+    std::shared_ptr<std::thread> m_thread;
+
+    std::mutex x_rings;
+    std::vector<std::shared_ptr<LogRing>> m_rings;
+
+    std::atomic<uint64_t> m_droppedLogs = {0};
+    uint64_t m_reportedDroppedLogs = 0;
+    std::chrono::steady_clock::time_point m_lastReportTime;
+    // only accessed by the background thread
+    std::map<Logger const*, std::shared_ptr<BackgroundLogger>> m_backgroundLoggers;
+};
+}  // namespace dev
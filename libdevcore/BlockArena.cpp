@@ -0,0 +1,89 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : the monotonic arena of the short-lived objects created when executing a block
+ * @file: BlockArena.cpp
+ */
+#include "BlockArena.h"
+#include <cstdint>
+
+using namespace std;
+using namespace dev;
+
+void* BlockArena::allocate(size_t _size, size_t _alignment)
+{
+    auto& subArena = m_subArenas.local();
+    ++subArena.allocations;
+    subArena.allocatedBytes += _size;
+
+    // the large objects take their own chunks, so that the rest of the current chunk is kept
+    if (_size + _alignment > m_chunkSize / 4)
+    {
+        auto chunk = newChunk(subArena, _size + _alignment);
+        auto address = reinterpret_cast<uintptr_t>(chunk);
+        return chunk + ((_alignment - address % _alignment) % _alignment);
+    }
+    auto address = reinterpret_cast<uintptr_t>(subArena.cursor);
+    size_t padding = (_alignment - address % _alignment) % _alignment;
+    if (!subArena.cursor || (size_t)(subArena.end - subArena.cursor) < padding + _size)
+    {
+        subArena.cursor = newChunk(subArena, m_chunkSize);
+        subArena.end = subArena.cursor + m_chunkSize;
+        address = reinterpret_cast<uintptr_t>(subArena.cursor);
+        padding = (_alignment - address % _alignment) % _alignment;
+    }
+    auto memory = subArena.cursor + padding;
+    subArena.cursor = memory + _size;
+    return memory;
+}
+
+char* BlockArena::newChunk(SubArena& _subArena, size_t _size)
+{
+    _subArena.chunks.emplace_back(new char[_size]);
+    _subArena.reservedBytes += _size;
+    return _subArena.chunks.back().get();
+}
+
+size_t BlockArena::allocations() const
+{
+    size_t allocations = 0;
+    for (auto const& subArena : m_subArenas)
+    {
+        allocations += subArena.allocations;
+    }
+    return allocations;
+}
+
+size_t BlockArena::allocatedBytes() const
+{
+    size_t allocatedBytes = 0;
+    for (auto const& subArena : m_subArenas)
+    {
+        allocatedBytes += subArena.allocatedBytes;
+    }
+    return allocatedBytes;
+}
+
+size_t BlockArena::reservedBytes() const
+{
+    size_t reservedBytes = 0;
+    for (auto const& subArena : m_subArenas)
+    {
+        reservedBytes += subArena.reservedBytes;
+    }
+    return reservedBytes;
+}
@@ -0,0 +1,120 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : the monotonic arena of the short-lived objects created when executing a block
+ * @file: BlockArena.h
+ */
+#pragma once
+#include <tbb/enumerable_thread_specific.h>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace dev
+{
+/**
+ * @brief Hands out the memory of the objects that die with the executing block, e.g. the entries
+ * and the conditions of the tables. The memory is never freed one by one, the chunks are released
+ * together when the arena is destroyed. Every thread allocates from its own sub-arena without
+ * lock, so the workers of the parallel execution don't contend.
+ *
+ * The objects are created by makeShared, whose control block keeps the arena alive, so an object
+ * that outlives the block only delays the release of the arena instead of dangling.
+ */
+class BlockArena
+{
+public:
+    using Ptr = std::shared_ptr<BlockArena>;
+
+    static const size_t c_defaultChunkSize = 64 * 1024;
+
+    explicit BlockArena(size_t _chunkSize = c_defaultChunkSize) : m_chunkSize(_chunkSize) {}
+    BlockArena(BlockArena const&) = delete;
+    BlockArena& operator=(BlockArena const&) = delete;
+
+    void* allocate(size_t _size, size_t _alignment);
+
+    /// the number of the allocations and the bytes allocated by all the threads, called when no
+    /// thread is allocating
+    size_t allocations() const;
+    size_t allocatedBytes() const;
+    /// the bytes of the chunks held by the arena
+    size_t reservedBytes() const;
+
+private:
+    struct SubArena
+    {
+        std::vector<std::unique_ptr<char[]>> chunks;
+        char* cursor = nullptr;
+        char* end = nullptr;
+        size_t allocations = 0;
+        size_t allocatedBytes = 0;
+        size_t reservedBytes = 0;
+    };
+    char* newChunk(SubArena& _subArena, size_t _size);
+
+    size_t m_chunkSize;
+    tbb::enumerable_thread_specific<SubArena> m_subArenas;
+};
+
+/// the allocator keeps the arena alive, deallocate is a no-op
+template <typename T>
+class ArenaAllocator
+{
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(BlockArena::Ptr _arena) : m_arena(std::move(_arena)) {}
+    template <typename U>
+    ArenaAllocator(ArenaAllocator<U> const& _other) : m_arena(_other.arena())
+    {}
+
+    T* allocate(size_t _n)
+    {
+        return static_cast<T*>(m_arena->allocate(sizeof(T) * _n, alignof(T)));
+    }
+    void deallocate(T*, size_t) {}
+
+    BlockArena::Ptr const& arena() const { return m_arena; }
+
+private:
+    BlockArena::Ptr m_arena;
+};
+
+template <typename T, typename U>
+bool operator==(ArenaAllocator<T> const& _lhs, ArenaAllocator<U> const& _rhs)
+{
+    return _lhs.arena() == _rhs.arena();
+}
+
+template <typename T, typename U>
+bool operator!=(ArenaAllocator<T> const& _lhs, ArenaAllocator<U> const& _rhs)
+{
+    return !(_lhs == _rhs);
+}
+
+/// create the object in _arena, or by std::make_shared if _arena is null
+template <typename T, typename... Args>
+std::shared_ptr<T> makeShared(BlockArena::Ptr const& _arena, Args&&... _args)
+{
+    if (!_arena)
+    {
+        return std::make_shared<T>(std::forward<Args>(_args)...);
+    }
+    return std::allocate_shared<T>(ArenaAllocator<T>(_arena), std::forward<Args>(_args)...);
+}
+}  // namespace dev
@@ -0,0 +1,366 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : node-wide work-stealing executor and the serial strands on it
+ * @file: Executor.cpp
+ */
+#include "Executor.h"
+#include "Common.h"
+#include "Log.h"
+#include <pthread.h>
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/exception/diagnostic_information.hpp>
+#include <algorithm>
+
+using namespace std;
+using namespace dev;
+
+namespace
+{
+// the strand yields the thread after executing so many tasks
+const size_t c_maxStrandBatch = 32;
+const size_t c_invalidIndex = (size_t)-1;
+
+// the index of the executor thread, c_invalidIndex for the other threads
+thread_local size_t t_workerIndex = c_invalidIndex;
+// the strand running on this thread
+thread_local Strand const* t_currentStrand = nullptr;
+
+uint64_t elapsedUs(std::chrono::steady_clock::time_point const& _start)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - _start)
+        .count();
+}
+}  // namespace
+
+Strand::Strand(Executor& _executor, std::string const& _name)
+  : m_executor(_executor), m_name(_name)
+{
+    std::vector<std::string> fields;
+    boost::split(fields, m_name, boost::is_any_of("-"), boost::token_compress_on);
+    if (fields.size() > 1)
+    {
+        m_groupId = fields[1];
+    }
+    auto labels = "strand=\"" + m_name + "\"";
+    m_queueDepthMetric = MetricsRegistry::instance().gauge(
+        "bcos_executor_strand_queue_depth", "tasks waiting in the strand", labels);
+    m_executedTasksMetric = MetricsRegistry::instance().counter(
+        "bcos_executor_strand_tasks_total", "tasks executed by the strand", labels);
+    m_latencyMetric = MetricsRegistry::instance().histogram("bcos_executor_strand_latency_us",
+        "time between the task posted to the strand and started in microseconds", labels);
+}
+
+void Strand::post(Task _task)
+{
+    {
+        std::lock_guard<std::mutex> l(x_tasks);
+        if (m_stopped)
+        {
+            return;
+        }
+        m_tasks.push_back(PendingTask{std::move(_task), std::chrono::steady_clock::now()});
+        m_queueDepthMetric->add(1);
+        if (m_scheduled)
+        {
+            return;
+        }
+        m_scheduled = true;
+    }
+    auto self = shared_from_this();
+    m_executor.post([self]() { self->run(); });
+}
+
+void Strand::run()
+{
+    std::pair<boost::log::attribute_set::iterator, bool> groupAttribute;
+    bool hasGroupAttribute = false;
+    if (!m_groupId.empty() && boost::log::core::get())
+    {
+        groupAttribute = boost::log::core::get()->add_thread_attribute(
+            "GroupId", boost::log::attributes::constant<std::string>(m_groupId));
+        hasGroupAttribute = groupAttribute.second;
+    }
+    ScopedLogGroupId scopedGroupId(m_groupId);
+    t_currentStrand = this;
+    bool hasMore = false;
+    for (size_t i = 0; i < c_maxStrandBatch; ++i)
+    {
+        PendingTask pendingTask;
+        {
+            std::lock_guard<std::mutex> l(x_tasks);
+            if (m_tasks.empty() || m_stopped)
+            {
+                break;
+            }
+            pendingTask = std::move(m_tasks.front());
+            m_tasks.pop_front();
+            m_running = true;
+        }
+        m_queueDepthMetric->add(-1);
+        auto latency = elapsedUs(pendingTask.postTime);
+        m_latencyMetric->observe(latency);
+        m_totalLatencyUs += latency;
+        if (latency > m_maxLatencyUs)
+        {
+            m_maxLatencyUs = latency;
+        }
+        try
+        {
+            pendingTask.task();
+        }
+        catch (std::exception const& e)
+        {
+            LOG(ERROR) << LOG_BADGE("Strand") << LOG_DESC("task exception") << LOG_KV("name", m_name)
+                       << LOG_KV("EINFO", boost::diagnostic_information(e));
+        }
+        catch (...)
+        {
+            LOG(ERROR) << LOG_BADGE("Strand") << LOG_DESC("task unknown exception")
+                       << LOG_KV("name", m_name);
+        }
+        m_executedTasks++;
+        m_executedTasksMetric->inc();
+        {
+            std::lock_guard<std::mutex> l(x_tasks);
+            m_running = false;
+        }
+        m_runningCondition.notify_all();
+    }
+    t_currentStrand = nullptr;
+    if (hasGroupAttribute)
+    {
+        boost::log::core::get()->remove_thread_attribute(groupAttribute.first);
+    }
+    {
+        std::lock_guard<std::mutex> l(x_tasks);
+        hasMore = !m_tasks.empty() && !m_stopped;
+        m_scheduled = hasMore;
+    }
+    // requeue to the executor so that the other strands are not starved
+    if (hasMore)
+    {
+        auto self = shared_from_this();
+        m_executor.post([self]() { self->run(); });
+    }
+}
+
+void Strand::stop()
+{
+    std::unique_lock<std::mutex> l(x_tasks);
+    m_stopped = true;
+    m_queueDepthMetric->add(-(int64_t)m_tasks.size());
+    m_tasks.clear();
+    // stopped by the running task itself
+    if (t_currentStrand == this)
+    {
+        return;
+    }
+    m_runningCondition.wait(l, [this]() { return !m_running; });
+}
+
+StrandStatistics Strand::statistics()
+{
+    StrandStatistics statistics;
+    statistics.name = m_name;
+    {
+        std::lock_guard<std::mutex> l(x_tasks);
+        statistics.queueDepth = m_tasks.size();
+    }
+    statistics.executedTasks = m_executedTasks;
+    statistics.averageLatencyUs =
+        statistics.executedTasks > 0 ? m_totalLatencyUs / statistics.executedTasks : 0;
+    statistics.maxLatencyUs = m_maxLatencyUs;
+    return statistics;
+}
+
+Executor& Executor::instance()
+{
+    static Executor executor;
+    return executor;
+}
+
+void Executor::start(size_t _threadNum, std::vector<int> const& _cpus)
+{
+    if (m_running || _threadNum == 0)
+    {
+        return;
+    }
+    m_running = true;
+    for (size_t i = 0; i < _threadNum; ++i)
+    {
+        m_queues.push_back(std::make_shared<TaskQueue>());
+    }
+    for (size_t i = 0; i < _threadNum; ++i)
+    {
+        auto thread = std::make_shared<std::thread>([this, i]() {
+            dev::pthread_setThreadName("executor-" + std::to_string(i));
+            workLoop(i);
+        });
+#if defined(__linux__)
+        if (!_cpus.empty())
+        {
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            CPU_SET(_cpus[i % _cpus.size()], &cpuSet);
+            if (pthread_setaffinity_np(thread->native_handle(), sizeof(cpu_set_t), &cpuSet) != 0)
+            {
+                LOG(WARNING) << LOG_BADGE("Executor") << LOG_DESC("set cpu affinity failed")
+                             << LOG_KV("cpu", _cpus[i % _cpus.size()]);
+            }
+        }
+#endif
+        m_threads.push_back(thread);
+    }
+    LOG(INFO) << LOG_BADGE("Executor") << LOG_DESC("start") << LOG_KV("threadNum", _threadNum)
+              << LOG_KV("cpus", _cpus.size());
+}
+
+void Executor::stop()
+{
+    if (!m_running)
+    {
+        return;
+    }
+    {
+        // the workers check m_running under x_idle before waiting
+        std::lock_guard<std::mutex> l(x_idle);
+        m_running = false;
+    }
+    m_idleCondition.notify_all();
+    for (auto& thread : m_threads)
+    {
+        if (thread->get_id() != std::this_thread::get_id())
+        {
+            thread->join();
+        }
+        else
+        {
+            thread->detach();
+        }
+    }
+    m_threads.clear();
+}
+
+void Executor::post(Task _task)
+{
+    if (!m_running || m_queues.empty())
+    {
+        return;
+    }
+    // the threads of the executor push to their own queues, the others push in turn
+    size_t index = t_workerIndex;
+    if (index == c_invalidIndex || index >= m_queues.size())
+    {
+        index = m_nextQueue++ % m_queues.size();
+    }
+    {
+        std::lock_guard<std::mutex> l(m_queues[index]->lock);
+        m_queues[index]->tasks.push_back(std::move(_task));
+    }
+    {
+        // a worker checks m_pendingTasks and then waits under x_idle, change it under x_idle
+        // or the notification may be lost between them
+        std::lock_guard<std::mutex> l(x_idle);
+        m_pendingTasks++;
+    }
+    m_pendingTasksMetric->add(1);
+    m_idleCondition.notify_one();
+}
+
+bool Executor::popTask(size_t _index, Task& _task)
+{
+    // the own queue first, in the order of posting
+    {
+        auto& queue = *m_queues[_index];
+        std::lock_guard<std::mutex> l(queue.lock);
+        if (!queue.tasks.empty())
+        {
+            _task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            return true;
+        }
+    }
+    // steal from the tail of the others
+    for (size_t i = 1; i < m_queues.size(); ++i)
+    {
+        auto& queue = *m_queues[(_index + i) % m_queues.size()];
+        std::lock_guard<std::mutex> l(queue.lock);
+        if (!queue.tasks.empty())
+        {
+            _task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+void Executor::workLoop(size_t _index)
+{
+    t_workerIndex = _index;
+    while (m_running)
+    {
+        Task task;
+        if (popTask(_index, task))
+        {
+            m_pendingTasks--;
+            m_pendingTasksMetric->add(-1);
+            task();
+            continue;
+        }
+        std::unique_lock<std::mutex> l(x_idle);
+        m_idleCondition.wait_for(l, std::chrono::milliseconds(100),
+            [this]() { return !m_running || m_pendingTasks > 0; });
+    }
+}
+
+Strand::Ptr Executor::createStrand(std::string const& _name)
+{
+    auto strand = std::make_shared<Strand>(*this, _name);
+    Guard l(x_strands);
+    // remove the released strands
+    m_strands.erase(std::remove_if(m_strands.begin(), m_strands.end(),
+                        [](std::weak_ptr<Strand> const& _strand) { return _strand.expired(); }),
+        m_strands.end());
+    m_strands.push_back(strand);
+    return strand;
+}
+
+std::vector<StrandStatistics> Executor::strandStatistics()
+{
+    std::vector<Strand::Ptr> strands;
+    {
+        Guard l(x_strands);
+        for (auto const& weakStrand : m_strands)
+        {
+            auto strand = weakStrand.lock();
+            if (strand)
+            {
+                strands.push_back(strand);
+            }
+        }
+    }
+    std::vector<StrandStatistics> statistics;
+    for (auto const& strand : strands)
+    {
+        statistics.push_back(strand->statistics());
+    }
+    return statistics;
+}
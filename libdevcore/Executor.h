@@ -0,0 +1,145 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : node-wide work-stealing executor and the serial strands on it
+ * @file: Executor.h
+ */
+#pragma once
+#include "Guards.h"
+#include "Metrics.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace dev
+{
+class Executor;
+
+/// queue depth and latency of a strand
+struct StrandStatistics
+{
+    std::string name;
+    size_t queueDepth = 0;
+    uint64_t executedTasks = 0;
+    // the latency between the task posted and the task started
+    uint64_t averageLatencyUs = 0;
+    uint64_t maxLatencyUs = 0;
+};
+
+/**
+ * @brief The tasks posted to the same strand are executed one by one in the order of posting, on
+ * any thread of the executor, the same as the dev::ThreadPool with one thread.
+ */
+class Strand : public std::enable_shared_from_this<Strand>
+{
+public:
+    using Ptr = std::shared_ptr<Strand>;
+    using Task = std::function<void()>;
+    Strand(Executor& _executor, std::string const& _name);
+
+    void post(Task _task);
+    // drop the pending tasks and wait for the running task
+    void stop();
+
+    std::string const& name() const { return m_name; }
+    StrandStatistics statistics();
+
+private:
+    struct PendingTask
+    {
+        Task task;
+        std::chrono::steady_clock::time_point postTime;
+    };
+    void run();
+
+    Executor& m_executor;
+    std::string m_name;
+    std::string m_groupId;
+
+    std::mutex x_tasks;
+    std::condition_variable m_runningCondition;
+    std::deque<PendingTask> m_tasks;
+    // the strand is in the queue of the executor or running
+    bool m_scheduled = false;
+    bool m_running = false;
+    bool m_stopped = false;
+
+    std::atomic<uint64_t> m_executedTasks = {0};
+    std::atomic<uint64_t> m_totalLatencyUs = {0};
+    std::atomic<uint64_t> m_maxLatencyUs = {0};
+
+    // shared by the strands of the same name, e.g. the strand of the restarted group
+    MetricGauge::Ptr m_queueDepthMetric;
+    MetricCounter::Ptr m_executedTasksMetric;
+    MetricHistogram::Ptr m_latencyMetric;
+};
+
+/**
+ * @brief Node-wide thread pool shared by all the groups. Every thread has its own task queue, the
+ * idle threads steal the tasks from the others, so that the dozens of groups no longer need
+ * hundreds of mostly idle threads.
+ */
+class Executor
+{
+public:
+    using Task = std::function<void()>;
+    static Executor& instance();
+    ~Executor() { stop(); }
+
+    /**
+     * @brief start the threads, does nothing if started
+     * @param _threadNum: the number of the threads
+     * @param _cpus: the threads are bound to these cpus in turn if not empty, e.g. the cpus of
+     * one NUMA node
+     */
+    void start(size_t _threadNum, std::vector<int> const& _cpus = std::vector<int>());
+    void stop();
+    bool running() const { return m_running; }
+    size_t threadNum() const { return m_queues.size(); }
+
+    void post(Task _task);
+    Strand::Ptr createStrand(std::string const& _name);
+
+    std::vector<StrandStatistics> strandStatistics();
+
+private:
+    struct TaskQueue
+    {
+        std::mutex lock;
+        std::deque<Task> tasks;
+    };
+    void workLoop(size_t _index);
+    bool popTask(size_t _index, Task& _task);
+
+    std::atomic_bool m_running = {false};
+    std::vector<std::shared_ptr<TaskQueue>> m_queues;
+    std::vector<std::shared_ptr<std::thread>> m_threads;
+    std::atomic<size_t> m_nextQueue = {0};
+    std::atomic<int64_t> m_pendingTasks = {0};
+    MetricGauge::Ptr m_pendingTasksMetric = MetricsRegistry::instance().gauge(
+        "bcos_executor_pending_tasks", "tasks waiting for the threads of the executor");
+    std::mutex x_idle;
+    std::condition_variable m_idleCondition;
+
+    Mutex x_strands;
+    std::vector<std::weak_ptr<Strand>> m_strands;
+};
+}  // namespace dev
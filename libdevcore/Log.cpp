@@ -45,4 +45,19 @@ void setStatLogLevel(LogLevel const& _level)
 {
     c_statLogLevel = _level;
 }
+
+namespace
+{
+thread_local std::string t_logGroupId;
+}
+
+void setLogGroupId(std::string const& _groupId)
+{
+    t_logGroupId = _groupId;
+}
+
+std::string const& logGroupId()
+{
+    return t_logGroupId;
+}
 }  // namespace dev
\ No newline at end of file
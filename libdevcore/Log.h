@@ -24,8 +24,10 @@
 
 #include <boost/log/attributes/constant.hpp>
 #include <boost/log/attributes/scoped_attribute.hpp>
+#include <boost/log/sources/record_ostream.hpp>
 #include <boost/log/sources/severity_channel_logger.hpp>
 #include <boost/log/trivial.hpp>
+#include <ostream>
 
 // BCOS log format
 #define LOG_BADGE(_NAME) "[" << (_NAME) << "]"
@@ -63,13 +65,66 @@ extern LogLevel c_statLogLevel;
 void setFileLogLevel(LogLevel const& _level);
 void setStatLogLevel(LogLevel const& _level);
 
-#define LOG(level)                                   \
-    if (dev::LogLevel::level >= dev::c_fileLogLevel) \
-    BOOST_LOG_SEV(dev::FileLoggerHandler,            \
-        (boost::log::v2s_mt_posix::trivial::severity_level)(dev::LogLevel::level))
+using Logger = boost::log::sources::severity_channel_logger_mt<boost::log::trivial::severity_level,
+    std::string>;
 
-#define STAT_LOG(level)                              \
-    if (dev::LogLevel::level >= dev::c_statLogLevel) \
-    BOOST_LOG_SEV(dev::StatFileLoggerHandler,        \
-        (boost::log::v2s_mt_posix::trivial::severity_level)(dev::LogLevel::level))
+/// the group id of the logs of the current thread, the same as the GroupId thread attribute, the
+/// asynchronous logger reads it on the caller thread
+void setLogGroupId(std::string const& _groupId);
+std::string const& logGroupId();
+
+/// set the group id of the logs in the scope
+class ScopedLogGroupId
+{
+public:
+    explicit ScopedLogGroupId(std::string const& _groupId) : m_groupId(logGroupId())
+    {
+        setLogGroupId(_groupId);
+    }
+    ~ScopedLogGroupId() { setLogGroupId(m_groupId); }
+
+private:
+    std::string m_groupId;
+};
+
+/**
+ * @brief: one log record, the message is formatted into a buffer of the caller thread and then
+ * passed to the AsyncLogger if started, or formatted into the boost log record directly as
+ * BOOST_LOG_SEV does
+ */
+class LogRecordStream
+{
+public:
+    LogRecordStream(Logger& _logger, LogLevel _level);
+    ~LogRecordStream();
+
+    bool active() const { return m_active; }
+    std::ostream& stream() { return *m_stream; }
+    void commit();
+
+private:
+    using StreamProvider = boost::log::aux::stream_provider<char>;
+
+    Logger& m_logger;
+    LogLevel m_level;
+    bool m_active = true;
+    std::ostream* m_stream = nullptr;
+    // the buffer of the asynchronous record
+    std::string* m_message = nullptr;
+    // the boost log record of the synchronous record
+    boost::log::record m_record;
+    StreamProvider::stream_compound* m_recordStream = nullptr;
+};
+
+#define LOG(level)                                                                          \
+    if (dev::LogLevel::level >= dev::c_fileLogLevel)                                        \
+        for (dev::LogRecordStream _logRecord(dev::FileLoggerHandler, dev::LogLevel::level); \
+             _logRecord.active(); _logRecord.commit())                                      \
+    _logRecord.stream()
+
+#define STAT_LOG(level)                                                                         \
+    if (dev::LogLevel::level >= dev::c_statLogLevel)                                            \
+        for (dev::LogRecordStream _logRecord(dev::StatFileLoggerHandler, dev::LogLevel::level); \
+             _logRecord.active(); _logRecord.commit())                                          \
+    _logRecord.stream()
 }  // namespace dev
@@ -0,0 +1,239 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : in-process counters, gauges and histograms, exported in the Prometheus text format
+ * @file: Metrics.cpp
+ */
+#include "Metrics.h"
+#include <sstream>
+
+using namespace std;
+using namespace dev;
+using namespace dev::metrics;
+
+namespace
+{
+const std::vector<std::pair<double, std::string>> c_quantiles = {
+    {0.5, "0.5"}, {0.9, "0.9"}, {0.99, "0.99"}, {0.999, "0.999"}};
+
+std::atomic<size_t> g_nextShard = {0};
+
+/// name{labels} or name{labels,extra}
+std::string metricName(
+    std::string const& _name, std::string const& _labels, std::string const& _extra = "")
+{
+    if (_labels.empty() && _extra.empty())
+    {
+        return _name;
+    }
+    if (_labels.empty() || _extra.empty())
+    {
+        return _name + "{" + _labels + _extra + "}";
+    }
+    return _name + "{" + _labels + "," + _extra + "}";
+}
+}  // namespace
+
+size_t dev::metrics::threadShard()
+{
+    thread_local size_t t_shard = g_nextShard++;
+    return t_shard;
+}
+
+uint64_t MetricCounter::value() const
+{
+    uint64_t value = 0;
+    for (auto const& shard : m_shards)
+    {
+        value += shard.value.load(std::memory_order_relaxed);
+    }
+    return value;
+}
+
+size_t MetricHistogram::bucketIndex(uint64_t _value)
+{
+    if (_value < (1u << c_histogramSubBucketBits))
+    {
+        return _value;
+    }
+    size_t highestBit = 63 - __builtin_clzll(_value);
+    if (highestBit > c_histogramMaxBits)
+    {
+        return c_histogramBuckets - 1;
+    }
+    size_t subBucket = (_value >> (highestBit - c_histogramSubBucketBits)) &
+                       ((1u << c_histogramSubBucketBits) - 1);
+    return ((highestBit - c_histogramSubBucketBits + 1) << c_histogramSubBucketBits) + subBucket;
+}
+
+uint64_t MetricHistogram::bucketUpperBound(size_t _index)
+{
+    if (_index < (1u << c_histogramSubBucketBits))
+    {
+        return _index;
+    }
+    size_t highestBit = (_index >> c_histogramSubBucketBits) + c_histogramSubBucketBits - 1;
+    uint64_t subBucket = _index & ((1u << c_histogramSubBucketBits) - 1);
+    uint64_t width = uint64_t(1) << (highestBit - c_histogramSubBucketBits);
+    return (((uint64_t(1) << c_histogramSubBucketBits) + subBucket) * width) + width - 1;
+}
+
+MetricHistogram::Snapshot MetricHistogram::snapshot() const
+{
+    Snapshot snapshot;
+    snapshot.buckets.resize(c_histogramBuckets, 0);
+    for (auto const& shard : m_shards)
+    {
+        for (size_t i = 0; i < c_histogramBuckets; ++i)
+        {
+            auto count = shard.buckets[i].load(std::memory_order_relaxed);
+            snapshot.buckets[i] += count;
+            snapshot.count += count;
+        }
+        snapshot.sum += shard.sum.load(std::memory_order_relaxed);
+    }
+    return snapshot;
+}
+
+uint64_t MetricHistogram::Snapshot::quantile(double _quantile) const
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+    // the rank of the quantile, starts from 1
+    uint64_t rank = std::max<uint64_t>(1, (uint64_t)(_quantile * count + 0.5));
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < buckets.size(); ++i)
+    {
+        accumulated += buckets[i];
+        if (accumulated >= rank)
+        {
+            return bucketUpperBound(i);
+        }
+    }
+    return bucketUpperBound(buckets.size() - 1);
+}
+
+MetricsRegistry& MetricsRegistry::instance()
+{
+    static MetricsRegistry registry;
+    return registry;
+}
+
+MetricsRegistry::MetricFamily& MetricsRegistry::family(
+    std::string const& _name, std::string const& _help, MetricType _type)
+{
+    auto it = m_families.find(_name);
+    if (it == m_families.end())
+    {
+        MetricFamily family;
+        family.type = _type;
+        family.help = _help;
+        it = m_families.emplace(_name, std::move(family)).first;
+    }
+    if (it->second.type != _type)
+    {
+        BOOST_THROW_EXCEPTION(
+            InvalidMetric() << errinfo_comment("metric " + _name + " registered with another type"));
+    }
+    return it->second;
+}
+
+MetricCounter::Ptr MetricsRegistry::counter(
+    std::string const& _name, std::string const& _help, std::string const& _labels)
+{
+    Guard l(x_families);
+    auto& counter = family(_name, _help, MetricType::Counter).counters[_labels];
+    if (!counter)
+    {
+        counter = std::make_shared<MetricCounter>();
+    }
+    return counter;
+}
+
+MetricGauge::Ptr MetricsRegistry::gauge(
+    std::string const& _name, std::string const& _help, std::string const& _labels)
+{
+    Guard l(x_families);
+    auto& gauge = family(_name, _help, MetricType::Gauge).gauges[_labels];
+    if (!gauge)
+    {
+        gauge = std::make_shared<MetricGauge>();
+    }
+    return gauge;
+}
+
+MetricHistogram::Ptr MetricsRegistry::histogram(
+    std::string const& _name, std::string const& _help, std::string const& _labels)
+{
+    Guard l(x_families);
+    auto& histogram = family(_name, _help, MetricType::Histogram).histograms[_labels];
+    if (!histogram)
+    {
+        histogram = std::make_shared<MetricHistogram>();
+    }
+    return histogram;
+}
+
+std::string MetricsRegistry::prometheusText()
+{
+    std::ostringstream output;
+    Guard l(x_families);
+    for (auto const& item : m_families)
+    {
+        auto const& name = item.first;
+        auto const& family = item.second;
+        output << "# HELP " << name << " " << family.help << "\n";
+        switch (family.type)
+        {
+        case MetricType::Counter:
+            output << "# TYPE " << name << " counter\n";
+            for (auto const& counter : family.counters)
+            {
+                output << metricName(name, counter.first) << " " << counter.second->value()
+                       << "\n";
+            }
+            break;
+        case MetricType::Gauge:
+            output << "# TYPE " << name << " gauge\n";
+            for (auto const& gauge : family.gauges)
+            {
+                output << metricName(name, gauge.first) << " " << gauge.second->value() << "\n";
+            }
+            break;
+        case MetricType::Histogram:
+            output << "# TYPE " << name << " summary\n";
+            for (auto const& histogram : family.histograms)
+            {
+                auto snapshot = histogram.second->snapshot();
+                for (auto const& quantile : c_quantiles)
+                {
+                    output << metricName(name, histogram.first,
+                                  "quantile=\"" + quantile.second + "\"")
+                           << " " << snapshot.quantile(quantile.first) << "\n";
+                }
+                output << metricName(name + "_sum", histogram.first) << " " << snapshot.sum
+                       << "\n";
+                output << metricName(name + "_count", histogram.first) << " " << snapshot.count
+                       << "\n";
+            }
+            break;
+        }
+    }
+    return output.str();
+}
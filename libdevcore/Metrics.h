@@ -0,0 +1,188 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : in-process counters, gauges and histograms, exported in the Prometheus text format
+ * @file: Metrics.h
+ */
+#pragma once
+#include "Exceptions.h"
+#include "Guards.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace dev
+{
+DEV_SIMPLE_EXCEPTION(InvalidMetric);
+
+namespace metrics
+{
+// the counters are updated by many threads, every thread updates its own shard
+const size_t c_counterShards = 16;
+const size_t c_histogramShards = 4;
+// the values less than 8 have their own buckets, the larger values are bucketed by the highest
+// bit and the next 3 bits, the relative error of the quantiles is at most 12.5%
+const size_t c_histogramSubBucketBits = 3;
+const size_t c_histogramMaxBits = 40;
+const size_t c_histogramBuckets =
+    (c_histogramMaxBits - c_histogramSubBucketBits + 2) << c_histogramSubBucketBits;
+
+/// the shard of the current thread
+size_t threadShard();
+
+/// the labels of the metrics of a group, e.g. group="1"
+inline std::string groupLabel(int64_t _groupId)
+{
+    return "group=\"" + std::to_string(_groupId) + "\"";
+}
+}  // namespace metrics
+
+/// monotonically increasing value
+class MetricCounter
+{
+public:
+    using Ptr = std::shared_ptr<MetricCounter>;
+    void inc(uint64_t _value = 1)
+    {
+        m_shards[metrics::threadShard() % metrics::c_counterShards].value.fetch_add(
+            _value, std::memory_order_relaxed);
+    }
+    uint64_t value() const;
+
+private:
+    struct alignas(64) Shard
+    {
+        std::atomic<uint64_t> value = {0};
+    };
+    std::array<Shard, metrics::c_counterShards> m_shards;
+};
+
+/// the value can go up and down, e.g. the size of a queue
+class MetricGauge
+{
+public:
+    using Ptr = std::shared_ptr<MetricGauge>;
+    void set(int64_t _value) { m_value.store(_value, std::memory_order_relaxed); }
+    void add(int64_t _value) { m_value.fetch_add(_value, std::memory_order_relaxed); }
+    int64_t value() const { return m_value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> m_value = {0};
+};
+
+/// the distribution of the values, e.g. the latency, in the log-linear buckets of HDR histogram
+class MetricHistogram
+{
+public:
+    using Ptr = std::shared_ptr<MetricHistogram>;
+    struct Snapshot
+    {
+        uint64_t count = 0;
+        uint64_t sum = 0;
+        std::vector<uint64_t> buckets;
+        /// @return the upper bound of the bucket of the quantile, 0 if no value
+        uint64_t quantile(double _quantile) const;
+    };
+
+    void observe(uint64_t _value)
+    {
+        auto& shard = m_shards[metrics::threadShard() % metrics::c_histogramShards];
+        shard.buckets[bucketIndex(_value)].fetch_add(1, std::memory_order_relaxed);
+        shard.sum.fetch_add(_value, std::memory_order_relaxed);
+    }
+    Snapshot snapshot() const;
+
+    static size_t bucketIndex(uint64_t _value);
+    static uint64_t bucketUpperBound(size_t _index);
+
+private:
+    struct alignas(64) Shard
+    {
+        std::array<std::atomic<uint64_t>, metrics::c_histogramBuckets> buckets = {};
+        std::atomic<uint64_t> sum = {0};
+    };
+    std::array<Shard, metrics::c_histogramShards> m_shards;
+};
+
+/// observe the time elapsed in the scope, in microseconds
+class ScopedMetricTimer
+{
+public:
+    explicit ScopedMetricTimer(MetricHistogram::Ptr _histogram)
+      : m_histogram(_histogram), m_start(std::chrono::steady_clock::now())
+    {}
+    ~ScopedMetricTimer()
+    {
+        if (m_histogram)
+        {
+            m_histogram->observe(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - m_start)
+                                     .count());
+        }
+    }
+
+private:
+    MetricHistogram::Ptr m_histogram;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+/**
+ * @brief All the metrics of the node. The metrics are created once by the modules and updated
+ * without lock, the same name and labels always return the same metric, so that the restarted
+ * group continues the values.
+ */
+class MetricsRegistry
+{
+public:
+    static MetricsRegistry& instance();
+
+    MetricCounter::Ptr counter(
+        std::string const& _name, std::string const& _help, std::string const& _labels = "");
+    MetricGauge::Ptr gauge(
+        std::string const& _name, std::string const& _help, std::string const& _labels = "");
+    /// exported as the summary with the quantiles 0.5, 0.9, 0.99 and 0.999
+    MetricHistogram::Ptr histogram(
+        std::string const& _name, std::string const& _help, std::string const& _labels = "");
+
+    /// all the metrics in the Prometheus text exposition format
+    std::string prometheusText();
+
+private:
+    enum class MetricType
+    {
+        Counter,
+        Gauge,
+        Histogram
+    };
+    struct MetricFamily
+    {
+        MetricType type;
+        std::string help;
+        std::map<std::string, std::shared_ptr<MetricCounter>> counters;
+        std::map<std::string, std::shared_ptr<MetricGauge>> gauges;
+        std::map<std::string, std::shared_ptr<MetricHistogram>> histograms;
+    };
+    MetricFamily& family(std::string const& _name, std::string const& _help, MetricType _type);
+
+    Mutex x_families;
+    std::map<std::string, MetricFamily> m_families;
+};
+}  // namespace dev
@@ -25,6 +25,7 @@
 
 #pragma once
 #include "Common.h"
+#include "Executor.h"
 #include "Log.h"
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/split.hpp>
@@ -58,14 +59,24 @@ public:
                 {
                     boost::log::core::get()->add_thread_attribute(
                         "GroupId", boost::log::attributes::constant<std::string>((*fields)[1]));
+                    setLogGroupId((*fields)[1]);
                 }
                 dev::pthread_setThreadName(_threadName);
                 _ioService.run();
             });
         }
     }
+    // the serial worker without its own thread, the tasks are executed by the shared executor
+    ThreadPool(const std::string& threadName, Strand::Ptr _strand)
+      : _threadName(threadName), m_work(_ioService), m_strand(_strand)
+    {}
+
     void stop()
     {
+        if (m_strand)
+        {
+            m_strand->stop();
+        }
         _ioService.stop();
         if (!_workers.is_this_thread_in())
         {
@@ -79,6 +90,11 @@ public:
     template <class F>
     void enqueue(F f)
     {
+        if (m_strand)
+        {
+            m_strand->post(f);
+            return;
+        }
         _ioService.post(f);
     }
 
@@ -88,6 +104,19 @@ private:
     boost::asio::io_service _ioService;
     // m_work ensures that io_service's run() function will not exit while work is underway
     boost::asio::io_service::work m_work;
+    Strand::Ptr m_strand;
 };
 
+/// create the worker executing the tasks one by one in order, it is a strand of the shared
+/// executor if the executor is running, otherwise a ThreadPool with one thread
+inline ThreadPool::Ptr createSerialWorker(std::string const& _threadName)
+{
+    if (Executor::instance().running())
+    {
+        return std::make_shared<ThreadPool>(
+            _threadName, Executor::instance().createStrand(_threadName));
+    }
+    return std::make_shared<ThreadPool>(_threadName, 1);
+}
+
 }  // namespace dev
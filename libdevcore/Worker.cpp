@@ -60,6 +60,7 @@ void Worker::startWorking()
                 {
                     boost::log::core::get()->add_thread_attribute(
                         "GroupId", boost::log::attributes::constant<std::string>(fields[1]));
+                    setLogGroupId(fields[1]);
                 }
             }
             setThreadName(m_name.c_str());
@@ -36,6 +36,7 @@
 #include <secp256k1.h>
 #include <secp256k1_recovery.h>
 #include <secp256k1_sha256.h>
+#include <tbb/parallel_for.h>
 #include <mutex>
 
 using namespace std;
@@ -106,10 +107,43 @@ bool dev::sm2Verify(h512 const& _p, std::shared_ptr<crypto::Signature> _s, h256
     {
         return false;
     }
-    auto signData = _s->asBytes();
-    bool lresult = SM2::getInstance().verify(
-        signData.data(), signData.size(), _hash.data(), h256::size, _p.data());
-    return lresult;
+    unsigned char signData[64];
+    memcpy(signData, _s->r.data(), 32);
+    memcpy(signData + 32, _s->s.data(), 32);
+    return SM2::getInstance().fastVerify(signData, _hash.data(), h256::size, _p);
+}
+
+std::vector<size_t> dev::sm2BatchVerify(h512s const& _pubKeys,
+    std::vector<std::shared_ptr<crypto::Signature>> const& _sigs, h256s const& _hashes)
+{
+    std::vector<size_t> invalidIndexes;
+    if (_pubKeys.size() != _sigs.size() || _pubKeys.size() != _hashes.size())
+    {
+        BOOST_THROW_EXCEPTION(
+            CryptoException() << errinfo_comment("sm2BatchVerify: size mismatch"));
+    }
+    // 0 means invalid, not std::vector<bool> for the concurrent writing
+    std::vector<char> results(_sigs.size(), 0);
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, _sigs.size()), [&](const tbb::blocked_range<size_t>& _r) {
+            for (size_t i = _r.begin(); i != _r.end(); ++i)
+            {
+                results[i] = sm2Verify(_pubKeys[i], _sigs[i], _hashes[i]);
+            }
+        });
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        if (!results[i])
+        {
+            invalidIndexes.push_back(i);
+        }
+    }
+    return invalidIndexes;
+}
+
+void dev::sm2PrecomputePublicKeys(int64_t _owner, h512s const& _pubKeys)
+{
+    SM2::getInstance().precomputePublicKeys(_owner, _pubKeys);
 }
 
 h512 dev::sm2Recover(std::shared_ptr<crypto::Signature> _s, h256 const& _message)
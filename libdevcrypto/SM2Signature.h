@@ -48,6 +48,12 @@ struct SM2Signature : public Signature
 class KeyPair;
 std::shared_ptr<crypto::Signature> sm2Sign(KeyPair const& _keyPair, const h256& _hash);
 bool sm2Verify(h512 const& _pubKey, std::shared_ptr<crypto::Signature> _sig, const h256& _hash);
+/// verify the signatures in parallel, returns the indexes of the invalid signatures
+std::vector<size_t> sm2BatchVerify(h512s const& _pubKeys,
+    std::vector<std::shared_ptr<crypto::Signature>> const& _sigs, h256s const& _hashes);
+/// precompute the tables of the public keys that verified frequently, e.g. the sealers of the
+/// group _owner, an empty _pubKeys releases the tables of _owner
+void sm2PrecomputePublicKeys(int64_t _owner, h512s const& _pubKeys);
 h512 sm2Recover(std::shared_ptr<crypto::Signature> _sig, const h256& _hash);
 std::shared_ptr<crypto::Signature> sm2SignatureFromRLP(RLP const& _rlp, size_t _start);
 std::shared_ptr<crypto::Signature> sm2SignatureFromBytes(std::vector<unsigned char> _data);
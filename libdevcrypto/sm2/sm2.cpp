@@ -23,12 +23,391 @@
 #include "sm2.h"
 #include "libdevcore/CommonData.h"
 #include <libdevcore/Guards.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
 
 #define SM3_DIGEST_LENGTH 32
 
 using namespace std;
 using namespace dev;
 
+namespace
+{
+// the SM2 curve shared by all the threads, it is never modified after the precomputation
+struct SM2Curve
+{
+    SM2Curve()
+    {
+        group = EC_GROUP_new_by_curve_name(NID_sm2);
+        order = BN_new();
+        BN_CTX* ctx = BN_CTX_new();
+        if (!group || !order || !ctx || !EC_GROUP_get_order(group, order, ctx) ||
+            !EC_GROUP_precompute_mult(group, ctx))
+        {
+            CRYPTO_LOG(ERROR) << "[SM2Curve] Error of init the SM2 curve";
+        }
+        if (ctx)
+            BN_CTX_free(ctx);
+    }
+    ~SM2Curve()
+    {
+        if (group)
+            EC_GROUP_free(group);
+        if (order)
+            BN_free(order);
+    }
+    EC_GROUP* group = NULL;
+    BIGNUM* order = NULL;
+};
+
+SM2Curve const& sm2Curve()
+{
+    static SM2Curve curve;
+    return curve;
+}
+
+// BN_CTX is not thread-safe, every thread has its own
+struct BNContext
+{
+    BNContext() : ctx(BN_CTX_new()) {}
+    ~BNContext()
+    {
+        if (ctx)
+            BN_CTX_free(ctx);
+    }
+    BN_CTX* ctx;
+};
+
+BN_CTX* threadBNContext()
+{
+    static thread_local BNContext context;
+    return context.ctx;
+}
+
+// the key of the last signing of the thread, the node always signs with the same key
+struct SM2SignKey
+{
+    ~SM2SignKey()
+    {
+        if (key)
+            EC_KEY_free(key);
+    }
+    std::string privateKey;
+    EC_KEY* key = NULL;
+};
+
+EC_KEY* threadSignKey(std::string const& _privateKey)
+{
+    static thread_local SM2SignKey signKey;
+    if (signKey.key && signKey.privateKey == _privateKey)
+    {
+        return signKey.key;
+    }
+    if (signKey.key)
+    {
+        EC_KEY_free(signKey.key);
+        signKey.key = NULL;
+    }
+    BIGNUM* res = NULL;
+    EC_KEY* sm2Key = EC_KEY_new_by_curve_name(NID_sm2);
+    if (!sm2Key || !BN_hex2bn(&res, _privateKey.c_str()) || !EC_KEY_set_private_key(sm2Key, res))
+    {
+        if (sm2Key)
+            EC_KEY_free(sm2Key);
+        sm2Key = NULL;
+    }
+    if (res)
+        BN_clear_free(res);
+    signKey.key = sm2Key;
+    signKey.privateKey = _privateKey;
+    return sm2Key;
+}
+
+/**
+ * @brief Fixed-base table of a point P, table[i * windowSize + j - 1] = j * 2^(w * i) * P in
+ * affine coordinates, so that [k]P only needs 256 / w mixed additions and no doubling.
+ */
+class SM2PointTable
+{
+public:
+    explicit SM2PointTable(size_t _windowBits)
+      : m_windowBits(_windowBits),
+        m_windowCount((256 + _windowBits - 1) / _windowBits),
+        m_windowSize((1 << _windowBits) - 1)
+    {}
+    ~SM2PointTable()
+    {
+        for (auto point : m_table)
+        {
+            if (point)
+                EC_POINT_free(point);
+        }
+    }
+
+    bool build(EC_GROUP const* _group, EC_POINT const* _base, BN_CTX* _ctx);
+    // _result += [_k]P, _k must be in [0, 2^256)
+    bool addMul(EC_GROUP const* _group, EC_POINT* _result, BIGNUM const* _k, BN_CTX* _ctx) const;
+    bool empty() const { return m_table.empty(); }
+
+private:
+    size_t m_windowBits;
+    size_t m_windowCount;
+    size_t m_windowSize;
+    std::vector<EC_POINT*> m_table;
+};
+
+bool SM2PointTable::build(EC_GROUP const* _group, EC_POINT const* _base, BN_CTX* _ctx)
+{
+    bool lresult = false;
+    EC_POINT* base = EC_POINT_dup(_base, _group);
+    m_table.resize(m_windowCount * m_windowSize, NULL);
+    if (!base)
+    {
+        goto err;
+    }
+    for (size_t i = 0; i < m_windowCount; ++i)
+    {
+        auto window = m_table.data() + i * m_windowSize;
+        window[0] = EC_POINT_dup(base, _group);
+        if (!window[0])
+        {
+            goto err;
+        }
+        for (size_t j = 1; j < m_windowSize; ++j)
+        {
+            window[j] = EC_POINT_new(_group);
+            if (!window[j] || !EC_POINT_add(_group, window[j], window[j - 1], base, _ctx))
+            {
+                goto err;
+            }
+        }
+        for (size_t k = 0; k < m_windowBits; ++k)
+        {
+            if (!EC_POINT_dbl(_group, base, base, _ctx))
+            {
+                goto err;
+            }
+        }
+    }
+    if (!EC_POINTs_make_affine(_group, m_table.size(), m_table.data(), _ctx))
+    {
+        goto err;
+    }
+    lresult = true;
+err:
+    if (base)
+        EC_POINT_free(base);
+    if (!lresult)
+    {
+        for (auto point : m_table)
+        {
+            if (point)
+                EC_POINT_free(point);
+        }
+        m_table.clear();
+    }
+    return lresult;
+}
+
+bool SM2PointTable::addMul(
+    EC_GROUP const* _group, EC_POINT* _result, BIGNUM const* _k, BN_CTX* _ctx) const
+{
+    if (BN_is_negative(_k) || BN_num_bits(_k) > 256)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < m_windowCount; ++i)
+    {
+        size_t digit = 0;
+        for (size_t bit = 0; bit < m_windowBits; ++bit)
+        {
+            digit |= (size_t)BN_is_bit_set(_k, (int)(i * m_windowBits + bit)) << bit;
+        }
+        if (digit == 0)
+        {
+            continue;
+        }
+        if (!EC_POINT_add(_group, _result, _result, m_table[i * m_windowSize + digit - 1], _ctx))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// the table of the generator is shared by all the keys, the wider window trades 2MB for speed
+const size_t c_generatorWindowBits = 8;
+// the tables of the precomputed public keys, about 150KB per key
+const size_t c_publicKeyWindowBits = 4;
+
+SM2PointTable const* generatorTable()
+{
+    static SM2PointTable* table = []() -> SM2PointTable* {
+        auto group = sm2Curve().group;
+        BN_CTX* ctx = BN_CTX_new();
+        auto result = new SM2PointTable(c_generatorWindowBits);
+        if (!group || !ctx || !result->build(group, EC_GROUP_get0_generator(group), ctx))
+        {
+            CRYPTO_LOG(ERROR) << "[SM2PointTable] Error of precompute the generator";
+            delete result;
+            result = NULL;
+        }
+        if (ctx)
+            BN_CTX_free(ctx);
+        return result;
+    }();
+    return table;
+}
+
+/**
+ * @brief The decoded public key and its Z value, immutable after creation.
+ * The public keys of the sealers also have the fixed-base table, then [s]G + [t]P is computed
+ * with the tables of G and P, which needs no doubling at all.
+ */
+class SM2PublicKey
+{
+public:
+    using Ptr = std::shared_ptr<SM2PublicKey const>;
+    ~SM2PublicKey()
+    {
+        if (point)
+            EC_POINT_free(point);
+    }
+
+    static Ptr create(h512 const& _publicKey, bool _precompute, BN_CTX* _ctx);
+
+    // _result = [_s]G + [_t]P
+    bool mul(EC_GROUP const* _group, EC_POINT* _result, BIGNUM const* _s, BIGNUM const* _t,
+        BN_CTX* _ctx) const;
+
+    EC_POINT* point = NULL;
+    unsigned char zValue[SM3_DIGEST_LENGTH];
+    size_t zValueLen = SM3_DIGEST_LENGTH;
+    std::shared_ptr<SM2PointTable> table;
+};
+
+SM2PublicKey::Ptr SM2PublicKey::create(h512 const& _publicKey, bool _precompute, BN_CTX* _ctx)
+{
+    auto group = sm2Curve().group;
+    if (!group || !_ctx)
+    {
+        return nullptr;
+    }
+    auto publicKey = std::make_shared<SM2PublicKey>();
+    EC_KEY* sm2Key = NULL;
+    BIGNUM* x = BN_bin2bn(_publicKey.data(), 32, NULL);
+    BIGNUM* y = BN_bin2bn(_publicKey.data() + 32, 32, NULL);
+    bool lresult = false;
+    publicKey->point = EC_POINT_new(group);
+    if (!x || !y || !publicKey->point ||
+        !EC_POINT_set_affine_coordinates_GFp(group, publicKey->point, x, y, _ctx))
+    {
+        CRYPTO_LOG(ERROR) << "[SM2PublicKey] ERROR of decode public key"
+                          << LOG_KV("pubKey", _publicKey.abridged());
+        goto err;
+    }
+    // EC_POINT_set_affine_coordinates_GFp does not check the point
+    if (EC_POINT_is_on_curve(group, publicKey->point, _ctx) != 1)
+    {
+        CRYPTO_LOG(ERROR) << "[SM2PublicKey] ERROR of public key not on curve"
+                          << LOG_KV("pubKey", _publicKey.abridged());
+        goto err;
+    }
+    sm2Key = EC_KEY_new_by_curve_name(NID_sm2);
+    if (!sm2Key || !EC_KEY_set_public_key(sm2Key, publicKey->point) ||
+        !ECDSA_sm2_get_Z((const EC_KEY*)sm2Key, NULL, NULL, 0, publicKey->zValue,
+            &publicKey->zValueLen))
+    {
+        CRYPTO_LOG(ERROR) << "[SM2PublicKey] Error Of Compute Z"
+                          << LOG_KV("pubKey", _publicKey.abridged());
+        goto err;
+    }
+    if (_precompute && generatorTable())
+    {
+        publicKey->table = std::make_shared<SM2PointTable>(c_publicKeyWindowBits);
+        if (!publicKey->table->build(group, publicKey->point, _ctx))
+        {
+            CRYPTO_LOG(ERROR) << "[SM2PublicKey] Error Of precompute the table"
+                              << LOG_KV("pubKey", _publicKey.abridged());
+            goto err;
+        }
+    }
+    lresult = true;
+err:
+    if (x)
+        BN_free(x);
+    if (y)
+        BN_free(y);
+    if (sm2Key)
+        EC_KEY_free(sm2Key);
+    return lresult ? publicKey : nullptr;
+}
+
+bool SM2PublicKey::mul(EC_GROUP const* _group, EC_POINT* _result, BIGNUM const* _s,
+    BIGNUM const* _t, BN_CTX* _ctx) const
+{
+    if (!table)
+    {
+        // the interleaved wNAF of OpenSSL shares the doublings of [s]G and [t]P
+        return EC_POINT_mul(_group, _result, _s, point, _t, _ctx);
+    }
+    return EC_POINT_set_to_infinity(_group, _result) &&
+           generatorTable()->addMul(_group, _result, _s, _ctx) &&
+           table->addMul(_group, _result, _t, _ctx);
+}
+
+// decoded public keys, evict randomly when full
+const size_t c_maxPublicKeyCacheSize = 10000;
+dev::SharedMutex x_publicKeyCache;
+std::map<h512, SM2PublicKey::Ptr> c_publicKeyCache;
+// public keys with the precomputed table, the union of the public keys of all the owners
+dev::SharedMutex x_precomputedPublicKeys;
+std::map<h512, SM2PublicKey::Ptr> c_precomputedPublicKeys;
+// the public keys to be precomputed of every owner (e.g. the sealers of every group)
+std::mutex x_ownerPublicKeys;
+std::map<int64_t, dev::h512s> c_ownerPublicKeys;
+
+SM2PublicKey::Ptr cachedPublicKey(h512 const& _publicKey, BN_CTX* _ctx)
+{
+    {
+        ReadGuard l(x_precomputedPublicKeys);
+        auto it = c_precomputedPublicKeys.find(_publicKey);
+        if (it != c_precomputedPublicKeys.end())
+        {
+            return it->second;
+        }
+    }
+    {
+        ReadGuard l(x_publicKeyCache);
+        auto it = c_publicKeyCache.find(_publicKey);
+        if (it != c_publicKeyCache.end())
+        {
+            return it->second;
+        }
+    }
+    auto publicKey = SM2PublicKey::create(_publicKey, false, _ctx);
+    if (!publicKey)
+    {
+        return nullptr;
+    }
+    WriteGuard l(x_publicKeyCache);
+    if (c_publicKeyCache.size() >= c_maxPublicKeyCacheSize)
+    {
+        auto it = c_publicKeyCache.lower_bound(h512::random());
+        if (it == c_publicKeyCache.end())
+        {
+            it = c_publicKeyCache.begin();
+        }
+        c_publicKeyCache.erase(it);
+    }
+    c_publicKeyCache[_publicKey] = publicKey;
+    return publicKey;
+}
+}  // namespace
+
 // cache for sign
 static dev::Mutex c_zValueCacheMutex;
 // map between privateKey to {zValueCache, zValueLen}
@@ -124,21 +503,15 @@ bool SM2::sign(const char* originalData, int originalDataLen, const string& priv
 
     size_t zValueLen;
     ECDSA_SIG* signData = NULL;
-    string str = "";   // big int data
-    string _str = "";  // big int swap data
-    // int _size = 0;     // big int padding size
-    BIGNUM start;
-    BIGNUM* res = NULL;
-    BN_CTX* ctx = NULL;
     int len = 0;
     int i = 0;
-    BN_init(&start);
-    ctx = BN_CTX_new();
 
-    res = &start;
-    BN_hex2bn(&res, (const char*)privateKey.c_str());
-    sm2Key = EC_KEY_new_by_curve_name(NID_sm2);
-    EC_KEY_set_private_key(sm2Key, res);
+    sm2Key = threadSignKey(privateKey);
+    if (!sm2Key)
+    {
+        CRYPTO_LOG(ERROR) << "[SM2::sign] Error Of Set SM2 Private Key";
+        goto err;
+    }
 
     zValueLen = sizeof(zValue);
     if (!sm2GetZ(privateKey, (const EC_KEY*)sm2Key, zValue, zValueLen))
@@ -179,10 +552,6 @@ bool SM2::sign(const char* originalData, int originalDataLen, const string& priv
     lresult = true;
     // LOG(DEBUG)<<"r:"<<r<<" rLen:"<<r.length()<<" s:"<<s<<" sLen:"<<s.length();
 err:
-    if (ctx)
-        BN_CTX_free(ctx);
-    if (sm2Key)
-        EC_KEY_free(sm2Key);
     if (signData)
         ECDSA_SIG_free(signData);
     return lresult;
@@ -284,6 +653,137 @@ err:
     return lresult;
 }
 
+bool SM2::fastVerify(const unsigned char* _signData, const unsigned char* _originalData,
+    size_t _originalLength, dev::h512 const& _publicKey)
+{
+    bool lresult = false;
+    SM3_CTX sm3Ctx;
+    unsigned char digest[SM3_DIGEST_LENGTH];
+    auto const& curve = sm2Curve();
+    BN_CTX* ctx = threadBNContext();
+    SM2PublicKey::Ptr publicKey;
+    EC_POINT* point = NULL;
+    BIGNUM* r = NULL;
+    BIGNUM* s = NULL;
+    BIGNUM* t = NULL;
+    BIGNUM* e = NULL;
+    BIGNUM* x1 = NULL;
+    if (!curve.group || !ctx)
+    {
+        CRYPTO_LOG(ERROR) << "[SM2::fastVerify] ERROR of the SM2 curve context";
+        return false;
+    }
+    publicKey = cachedPublicKey(_publicKey, ctx);
+    if (!publicKey)
+    {
+        return false;
+    }
+    // e = SM3(Z || M)
+    SM3_Init(&sm3Ctx);
+    SM3_Update(&sm3Ctx, publicKey->zValue, publicKey->zValueLen);
+    SM3_Update(&sm3Ctx, _originalData, _originalLength);
+    SM3_Final(digest, &sm3Ctx);
+
+    BN_CTX_start(ctx);
+    r = BN_CTX_get(ctx);
+    s = BN_CTX_get(ctx);
+    t = BN_CTX_get(ctx);
+    e = BN_CTX_get(ctx);
+    x1 = BN_CTX_get(ctx);
+    point = EC_POINT_new(curve.group);
+    if (!x1 || !point || !BN_bin2bn(_signData, 32, r) || !BN_bin2bn(_signData + 32, 32, s) ||
+        !BN_bin2bn(digest, SM3_DIGEST_LENGTH, e))
+    {
+        CRYPTO_LOG(ERROR) << "[SM2::fastVerify] ERROR of alloc";
+        goto err;
+    }
+    // r, s in [1, n-1]
+    if (BN_is_zero(r) || BN_cmp(r, curve.order) >= 0 || BN_is_zero(s) ||
+        BN_cmp(s, curve.order) >= 0)
+    {
+        goto err;
+    }
+    // t = (r + s) mod n, t != 0
+    if (!BN_mod_add(t, r, s, curve.order, ctx) || BN_is_zero(t))
+    {
+        goto err;
+    }
+    // (x1, y1) = [s]G + [t]P
+    if (!publicKey->mul(curve.group, point, s, t, ctx) ||
+        !EC_POINT_get_affine_coordinates_GFp(curve.group, point, x1, NULL, ctx))
+    {
+        goto err;
+    }
+    // R = (e + x1) mod n, R == r
+    if (!BN_mod_add(e, e, x1, curve.order, ctx))
+    {
+        goto err;
+    }
+    lresult = (BN_cmp(e, r) == 0);
+err:
+    if (point)
+        EC_POINT_free(point);
+    BN_CTX_end(ctx);
+    if (!lresult)
+    {
+        CRYPTO_LOG(ERROR) << "[SM2::fastVerify] Error Of SM2 Verify"
+                          << LOG_KV("pubKey", _publicKey.abridged());
+    }
+    return lresult;
+}
+
+void SM2::precomputePublicKeys(int64_t _owner, dev::h512s const& _publicKeys)
+{
+    // the owners update in turn, so that the tables of the other owners are kept
+    std::lock_guard<std::mutex> ownerLock(x_ownerPublicKeys);
+    if (_publicKeys.empty())
+    {
+        c_ownerPublicKeys.erase(_owner);
+    }
+    else
+    {
+        c_ownerPublicKeys[_owner] = _publicKeys;
+    }
+    std::set<h512> publicKeys;
+    for (auto const& ownerPublicKeys : c_ownerPublicKeys)
+    {
+        publicKeys.insert(ownerPublicKeys.second.begin(), ownerPublicKeys.second.end());
+    }
+
+    std::map<h512, SM2PublicKey::Ptr> precomputedPublicKeys;
+    {
+        ReadGuard l(x_precomputedPublicKeys);
+        for (auto const& publicKey : publicKeys)
+        {
+            auto it = c_precomputedPublicKeys.find(publicKey);
+            if (it != c_precomputedPublicKeys.end())
+            {
+                precomputedPublicKeys[publicKey] = it->second;
+            }
+        }
+    }
+    for (auto const& publicKey : publicKeys)
+    {
+        if (precomputedPublicKeys.count(publicKey))
+        {
+            continue;
+        }
+        auto precomputed = SM2PublicKey::create(publicKey, true, threadBNContext());
+        if (precomputed)
+        {
+            precomputedPublicKeys[publicKey] = precomputed;
+        }
+    }
+    WriteGuard l(x_precomputedPublicKeys);
+    c_precomputedPublicKeys.swap(precomputedPublicKeys);
+}
+
+bool SM2::isPrecomputed(dev::h512 const& _publicKey)
+{
+    ReadGuard l(x_precomputedPublicKeys);
+    return c_precomputedPublicKeys.count(_publicKey);
+}
+
 int SM2::sm2GetZ(std::string const& _privateKey, const EC_KEY* _ecKey, unsigned char* _zValue,
     size_t& _zValueLen)
 {
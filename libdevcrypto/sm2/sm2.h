@@ -21,6 +21,7 @@
  * @date: 2018
  */
 #pragma once
+#include "libdevcore/FixedHash.h"
 #include "libdevcore/Log.h"
 #include <openssl/sm2.h>
 #include <openssl/sm3.h>
@@ -38,6 +39,18 @@ public:
         unsigned char* r, unsigned char* s);
     int verify(const unsigned char* _signData, size_t _sigLenth, const unsigned char* _originalData,
         size_t _originalLength, const unsigned char* _publicKey);
+    /**
+     * @brief verify with the shared curve context, the decoded public key point and Z value are
+     * cached per public key, the precomputed table of the public key is used if exists
+     * @param _signData: r(32 bytes) || s(32 bytes)
+     */
+    bool fastVerify(const unsigned char* _signData, const unsigned char* _originalData,
+        size_t _originalLength, dev::h512 const& _publicKey);
+    // precompute the windowed tables of the public keys of _owner (e.g. the sealers of a group),
+    // replacing the last public keys of _owner, the tables of the public keys no owner has are
+    // released
+    void precomputePublicKeys(int64_t _owner, dev::h512s const& _publicKeys);
+    bool isPrecomputed(dev::h512 const& _publicKey);
     std::string priToPub(const std::string& privateKey);
     char* strlower(char* s);
     std::string ascii2hex(const char* chs, int len);
@@ -111,7 +111,7 @@ void Block::encode(bytes& _out) const
     // append block header
     block_stream.appendRaw(headerData);
     // append transaction list
-    block_stream.appendRaw(m_txsCache);
+    block_stream.appendRaw(*m_txsCache);
     // append transactionReceipts list
     block_stream.appendRaw(m_tReceiptsCache);
     // append block hash
@@ -134,7 +134,7 @@ void Block::encodeRC2(bytes& _out) const
     // append block header
     block_stream.appendRaw(headerData);
     // append transaction list
-    block_stream.append(ref(m_txsCache));
+    block_stream.append(ref(*m_txsCache));
     // append block hash
     block_stream.append(m_blockHeader.hash());
     // append sig_list
@@ -162,7 +162,7 @@ void Block::calTransactionRoot(bool update) const
     WriteGuard l(x_txsCache);
     RLPStream txs;
     txs.appendList(m_transactions->size());
-    if (m_txsCache == bytes())
+    if (m_txsCache->empty())
     {
         BytesMap txsMapCache;
         for (size_t i = 0; i < m_transactions->size(); i++)
@@ -174,7 +174,9 @@ void Block::calTransactionRoot(bool update) const
             txs.appendRaw(trans_data);
             txsMapCache.insert(std::make_pair(s.out(), trans_data));
         }
-        txs.swapOut(m_txsCache);
+        auto txsCache = std::make_shared<bytes>();
+        txs.swapOut(*txsCache);
+        m_txsCache = txsCache;
         m_transRootCache = hash256(txsMapCache);
     }
     if (update == true)
@@ -188,7 +190,7 @@ void Block::calTransactionRootV2_2_0(bool update) const
     TIME_RECORD(
         "Calc transaction root, count:" + boost::lexical_cast<std::string>(m_transactions->size()));
     WriteGuard l(x_txsCache);
-    if (m_txsCache == bytes())
+    if (m_txsCache->empty())
     {
         std::vector<dev::bytes> transactionList;
         transactionList.resize(m_transactions->size());
@@ -204,7 +206,7 @@ void Block::calTransactionRootV2_2_0(bool update) const
                     transactionList[i] = byteValue;
                 }
             });
-        m_txsCache = TxsParallelParser::encode(m_transactions);
+        m_txsCache = std::make_shared<bytes const>(TxsParallelParser::encode(m_transactions));
         m_transRootCache = dev::getHash256(transactionList);
     }
     if (update == true)
@@ -309,10 +311,10 @@ std::shared_ptr<std::map<std::string, std::vector<std::string>>> Block::getRecei
 void Block::calTransactionRootRC2(bool update) const
 {
     WriteGuard l(x_txsCache);
-    if (m_txsCache == bytes())
+    if (m_txsCache->empty())
     {
-        m_txsCache = TxsParallelParser::encode(m_transactions);
-        m_transRootCache = crypto::Hash(m_txsCache);
+        m_txsCache = std::make_shared<bytes const>(TxsParallelParser::encode(m_transactions));
+        m_transRootCache = crypto::Hash(*m_txsCache);
     }
     if (update == true)
     {
@@ -433,7 +435,7 @@ void Block::decode(
     }
 
     /// get txsCache
-    m_txsCache = transactions_rlp.data().toBytes();
+    m_txsCache = std::make_shared<bytes const>(transactions_rlp.data().toBytes());
 
     /// get transactionReceipt list
     RLP transactionReceipts_rlp = block_rlp[2];
@@ -465,11 +467,11 @@ void Block::decodeRC2(
     /// get transaction list
     RLP transactions_rlp = block_rlp[1];
 
-    /// get txsCache
-    m_txsCache = transactions_rlp.toBytes();
+    /// get txsCache, the only copy of the transactions, which are decoded as views into it
+    m_txsCache = std::make_shared<bytes const>(transactions_rlp.toBytes());
 
     /// decode transaction
-    TxsParallelParser::decode(m_transactions, ref(m_txsCache), _option, _withTxHash);
+    TxsParallelParser::decode(m_transactions, ref(*m_txsCache), _option, _withTxHash, m_txsCache);
 
     /// get hash
     h256 hash = block_rlp[2].toHash<h256>();
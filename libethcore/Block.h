@@ -203,7 +203,7 @@ public:
         m_transactions->clear();
         m_transactionReceipts->clear();
         m_sigList->clear();
-        m_txsCache.clear();
+        m_txsCache = std::make_shared<bytes const>();
         m_tReceiptsCache.clear();
         noteChange();
         noteReceiptChange();
@@ -295,7 +295,7 @@ public:
     void noteChange()
     {
         WriteGuard l_txscache(x_txsCache);
-        m_txsCache = bytes();
+        m_txsCache = std::make_shared<bytes const>();
     }
 protected:
 
@@ -316,9 +316,10 @@ protected:
     SigListPtrType m_sigList;
     /// m_transactions converted bytes, when m_transactions changed,
     /// should refresh this catch when encode
+    /// the decoded transactions refer to the buffer, so it is replaced instead of modified
 
     mutable SharedMutex x_txsCache;
-    mutable bytes m_txsCache;
+    mutable std::shared_ptr<bytes const> m_txsCache = std::make_shared<bytes const>();
 
     mutable SharedMutex x_txReceiptsCache;
     mutable bytes m_tReceiptsCache;
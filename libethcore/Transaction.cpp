@@ -40,11 +40,74 @@ Transaction::Transaction(bytesConstRef _rlpData, CheckTransaction _checkSig)
 
 void Transaction::decode(bytesConstRef tx_bytes, CheckTransaction _checkSig)
 {
+    m_buffer.reset();
+    m_rlpRef.reset();
     m_rlpBuffer.assign(tx_bytes.data(), tx_bytes.data() + tx_bytes.size());
     RLP const rlp(tx_bytes);
     decode(rlp, _checkSig);
 }
 
+void Transaction::decode(
+    std::shared_ptr<bytes const> _buffer, bytesConstRef tx_bytes, CheckTransaction _checkSig)
+{
+    m_buffer = _buffer;
+    m_rlpRef = tx_bytes;
+    m_rlpBuffer = bytes();
+    RLP const rlp(tx_bytes);
+    decode(rlp, _checkSig);
+}
+
+void Transaction::decodeData(RLP const& _rlp)
+{
+    m_lazyData.reset();
+    m_dataIsView = (m_buffer != nullptr);
+    if (m_dataIsView)
+    {
+        m_data = bytes();
+        m_dataRef = _rlp.toBytesConstRef();
+        return;
+    }
+    m_dataRef.reset();
+    m_data = _rlp.toBytes();
+}
+
+bytes const& Transaction::data() const
+{
+    if (!m_dataIsView)
+    {
+        return m_data;
+    }
+    // the transactions of a block may be executed concurrently
+    auto data = std::atomic_load(&m_lazyData);
+    if (!data)
+    {
+        auto copied = std::make_shared<bytes const>(m_dataRef.begin(), m_dataRef.end());
+        if (std::atomic_compare_exchange_strong(&m_lazyData, &data, copied))
+        {
+            data = copied;
+        }
+    }
+    return *data;
+}
+
+void Transaction::detach()
+{
+    if (!m_buffer)
+    {
+        return;
+    }
+    if (m_dataIsView)
+    {
+        m_data = m_dataRef.toBytes();
+        m_dataIsView = false;
+        m_dataRef.reset();
+        m_lazyData.reset();
+    }
+    m_rlpBuffer = m_rlpRef.toBytes();
+    m_rlpRef.reset();
+    m_buffer.reset();
+}
+
 void Transaction::decode(RLP const& rlp, CheckTransaction _checkSig)
 {
     if (g_BCOSConfig.version() >= RC2_VERSION)
@@ -83,7 +146,7 @@ void Transaction::decodeRC1(RLP const& rlp, CheckTransaction _checkSig)
             BOOST_THROW_EXCEPTION(InvalidTransactionFormat()
                                   << errinfo_comment("rc1 transaction data RLP must be an array"));
 
-        m_data = rlp[6].toBytes();
+        decodeData(rlp[6]);
 
         // v -> rlp[7].toInt<NumberVType>() - VBase;  // 7
         // r -> rlp[8].toInt<u256>();             // 8
@@ -131,7 +194,7 @@ void Transaction::decodeRC2(RLP const& rlp, CheckTransaction _checkSig)
             BOOST_THROW_EXCEPTION(InvalidTransactionFormat()
                                   << errinfo_comment("rc2 transaction data RLP must be an array"));
 
-        m_data = rlp[6].toBytes();
+        decodeData(rlp[6]);
         invalidFieldName = "chainId";
         m_chainId = rlp[7].toInt<u256>();
         invalidFieldName = "groupId";
@@ -219,7 +282,8 @@ void Transaction::encodeRC1(bytes& _trans, IncludeSignature _sig) const
         _s << m_receiveAddress;
     else
         _s << "";
-    _s << m_value << m_data;
+    _s << m_value;
+    _s.append(dataRef());
 
     if (_sig)
     {
@@ -243,7 +307,9 @@ void Transaction::encodeRC2(bytes& _trans, IncludeSignature _sig) const
         _s << m_receiveAddress;
     else
         _s << "";
-    _s << m_value << m_data << m_chainId << m_groupId << m_extraData;
+    _s << m_value;
+    _s.append(dataRef());
+    _s << m_chainId << m_groupId << m_extraData;
 
     if (_sig)
     {
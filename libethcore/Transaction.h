@@ -169,9 +169,12 @@ public:
     /// Checks equality of transactions.
     bool operator==(Transaction const& _c) const
     {
+        auto data = dataRef();
+        auto otherData = _c.dataRef();
         return m_type == _c.m_type &&
                (m_type == ContractCreation || m_receiveAddress == _c.m_receiveAddress) &&
-               m_value == _c.m_value && m_data == _c.m_data;
+               m_value == _c.m_value && data.size() == otherData.size() &&
+               std::equal(data.begin(), data.end(), otherData.begin());
     }
     /// Checks inequality of transactions.
     bool operator!=(Transaction const& _c) const { return !operator==(_c); }
@@ -199,12 +202,22 @@ public:
     void encode(bytes& _trans, IncludeSignature _sig = WithSignature) const;
     void decode(bytesConstRef tx_bytes, CheckTransaction _checkSig = CheckTransaction::Everything);
     void decode(RLP const& rlp, CheckTransaction _checkSig = CheckTransaction::Everything);
+    /// decode the transaction as views into _buffer without copying its RLP and data,
+    /// _buffer is shared by all the transactions of a block and kept alive by them
+    void decode(std::shared_ptr<bytes const> _buffer, bytesConstRef tx_bytes,
+        CheckTransaction _checkSig = CheckTransaction::Everything);
+    /// copy the RLP and data out of the shared buffer, called before the transaction outlives
+    /// the block it is decoded from
+    void detach();
+    /// @returns true if the transaction refers to the buffer of a block
+    bool isView() const { return m_buffer != nullptr; }
     /// @returns the RLP serialisation of this transaction.
     bytes rlp(IncludeSignature _sig = WithSignature) const
     {
-        if (m_rlpBuffer != bytes())
+        auto encoded = encodedRef();
+        if (!encoded.empty())
         {
-            return m_rlpBuffer;
+            return encoded.toBytes();
         }
         bytes out;
         encode(out, _sig);
@@ -236,8 +249,10 @@ public:
     Address from() const { return safeSender(); }
 
     /// @returns the data associated with this (message-call) transaction. Synonym
-    /// for initCode().
-    bytes const& data() const { return m_data; }
+    /// for initCode(). The data of a view is copied out on the first call.
+    bytes const& data() const;
+    /// @returns the data without copying it out of the buffer of the block
+    bytesConstRef dataRef() const { return m_dataIsView ? m_dataRef : ref(m_data); }
 
     /// @returns the transaction-count of the sender.
     u256 nonce() const { return m_nonce; }
@@ -248,7 +263,7 @@ public:
         clearSignature();
         m_nonce = _n;
         m_hashWith = h256(0);
-        m_rlpBuffer = bytes();
+        clearRLPCache();
     }
 
     void setBlockLimit(u256 const& _blockLimit)
@@ -256,7 +271,7 @@ public:
         clearSignature();
         m_blockLimit = _blockLimit;
         m_hashWith = h256(0);
-        m_rlpBuffer = bytes();
+        clearRLPCache();
     }
 
     /// @returns the latest block number to be packaged for transaction.
@@ -287,12 +302,12 @@ public:
         m_vrs = sig;
         m_hashWith = h256(0);
         m_sender = Address();
-        m_rlpBuffer = bytes();
+        clearRLPCache();
     }
     /// @returns amount of gas required for the basic payment.
     int64_t baseGasRequired(EVMSchedule const& _es) const
     {
-        return baseGasRequired(isCreation(), &m_data, _es);
+        return baseGasRequired(isCreation(), dataRef(), _es);
     }
 
     /// Get the fee associated for a transaction with the given data.
@@ -313,11 +328,20 @@ public:
     void setSynced(bool const& _synced) { m_synced = _synced; }
     bool synced() const { return m_synced; }
 
-    int64_t capacity() { return (m_data.size() + m_rlpBuffer.size() + m_extraData.size()); }
+    int64_t capacity()
+    {
+        return (dataRef().size() + encodedRef().size() + m_extraData.size());
+    }
 
     // Note: Provide for node transaction generation
     void setReceiveAddress(Address const& _receiveAddr) { m_receiveAddress = _receiveAddr; }
-    void setData(std::shared_ptr<dev::bytes const> _dataPtr) { m_data = *_dataPtr; }
+    void setData(std::shared_ptr<dev::bytes const> _dataPtr)
+    {
+        m_data = *_dataPtr;
+        m_dataIsView = false;
+        m_dataRef.reset();
+        m_lazyData.reset();
+    }
 
     void setChainId(u256 const& _chainId) { m_chainId = _chainId; }
 
@@ -361,6 +385,15 @@ protected:
     void encodeRC2(bytes& _trans, IncludeSignature _sig = WithSignature) const;
     void decodeRC1(RLP const& rlp, CheckTransaction _checkSig = CheckTransaction::Everything);
     void decodeRC2(RLP const& rlp, CheckTransaction _checkSig = CheckTransaction::Everything);
+    void decodeData(RLP const& _rlp);
+
+    /// @returns the cached RLP of the transaction, empty if it needs to be encoded
+    bytesConstRef encodedRef() const { return m_buffer ? m_rlpRef : ref(m_rlpBuffer); }
+    void clearRLPCache()
+    {
+        m_rlpBuffer = bytes();
+        m_rlpRef.reset();
+    }
 
     /// Clears the signature.
     void clearSignature()
@@ -396,6 +429,15 @@ protected:
     bytes m_rlpBuffer;  /// < The buffer to cache origin RLP sequence. It will be reused when the tx
                         /// < needs to be encocoded again;
 
+    // the buffer of the block that m_rlpRef and m_dataRef point into, null if the transaction
+    // owns its RLP and data
+    std::shared_ptr<bytes const> m_buffer;
+    bytesConstRef m_rlpRef;
+    bytesConstRef m_dataRef;
+    bool m_dataIsView = false;
+    // the data copied out of m_buffer by data(), published atomically
+    mutable std::shared_ptr<bytes const> m_lazyData;
+
     u256 m_chainId;     /// < The scenario to which the transaction belongs.
     u256 m_groupId;     /// < The group to which the transaction belongs.
     bytes m_extraData;  /// < Reserved fields, distinguished by "##".
@@ -111,7 +111,7 @@ inline void throwInvalidBlockFormat(const std::string& _reason)
 
 // parallel decode transactions
 void TxsParallelParser::decode(std::shared_ptr<Transactions> _txs, bytesConstRef _bytes,
-    CheckTransaction _checkSig, bool _withHash)
+    CheckTransaction _checkSig, bool _withHash, std::shared_ptr<bytes const> _buffer)
 {
     try
     {
@@ -154,7 +154,14 @@ void TxsParallelParser::decode(std::shared_ptr<Transactions> _txs, bytesConstRef
                             throwInvalidBlockFormat("offset > maxOffset");
 
                         (*_txs)[i] = std::make_shared<Transaction>();
-                        (*_txs)[i]->decode(txBytes.cropped(offset, size), _checkSig);
+                        if (_buffer)
+                        {
+                            (*_txs)[i]->decode(_buffer, txBytes.cropped(offset, size), _checkSig);
+                        }
+                        else
+                        {
+                            (*_txs)[i]->decode(txBytes.cropped(offset, size), _checkSig);
+                        }
                         if (_withHash)
                         {
                             // cache the sha3
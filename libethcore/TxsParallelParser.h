@@ -44,8 +44,11 @@ class TxsParallelParser
 public:
     static bytes encode(std::shared_ptr<Transactions> _txs);
     static bytes encode(std::vector<bytes> const& _txs);
+    /// @param _buffer: if set, _bytes is in _buffer and the transactions are decoded as views
+    /// into it, see Transaction::isView
     static void decode(std::shared_ptr<Transactions> _txs, bytesConstRef _bytes,
-        CheckTransaction _checkSig = CheckTransaction::Everything, bool _withHash = false);
+        CheckTransaction _checkSig = CheckTransaction::Everything, bool _withHash = false,
+        std::shared_ptr<bytes const> _buffer = nullptr);
 
 private:
     static inline bytes toBytes(Offset_t _num)
@@ -46,6 +46,12 @@ u256 Executive::gasUsed() const
     return m_envInfo.precompiledEngine()->txGasLimit() - m_gas;
 }
 
+BlockArena::Ptr Executive::arena() const
+{
+    auto context = m_envInfo.precompiledEngine();
+    return context ? context->arena() : nullptr;
+}
+
 void Executive::accrueSubState(SubState& _parentContext)
 {
     if (m_ext)
@@ -134,12 +140,12 @@ bool Executive::execute()
     if (m_t->isCreation())
     {
         return create(m_t->sender(), m_t->value(), m_t->gasPrice(),
-            txGasLimit - (u256)m_baseGasRequired, &m_t->data(), m_t->sender());
+            txGasLimit - (u256)m_baseGasRequired, m_t->dataRef(), m_t->sender());
     }
     else
     {
         return call(m_t->receiveAddress(), m_t->sender(), m_t->value(), m_t->gasPrice(),
-            bytesConstRef(&m_t->data()), txGasLimit - (u256)m_baseGasRequired);
+            m_t->dataRef(), txGasLimit - (u256)m_baseGasRequired);
     }
 }
 
@@ -224,7 +230,7 @@ bool Executive::call(CallParameters const& _p, u256 const& _gasPrice, Address co
             {
                 bytes const& c = m_s->code(_p.codeAddress);
                 h256 codeHash = m_s->codeHash(_p.codeAddress);
-                m_ext = make_shared<EVMHostContext>(m_s, m_envInfo, _p.receiveAddress,
+                m_ext = makeShared<EVMHostContext>(arena(), m_s, m_envInfo, _p.receiveAddress,
                     _p.senderAddress, _origin, _p.apparentValue, _gasPrice, _p.data, c, codeHash,
                     m_depth, false, _p.staticCall, m_enableFreeStorage);
             }
@@ -352,9 +358,9 @@ bool Executive::callRC2(CallParameters const& _p, u256 const& _gasPrice, Address
     {
         bytes const& c = m_s->code(_p.codeAddress);
         h256 codeHash = m_s->codeHash(_p.codeAddress);
-        m_ext = make_shared<EVMHostContext>(m_s, m_envInfo, _p.receiveAddress, _p.senderAddress,
-            _origin, _p.apparentValue, _gasPrice, _p.data, c, codeHash, m_depth, false,
-            _p.staticCall, m_enableFreeStorage);
+        m_ext = makeShared<EVMHostContext>(arena(), m_s, m_envInfo, _p.receiveAddress,
+            _p.senderAddress, _origin, _p.apparentValue, _gasPrice, _p.data, c, codeHash, m_depth,
+            false, _p.staticCall, m_enableFreeStorage);
     }
     else
     {
@@ -462,9 +468,9 @@ bool Executive::executeCreate(Address const& _sender, u256 const& _endowment, u2
     // Schedule _init execution if not empty.
     if (!_init.empty())
     {
-        m_ext = make_shared<EVMHostContext>(m_s, m_envInfo, m_newAddress, _sender, _origin,
-            _endowment, _gasPrice, bytesConstRef(), _init.toBytes(), crypto::Hash(_init), m_depth,
-            true, false, m_enableFreeStorage);
+        m_ext = makeShared<EVMHostContext>(arena(), m_s, m_envInfo, m_newAddress, _sender,
+            _origin, _endowment, _gasPrice, bytesConstRef(), _init.toBytes(), crypto::Hash(_init),
+            m_depth, true, false, m_enableFreeStorage);
     }
     return !m_ext;
 }
@@ -15,6 +15,7 @@
 #pragma once
 
 #include "Common.h"
+#include <libdevcore/BlockArena.h>
 #include <libethcore/BlockHeader.h>
 #include <libethcore/Common.h>
 #include <libethcore/EVMFlags.h>
@@ -212,6 +213,9 @@ private:
 
     void updateGas(std::shared_ptr<dev::precompiled::PrecompiledExecResult> _callResult);
 
+    /// @returns the arena of the executing block, null if not executing a block
+    BlockArena::Ptr arena() const;
+
     std::shared_ptr<StateFace> m_s;  ///< The state to which this operation/transaction is applied.
     // TODO: consider changign to EnvInfo const& to avoid LastHashes copy at every CALL/CREATE
     dev::executive::EnvInfo m_envInfo;      ///< Information on the runtime environment.
@@ -102,6 +102,26 @@ bool RateLimiter::acquireWithBurstSupported(uint64_t const& _requiredPermits, in
     return reqAccepted;
 }
 
+void RateLimiter::releasePermits(int64_t const& _permits, int64_t const& _now)
+{
+    if (_permits <= 0)
+    {
+        return;
+    }
+    Guard l(m_mutex);
+    int64_t remainingPermits = _permits;
+    // the permits borrowed from the future pushed m_lastPermitsUpdateTime forward
+    if (m_lastPermitsUpdateTime > _now)
+    {
+        int64_t borrowedPermits =
+            (double)(m_lastPermitsUpdateTime - _now) / m_permitsUpdateInterval;
+        auto returnedPermits = std::min(borrowedPermits, remainingPermits);
+        m_lastPermitsUpdateTime -= (int64_t)(returnedPermits * m_permitsUpdateInterval);
+        remainingPermits -= returnedPermits;
+    }
+    m_currentStoredPermits = std::min(m_maxPermits, m_currentStoredPermits + remainingPermits);
+}
+
 int64_t RateLimiter::fetchPermitsAndGetWaitTime(
     int64_t const& _requiredPermits, bool const& _fetchPermitsWhenRequireWait, int64_t const& _now)
 {
@@ -51,6 +51,11 @@ public:
     virtual bool acquireWithBurstSupported(
         uint64_t const& _requiredPermits = 1, int64_t const& _now = utcSteadyTimeUs());
 
+    // give back the permits acquired but not used, the permits borrowed from the future are
+    // returned first
+    virtual void releasePermits(
+        int64_t const& _permits, int64_t const& _now = utcSteadyTimeUs());
+
     void setMaxPermitsSize(int64_t const& _maxPermitsSize)
     {
         m_maxPermits = _maxPermitsSize;
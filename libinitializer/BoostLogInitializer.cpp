@@ -21,6 +21,7 @@
  * @date 2018-11-07
  */
 #include "BoostLogInitializer.h"
+#include <libdevcore/AsyncLog.h>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/log/core/core.hpp>
 #include <boost/log/support/date_time.hpp>
@@ -94,6 +95,20 @@ void LogInitializer::initLog(boost::property_tree::ptree const& _pt, std::string
                "TimeStamp", "%Y-%m-%d %H:%M:%S.%f")
         << "|" << expr::if_(expr::has_attr(group_id))[expr::stream << "[g:" << group_id << "]"]
         << boost::log::expressions::smessage);
+
+    /// the records are formatted by the callers and written by a background thread
+    if (_pt.get<bool>("log.enable_async_log", false))
+    {
+        auto ringSize = _pt.get<int64_t>("log.async_ring_size", 1024);
+        if (ringSize <= 0)
+        {
+            BOOST_THROW_EXCEPTION(
+                InvalidConfig() << errinfo_comment(
+                    "Please set log.async_ring_size to positive! Current value is " +
+                    std::to_string(ringSize)));
+        }
+        AsyncLogger::instance().start(ringSize);
+    }
 }
 
 boost::shared_ptr<dev::initializer::LogInitializer::sink_t> LogInitializer::initLogSink(
@@ -156,6 +171,8 @@ unsigned LogInitializer::getLogLevel(std::string const& levelStr)
 /// stop and remove all sinks after the program exit
 void LogInitializer::stopLogging()
 {
+    // write the records buffered by the asynchronous logger before stopping the sinks
+    AsyncLogger::instance().stop();
     for (auto const& sink : m_sinks)
         stopLogging(sink);
     m_sinks.clear();
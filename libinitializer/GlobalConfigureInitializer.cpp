@@ -24,11 +24,14 @@
 #include "GlobalConfigureInitializer.h"
 #include "include/BuildInfo.h"
 #include "libsecurity/KeyCenter.h"
+#include <libdevcore/Executor.h>
 #include <libdevcrypto/CryptoInterface.h>
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/split.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/lexical_cast.hpp>
+#include <thread>
 
 
 using namespace std;
@@ -197,6 +200,59 @@ void dev::initializer::initGlobalConfig(const boost::property_tree::ptree& _pt)
                           << LOG_KV("useSMCrypto", g_BCOSConfig.SMCrypto());
 }
 
+void dev::initializer::initExecutor(const boost::property_tree::ptree& _pt)
+{
+    if (!_pt.get<bool>("executor.enable", false))
+    {
+        return;
+    }
+    int64_t threadNum =
+        _pt.get<int64_t>("executor.thread_num", std::max(4u, std::thread::hardware_concurrency()));
+    if (threadNum <= 0 || threadNum > 1024)
+    {
+        BOOST_THROW_EXCEPTION(
+            InvalidConfiguration() << errinfo_comment(
+                "Please set executor.thread_num between 1 and 1024, now is " +
+                std::to_string(threadNum)));
+    }
+    // e.g. 0-7,16-23
+    std::vector<int> cpus;
+    auto cpuAffinity = _pt.get<std::string>("executor.cpu_affinity", "");
+    std::vector<std::string> ranges;
+    boost::split(ranges, cpuAffinity, boost::is_any_of(","), boost::token_compress_on);
+    try
+    {
+        for (auto range : ranges)
+        {
+            boost::trim(range);
+            if (range.empty())
+            {
+                continue;
+            }
+            auto pos = range.find('-');
+            int first = boost::lexical_cast<int>(range.substr(0, pos));
+            int last =
+                pos == std::string::npos ? first : boost::lexical_cast<int>(range.substr(pos + 1));
+            if (first < 0 || last < first)
+            {
+                BOOST_THROW_EXCEPTION(InvalidConfiguration());
+            }
+            for (int cpu = first; cpu <= last; ++cpu)
+            {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+    catch (std::exception const&)
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfiguration() << errinfo_comment(
+                                  "Invalid executor.cpu_affinity: " + cpuAffinity));
+    }
+    Executor::instance().start(threadNum, cpus);
+    INITIALIZER_LOG(INFO) << LOG_BADGE("initExecutor") << LOG_KV("threadNum", threadNum)
+                          << LOG_KV("cpuAffinity", cpuAffinity);
+}
+
 void dev::version()
 {
     std::cout << "FISCO-BCOS Version : " << FISCO_BCOS_PROJECT_VERSION
@@ -31,6 +31,8 @@ namespace initializer
 {
 void initGlobalConfig(const boost::property_tree::ptree& _pt);
 uint32_t getVersionNumber(const std::string& _version);
+/// start the node-wide executor shared by the groups if [executor].enable
+void initExecutor(const boost::property_tree::ptree& _pt);
 
 }  // namespace initializer
 
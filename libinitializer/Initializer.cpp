@@ -23,6 +23,7 @@
 #include "Initializer.h"
 #include "Common.h"
 #include "GlobalConfigureInitializer.h"
+#include <libdevcore/Executor.h>
 
 using namespace dev;
 using namespace dev::initializer;
@@ -40,6 +41,8 @@ void Initializer::init(std::string const& _path)
         m_logInitializer->initLog(pt);
         /// init global config. must init before DB, for compatibility
         initGlobalConfig(pt);
+        /// the shared executor must be started before the groups create their workers
+        initExecutor(pt);
 
         // init the statLog
         if (g_BCOSConfig.enableStat())
@@ -93,6 +96,7 @@ Initializer::~Initializer()
         m_ledgerInitializer->stopAll();
     }
     INITIALIZER_LOG(INFO) << LOG_DESC("ledgerInitializer stopped");
+    Executor::instance().stop();
     /// stop rpc
     if (m_rpcInitializer)
     {
@@ -25,6 +25,7 @@
 #include <boost/algorithm/string/split.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/lexical_cast.hpp>
+#include <thread>
 
 using namespace dev;
 using namespace std;
@@ -44,9 +45,76 @@ void LedgerInitializer::initConfig(boost::property_tree::ptree const& _pt)
     g_BCOSConfig.setConfDir(m_groupConfigPath);
     g_BCOSConfig.setDataDir(m_groupDataDir);
 
+    auto initParallelism = _pt.get<int64_t>("group.init_parallelism", 4);
+    if (initParallelism <= 0)
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfiguration() << errinfo_comment(
+                                  "Please set group.init_parallelism to a positive number"));
+    }
+    m_initParallelism = initParallelism;
+    // the cold groups are initialized on the first access, e.g. 3,5,7
+    auto coldGroups = _pt.get<string>("group.cold_groups", "");
+    vector<string> coldGroupList;
+    boost::split(coldGroupList, coldGroups, boost::is_any_of(","), boost::token_compress_on);
+    for (auto coldGroup : coldGroupList)
+    {
+        boost::trim(coldGroup);
+        if (coldGroup.empty())
+        {
+            continue;
+        }
+        try
+        {
+            m_coldGroupIDs.insert(boost::lexical_cast<dev::GROUP_ID>(coldGroup));
+        }
+        catch (boost::bad_lexical_cast const&)
+        {
+            BOOST_THROW_EXCEPTION(InvalidConfiguration()
+                                  << errinfo_comment("Invalid group.cold_groups: " + coldGroups));
+        }
+    }
+    if (!m_coldGroupIDs.empty())
+    {
+        m_ledgerManager->setColdGroupLoader(
+            [this](dev::GROUP_ID const& _groupId) { activateColdGroup(_groupId, true); });
+        // P2P messages must not wait for the initialization
+        m_p2pService->setUnknownGroupHandler(
+            [this](dev::GROUP_ID const& _groupId) { activateColdGroup(_groupId, false); });
+    }
+    INITIALIZER_LOG(INFO) << LOG_BADGE("LedgerInitializer")
+                          << LOG_KV("initParallelism", m_initParallelism)
+                          << LOG_KV("coldGroups", coldGroups);
+
     initLedgers();
 }
 
+LedgerInitializer::~LedgerInitializer()
+{
+    if (!m_coldGroupIDs.empty())
+    {
+        if (m_ledgerManager)
+        {
+            m_ledgerManager->setColdGroupLoader(nullptr);
+        }
+        if (m_p2pService)
+        {
+            m_p2pService->setUnknownGroupHandler(nullptr);
+        }
+    }
+    // wait for the cold groups in initialization
+    std::map<dev::GROUP_ID, std::shared_future<void>> loadingColdGroups;
+    {
+        Guard l(x_coldGroups);
+        m_coldGroupConfigs.clear();
+        loadingColdGroups = m_loadingColdGroups;
+    }
+    for (auto& loading : loadingColdGroups)
+    {
+        loading.second.wait();
+    }
+    stopAll();
+}
+
 
 bool LedgerInitializer::initLedgerByGroupID(dev::GROUP_ID const& _groupId)
 {
@@ -73,6 +141,8 @@ bool LedgerInitializer::initLedgerByGroupID(dev::GROUP_ID const& _groupId)
 vector<dev::GROUP_ID> LedgerInitializer::initLedgers()
 {
     vector<dev::GROUP_ID> newGroupIDList;
+    vector<pair<dev::GROUP_ID, string>> groupConfigs;
+    auto startTime = utcSteadyTime();
     try
     {
         newGroupIDList = foreachLedgerConfigure(m_groupConfigPath, [&](dev::GROUP_ID const&
@@ -92,20 +162,21 @@ vector<dev::GROUP_ID> LedgerInitializer::initLedgers()
                     return false;
                 }
 
-                bool succ = initLedger(_groupID, m_groupDataDir, _configFileName);
-                if (!succ)
+                if (m_coldGroupIDs.count(_groupID))
                 {
-                    INITIALIZER_LOG(ERROR)
-                        << LOG_BADGE("LedgerInitializer") << LOG_DESC("initSingleGroup failed")
-                        << LOG_KV("configFile", _configFileName);
-                    ERROR_OUTPUT << LOG_BADGE("LedgerInitializer")
-                                 << LOG_DESC("initSingleGroup failed")
-                                 << LOG_KV("configFile", _configFileName) << endl;
-                    BOOST_THROW_EXCEPTION(InitLedgerConfigFailed());
+                    Guard l(x_coldGroups);
+                    if (!m_coldGroupConfigs.count(_groupID) &&
+                        !m_loadingColdGroups.count(_groupID))
+                    {
+                        m_coldGroupConfigs[_groupID] = _configFileName;
+                        m_ledgerManager->addColdGroup(_groupID);
+                        INITIALIZER_LOG(INFO) << LOG_BADGE("LedgerInitializer")
+                                              << LOG_DESC("cold group, init on the first access")
+                                              << LOG_KV("groupID", _groupID);
+                    }
                     return false;
                 }
-                LOG(INFO) << LOG_BADGE("LedgerInitializer init group succ")
-                          << LOG_KV("groupID", _groupID);
+                groupConfigs.emplace_back(_groupID, _configFileName);
                 return true;
             }
             catch (UnknownGroupStatus& e)
@@ -126,6 +197,7 @@ vector<dev::GROUP_ID> LedgerInitializer::initLedgers()
                 BOOST_THROW_EXCEPTION(e);
             }
         });
+        initLedgersInParallel(groupConfigs);
     }
     catch (exception& e)
     {
@@ -135,9 +207,150 @@ vector<dev::GROUP_ID> LedgerInitializer::initLedgers()
                      << LOG_KV("EINFO", boost::diagnostic_information(e)) << endl;
         BOOST_THROW_EXCEPTION(e);
     }
+    INITIALIZER_LOG(INFO) << LOG_BADGE("LedgerInitializer") << LOG_DESC("initLedgers")
+                          << LOG_KV("groupNum", newGroupIDList.size())
+                          << LOG_KV("timeCost", utcSteadyTime() - startTime);
     return newGroupIDList;
 }
 
+void LedgerInitializer::initLedgersInParallel(
+    vector<pair<dev::GROUP_ID, string>> const& _groupConfigs)
+{
+    std::atomic<size_t> nextGroup = {0};
+    Mutex x_error;
+    std::exception_ptr error;
+    auto initWorker = [&]() {
+        while (true)
+        {
+            auto index = nextGroup++;
+            if (index >= _groupConfigs.size())
+            {
+                return;
+            }
+            {
+                Guard l(x_error);
+                if (error)
+                {
+                    return;
+                }
+            }
+            auto const& groupID = _groupConfigs[index].first;
+            auto const& configFileName = _groupConfigs[index].second;
+            try
+            {
+                auto startTime = utcSteadyTime();
+                if (!initLedger(groupID, m_groupDataDir, configFileName))
+                {
+                    INITIALIZER_LOG(ERROR)
+                        << LOG_BADGE("LedgerInitializer") << LOG_DESC("initSingleGroup failed")
+                        << LOG_KV("configFile", configFileName);
+                    ERROR_OUTPUT << LOG_BADGE("LedgerInitializer")
+                                 << LOG_DESC("initSingleGroup failed")
+                                 << LOG_KV("configFile", configFileName) << endl;
+                    BOOST_THROW_EXCEPTION(InitLedgerConfigFailed());
+                }
+                LOG(INFO) << LOG_BADGE("LedgerInitializer init group succ")
+                          << LOG_KV("groupID", groupID)
+                          << LOG_KV("timeCost", utcSteadyTime() - startTime);
+            }
+            catch (exception& e)
+            {
+                ERROR_OUTPUT << LOG_BADGE("LedgerInitializer") << LOG_DESC("initLedger failed")
+                             << LOG_KV("errorInfo", boost::diagnostic_information(e));
+                Guard l(x_error);
+                if (!error)
+                {
+                    error = std::current_exception();
+                }
+            }
+        }
+    };
+    // the current thread is one of the workers
+    size_t threadNum = std::min(m_initParallelism, _groupConfigs.size());
+    vector<std::thread> threads;
+    for (size_t i = 1; i < threadNum; ++i)
+    {
+        threads.emplace_back(initWorker);
+    }
+    initWorker();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+void LedgerInitializer::activateColdGroup(dev::GROUP_ID const& _groupId, bool _wait)
+{
+    std::shared_future<void> loading;
+    {
+        Guard l(x_coldGroups);
+        auto it = m_loadingColdGroups.find(_groupId);
+        if (it != m_loadingColdGroups.end())
+        {
+            loading = it->second;
+        }
+        else
+        {
+            auto configIt = m_coldGroupConfigs.find(_groupId);
+            if (configIt == m_coldGroupConfigs.end())
+            {
+                return;
+            }
+            auto configFileName = configIt->second;
+            m_coldGroupConfigs.erase(configIt);
+            auto loaded = std::make_shared<std::promise<void>>();
+            loading = loaded->get_future().share();
+            m_loadingColdGroups[_groupId] = loading;
+            std::thread([this, _groupId, configFileName, loaded]() {
+                dev::pthread_setThreadName("coldGroup-" + std::to_string(_groupId));
+                loadColdGroup(_groupId, configFileName);
+                loaded->set_value();
+            }).detach();
+        }
+    }
+    if (_wait)
+    {
+        loading.wait();
+    }
+}
+
+void LedgerInitializer::loadColdGroup(dev::GROUP_ID const& _groupId, string const& _configFileName)
+{
+    auto startTime = utcSteadyTime();
+    INITIALIZER_LOG(INFO) << LOG_BADGE("LedgerInitializer") << LOG_DESC("activate cold group")
+                          << LOG_KV("groupID", _groupId);
+    try
+    {
+        if (initLedger(_groupId, m_groupDataDir, _configFileName))
+        {
+            m_ledgerManager->ledger(_groupId)->startAll();
+            m_ledgerManager->setGroupStatus(_groupId, LedgerStatus::RUNNING);
+            INITIALIZER_LOG(INFO) << LOG_BADGE("LedgerInitializer")
+                                  << LOG_DESC("activate cold group succ")
+                                  << LOG_KV("groupID", _groupId)
+                                  << LOG_KV("timeCost", utcSteadyTime() - startTime);
+            return;
+        }
+    }
+    catch (exception& e)
+    {
+        INITIALIZER_LOG(ERROR) << LOG_BADGE("LedgerInitializer")
+                               << LOG_DESC("activate cold group exception")
+                               << LOG_KV("groupID", _groupId)
+                               << LOG_KV("EINFO", boost::diagnostic_information(e));
+    }
+    INITIALIZER_LOG(ERROR) << LOG_BADGE("LedgerInitializer")
+                           << LOG_DESC("activate cold group failed, retry on the next access")
+                           << LOG_KV("groupID", _groupId);
+    Guard l(x_coldGroups);
+    m_loadingColdGroups.erase(_groupId);
+    m_coldGroupConfigs[_groupId] = _configFileName;
+}
+
 vector<dev::GROUP_ID> LedgerInitializer::foreachLedgerConfigure(
     const string& _groupConfigPath, function<bool(dev::GROUP_ID const&, const string&)> _f)
 {
@@ -28,6 +28,9 @@
 #include <libledger/LedgerManager.h>
 #include <libp2p/Service.h>
 #include <functional>
+#include <future>
+#include <map>
+#include <set>
 #include <vector>
 
 namespace dev
@@ -59,7 +62,7 @@ public:
     }
     void setKeyPair(KeyPair const& _keyPair) { m_keyPair = _keyPair; }
 
-    ~LedgerInitializer() { stopAll(); }
+    ~LedgerInitializer();
 
     void startAll()
     {
@@ -76,8 +79,18 @@ public:
     // Init ledger when running
     bool initLedgerByGroupID(dev::GROUP_ID const& _groupId);
 
+    /**
+     * @brief initialize and start the cold group in the background
+     * @param _wait: wait until the group started or failed
+     */
+    void activateColdGroup(dev::GROUP_ID const& _groupId, bool _wait);
+
 private:
     std::vector<dev::GROUP_ID> initLedgers();
+    // initialize the groups concurrently, at most m_initParallelism groups at the same time
+    void initLedgersInParallel(
+        std::vector<std::pair<dev::GROUP_ID, std::string>> const& _groupConfigs);
+    void loadColdGroup(dev::GROUP_ID const& _groupId, std::string const& _configFileName);
     std::vector<dev::GROUP_ID> foreachLedgerConfigure(const std::string& _groupConfigPath,
         std::function<bool(dev::GROUP_ID const&, const std::string&)> _f);
     bool initLedger(dev::GROUP_ID const& _groupId, std::string const& _dataDir = "data",
@@ -88,6 +101,13 @@ private:
     KeyPair m_keyPair;
     std::string m_groupDataDir;
     std::string m_groupConfigPath;
+
+    size_t m_initParallelism = 1;
+    std::set<dev::GROUP_ID> m_coldGroupIDs;
+    Mutex x_coldGroups;
+    // groupID => the genesis config file of the cold groups not initialized
+    std::map<dev::GROUP_ID, std::string> m_coldGroupConfigs;
+    std::map<dev::GROUP_ID, std::shared_future<void>> m_loadingColdGroups;
 };
 
 }  // namespace initializer
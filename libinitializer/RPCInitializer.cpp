@@ -212,6 +212,7 @@ void RPCInitializer::initConfig(boost::property_tree::ptree const& _pt)
                               << LOG_KV("jsonrpc_IP", listenIP)
                               << LOG_KV("jsonrpc_listen_port", httpListenPort)
                               << LOG_KV("ipv6", ipAddress.is_v6());
+        initMetricsHttpServer(_pt);
     }
     catch (std::exception& e)
     {
@@ -230,6 +231,33 @@ void RPCInitializer::initConfig(boost::property_tree::ptree const& _pt)
     }
 }
 
+/// the metrics are served to the local Prometheus only if rpc.metrics_listen_port is set
+void RPCInitializer::initMetricsHttpServer(boost::property_tree::ptree const& _pt)
+{
+    int metricsListenPort = _pt.get<int>("rpc.metrics_listen_port", 0);
+    if (metricsListenPort == 0)
+    {
+        return;
+    }
+    std::string metricsListenIP = _pt.get<std::string>("rpc.metrics_listen_ip", "127.0.0.1");
+    if (!isValidPort(metricsListenPort))
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
+                                  "Invalid rpc.metrics_listen_port " +
+                                  std::to_string(metricsListenPort)));
+    }
+    m_metricsHttpServer = std::make_shared<MetricsHttpServer>(metricsListenIP, metricsListenPort);
+    if (!m_metricsHttpServer->startListening())
+    {
+        INITIALIZER_LOG(ERROR) << LOG_BADGE("RPCInitializer")
+                               << LOG_KV("check metrics_listen_port", metricsListenPort);
+        BOOST_THROW_EXCEPTION(ListenPortIsUsed());
+    }
+    INITIALIZER_LOG(INFO) << LOG_BADGE("RPCInitializer MetricsHttpServer started")
+                          << LOG_KV("metrics_IP", metricsListenIP)
+                          << LOG_KV("metrics_listen_port", metricsListenPort);
+}
+
 dev::stat::ChannelNetworkStatHandler::Ptr RPCInitializer::createNetWorkStatHandler(
     boost::property_tree::ptree const& _pt)
 {
@@ -23,6 +23,7 @@
 #pragma once
 #include "Common.h"  // for INITIALIZER_LOG
 #include "LedgerInitializer.h"
+#include "librpc/MetricsHttpServer.h"           // for MetricsHttpServer
 #include "librpc/ModularServer.h"               // for ModularServer
 #include <libchannelserver/ChannelRPCServer.h>  // for ChannelRPCServer
 #include <boost/property_tree/ptree_fwd.hpp>    // for ptree
@@ -91,6 +92,12 @@ public:
             m_jsonrpcHttpServer = nullptr;
             INITIALIZER_LOG(INFO) << "JsonrpcHttpServer deleted.";
         }
+        if (m_metricsHttpServer)
+        {
+            m_metricsHttpServer->stopListening();
+            m_metricsHttpServer.reset();
+            INITIALIZER_LOG(INFO) << "MetricsHttpServer stopped.";
+        }
     }
 
     void initChannelRPCServer(boost::property_tree::ptree const& _pt);
@@ -124,6 +131,8 @@ private:
     dev::flowlimit::RateLimiter::Ptr createNetworkBandwidthLimit(
         boost::property_tree::ptree const& _pt);
 
+    void initMetricsHttpServer(boost::property_tree::ptree const& _pt);
+
 private:
     std::shared_ptr<p2p::P2PInterface> m_p2pService;
     std::shared_ptr<ledger::LedgerManager> m_ledgerManager;
@@ -134,6 +143,7 @@ private:
     ChannelRPCServer::Ptr m_channelRPCServer;
     ModularServer<>* m_channelRPCHttpServer;
     ModularServer<>* m_jsonrpcHttpServer;
+    dev::MetricsHttpServer::Ptr m_metricsHttpServer;
     dev::stat::ChannelNetworkStatHandler::Ptr m_networkStatHandler;
 };
 
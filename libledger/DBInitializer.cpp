@@ -254,14 +254,21 @@ void DBInitializer::initTableFactory2(
         cachedStorage->setBackend(_backend);
         cachedStorage->setMaxCapacity(
             _param->mutableStorageParam().maxCapacity * 1024 * 1024);  // Bytes
+        cachedStorage->setMaxCompressedCapacity(
+            _param->mutableStorageParam().maxCompressedCapacity * 1024 * 1024);  // Bytes
         cachedStorage->setMaxForwardBlock(_param->mutableStorageParam().maxForwardBlock);
+        cachedStorage->setMaxBatchBlock(_param->mutableStorageParam().maxBatchBlock);
         cachedStorage->init();
         backendStorage = cachedStorage;
         m_cacheStorage = cachedStorage;
         DBInitializer_LOG(INFO) << LOG_BADGE("init CachedStorage")
                                 << LOG_KV("maxCapacity", _param->mutableStorageParam().maxCapacity)
+                                << LOG_KV("maxCompressedCapacity",
+                                       _param->mutableStorageParam().maxCompressedCapacity)
                                 << LOG_KV("maxForwardBlock",
-                                       _param->mutableStorageParam().maxForwardBlock);
+                                       _param->mutableStorageParam().maxForwardBlock)
+                                << LOG_KV("maxBatchBlock",
+                                       _param->mutableStorageParam().maxBatchBlock);
     }
 
     auto tableFactoryFactory = std::make_shared<dev::storage::MemoryTableFactoryFactory2>();
@@ -565,6 +572,7 @@ dev::storage::Storage::Ptr dev::ledger::createZdbStorage(
     sqlconnpool->InitConnectionPool(connectionConfig);
 
     auto sqlAccess = std::make_shared<SQLBasicAccess>();
+    sqlAccess->setCommitConnections(_param->mutableStorageParam().commitConnections);
     zdbStorage->SetSqlAccess(sqlAccess);
     zdbStorage->setConnPool(sqlconnpool);
 
@@ -55,11 +55,13 @@ bool Ledger::initLedger(std::shared_ptr<LedgerParamInterface> _ledgerParams)
 {
     BOOST_LOG_SCOPED_THREAD_ATTR(
         "GroupId", boost::log::attributes::constant<std::string>(std::to_string(m_groupId)));
+    ScopedLogGroupId scopedGroupId(std::to_string(m_groupId));
     if (!_ledgerParams)
     {
         return false;
     }
     m_param = _ledgerParams;
+    auto startTime = utcSteadyTime();
     /// init dbInitializer
     Ledger_LOG(INFO) << LOG_BADGE("initLedger") << LOG_BADGE("DBInitializer");
     m_dbInitializer = std::make_shared<dev::ledger::DBInitializer>(m_param, m_groupId);
@@ -71,10 +73,12 @@ bool Ledger::initLedger(std::shared_ptr<LedgerParamInterface> _ledgerParams)
     if (!m_dbInitializer)
         return false;
     m_dbInitializer->initStorageDB();
+    auto storageTime = utcSteadyTime();
     /// init the DB
     bool ret = initBlockChain();
     if (!ret)
         return false;
+    auto blockChainTime = utcSteadyTime();
     dev::h256 genesisHash = m_blockChain->getBlockByNumber(0)->headerHash();
     m_dbInitializer->initState(genesisHash);
     if (!m_dbInitializer->stateFactory())
@@ -108,9 +112,18 @@ bool Ledger::initLedger(std::shared_ptr<LedgerParamInterface> _ledgerParams)
 
     initNetworkBandWidthLimiter();
     initQPSLimit();
+    auto stateTime = utcSteadyTime();
     /// init blockVerifier, txPool, sync and consensus
-    return (initBlockVerifier() && initTxPool() && initSync() && consensusInitFactory() &&
-            initEventLogFilterManager());
+    ret = (initBlockVerifier() && initTxPool() && initSync() && consensusInitFactory() &&
+           initEventLogFilterManager());
+    auto endTime = utcSteadyTime();
+    Ledger_LOG(INFO) << LOG_BADGE("initLedger") << LOG_DESC("init phases time cost")
+                     << LOG_KV("ret", ret) << LOG_KV("storageCost", storageTime - startTime)
+                     << LOG_KV("blockChainCost", blockChainTime - storageTime)
+                     << LOG_KV("stateCost", stateTime - blockChainTime)
+                     << LOG_KV("modulesCost", endTime - stateTime)
+                     << LOG_KV("totalCost", endTime - startTime);
+    return ret;
 }
 
 void Ledger::reloadSDKAllowList()
@@ -256,6 +269,7 @@ bool Ledger::initBlockVerifier()
         std::dynamic_pointer_cast<BlockChainImp>(m_blockChain);
     blockVerifier->setNumberHash(boost::bind(&BlockChainImp::numberHash, blockChain, _1));
     blockVerifier->setEvmFlags(m_param->mutableGenesisParam().evmFlags);
+    blockVerifier->setEnableBlockArena(m_param->mutableTxParam().enableBlockArena);
 
     m_blockVerifier = blockVerifier;
     Ledger_LOG(INFO) << LOG_BADGE("initLedger") << LOG_BADGE("initBlockVerifier SUCC")
@@ -519,6 +533,11 @@ bool Ledger::consensusInitFactory()
         BOOST_THROW_EXCEPTION(
             dev::InitLedgerConfigFailed() << errinfo_comment("create sealer failed"));
     }
+    if (m_param->mutableTxParam().conflictAwarePacking)
+    {
+        m_sealer->enableConflictAwarePacking(
+            m_blockVerifier, m_param->mutableTxParam().maxPackingDelay);
+    }
     // set nodeTimeMaintenance
     m_sealer->consensusEngine()->setNodeTimeMaintenance(m_nodeTimeMaintenance);
     // create blockFactory
@@ -578,6 +597,9 @@ bool Ledger::initSync()
     // set the max block queue size for sync module(bytes)
     syncMaster->setMaxBlockQueueSize(m_param->mutableSyncParam().maxQueueSizeForBlockSync);
     syncMaster->setTxsStatusGossipMaxPeers(m_param->mutableSyncParam().txsStatusGossipMaxPeers);
+    syncMaster->setTxsReconcileInterval(m_param->mutableSyncParam().txsReconcileInterval);
+    syncMaster->setBlockChunkSize(m_param->mutableSyncParam().blockChunkSize);
+    syncMaster->setPeerUploadBandwidthLimit(m_param->mutableSyncParam().peerUploadBandwidthLimit);
     // set networkBandwidthLimiter
     if (m_networkBandwidthLimiter)
     {
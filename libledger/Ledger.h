@@ -86,6 +86,7 @@ public:
         /// tag this scope with GroupId
         BOOST_LOG_SCOPED_THREAD_ATTR(
             "GroupId", boost::log::attributes::constant<std::string>(std::to_string(m_groupId)));
+        ScopedLogGroupId scopedGroupId(std::to_string(m_groupId));
         Ledger_LOG(INFO) << LOG_DESC("startAll...");
 
         m_txPool->registerSyncStatusChecker([this]() {
@@ -250,7 +250,13 @@ string LedgerManager::generateGroupConfig()
         "    cached_storage=true\n"
         "    ; max cache memeory, MB\n"
         "    max_capacity=32\n"
+        "    ; max memory of the compressed cache for the evicted entries, MB, 0 means disabled\n"
+        "    max_compressed_capacity=0\n"
         "    max_forward_block=10\n"
+        "    ; max blocks merged into one commit of mysql, only for mysql\n"
+        "    max_batch_block=10\n"
+        "    ; max connections committing the tables of a block in parallel, only for mysql\n"
+        "    commit_connections=4\n"
         "    ; only for external, deprecated in v2.3.0\n"
         "    max_retry=60\n"
         "    topic=DB\n"
@@ -282,6 +288,15 @@ string LedgerManager::generateGroupConfig()
         "    gossip_peers_number=3\n"
         "    ; max number of nodes that broadcast txs status to, recommended less than 5\n"
         "    txs_max_gossip_peers_num=5\n"
+        "    ; reconcile the pending txs with one consensus node every interval instead of\n"
+        "    ; gossiping the txs status, 0 means disabled, must between 100 to 60000 if enabled\n"
+        "    ;txs_reconcile_interval_ms=500\n"
+        "    ; request the blocks streamed in chunks of the size, 0 means disabled, must between\n"
+        "    ; 16 to 512 if enabled, all the nodes of the group must support it\n"
+        "    ;block_chunk_size_kb=256\n"
+        "    ; the upload bandwidth limit(Mbit/s) of responding blocks to every peer, 0 means\n"
+        "    ; unlimited\n"
+        "    ;peer_upload_bandwidth_limit=10\n"
         "[flow_control]\n"
         "    ; restrict QPS of the group\n"
         "    ;limit_req=1000\n"
@@ -361,7 +376,9 @@ void LedgerManager::recoverByGroupID(dev::GROUP_ID const& _groupID)
 
 std::set<dev::GROUP_ID> LedgerManager::getGroupListForRpc() const
 {
-    std::set<dev::GROUP_ID> groupList;
+    RecursiveGuard l(x_ledgerManager);
+    // the cold groups are listed so that the clients can access and wake them up
+    std::set<dev::GROUP_ID> groupList = m_coldGroups;
     for (auto const& ledger : m_ledgerMap)
     {
         // check sealer list
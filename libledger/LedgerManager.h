@@ -26,6 +26,7 @@
 #include "Ledger.h"
 #include "LedgerInterface.h"
 #include <libethcore/Protocol.h>
+#include <functional>
 #include <map>
 #include <set>
 #include <string>
@@ -73,6 +74,7 @@ public:
         if (ret.second)
         {
             m_groupListCache.insert(_groupId);
+            m_coldGroups.erase(_groupId);
         }
 
         return ret.second;
@@ -158,8 +160,11 @@ public:
         {
             if (!item.second)
                 continue;
+            auto startTime = utcSteadyTime();
             item.second->startAll();
             setGroupStatus(item.first, LedgerStatus::RUNNING);
+            LedgerManager_LOG(INFO) << LOG_DESC("start group") << LOG_KV("groupID", item.first)
+                                    << LOG_KV("timeCost", utcSteadyTime() - startTime);
         }
     }
     /// stop all the ledgers that have been started
@@ -176,25 +181,37 @@ public:
     /// get pointer of txPool by group id
     std::shared_ptr<dev::txpool::TxPoolInterface> txPool(dev::GROUP_ID const& groupId)
     {
-        RecursiveGuard l(x_ledgerManager);
-        if (!m_ledgerMap.count(groupId))
-            return nullptr;
-        return m_ledgerMap[groupId]->txPool();
+        auto groupLedger = ledger(groupId);
+        return groupLedger ? groupLedger->txPool() : nullptr;
     }
 
     /// get pointer of blockverifier by group id
     std::shared_ptr<dev::blockverifier::BlockVerifierInterface> blockVerifier(
         dev::GROUP_ID const& groupId)
     {
-        RecursiveGuard l(x_ledgerManager);
-        if (!m_ledgerMap.count(groupId))
-            return nullptr;
-        return m_ledgerMap[groupId]->blockVerifier();
+        auto groupLedger = ledger(groupId);
+        return groupLedger ? groupLedger->blockVerifier() : nullptr;
     }
 
-    /// get ledger
+    /// get ledger, the cold group is initialized on the first access
     std::shared_ptr<LedgerInterface> ledger(dev::GROUP_ID const& groupId)
     {
+        std::function<void(dev::GROUP_ID const&)> coldGroupLoader;
+        {
+            RecursiveGuard l(x_ledgerManager);
+            auto it = m_ledgerMap.find(groupId);
+            if (it != m_ledgerMap.end())
+            {
+                return it->second;
+            }
+            if (!m_coldGroups.count(groupId) || !m_coldGroupLoader)
+            {
+                return nullptr;
+            }
+            coldGroupLoader = m_coldGroupLoader;
+        }
+        // wait for the initialization without the lock
+        coldGroupLoader(groupId);
         RecursiveGuard l(x_ledgerManager);
         auto it = m_ledgerMap.find(groupId);
         return (it == m_ledgerMap.end() ? nullptr : it->second);
@@ -203,34 +220,48 @@ public:
     /// get pointer of blockchain by group id
     std::shared_ptr<dev::blockchain::BlockChainInterface> blockChain(dev::GROUP_ID const& groupId)
     {
-        RecursiveGuard l(x_ledgerManager);
-        if (!m_ledgerMap.count(groupId))
-            return nullptr;
-        return m_ledgerMap[groupId]->blockChain();
+        auto groupLedger = ledger(groupId);
+        return groupLedger ? groupLedger->blockChain() : nullptr;
     }
     /// get pointer of consensus by group id
     std::shared_ptr<dev::consensus::ConsensusInterface> consensus(dev::GROUP_ID const& groupId)
     {
-        RecursiveGuard l(x_ledgerManager);
-        if (!m_ledgerMap.count(groupId))
-            return nullptr;
-        return m_ledgerMap[groupId]->consensus();
+        auto groupLedger = ledger(groupId);
+        return groupLedger ? groupLedger->consensus() : nullptr;
     }
     /// get pointer of blocksync by group id
     std::shared_ptr<dev::sync::SyncInterface> sync(dev::GROUP_ID const& groupId)
     {
-        RecursiveGuard l(x_ledgerManager);
-        if (!m_ledgerMap.count(groupId))
-            return nullptr;
-        return m_ledgerMap[groupId]->sync();
+        auto groupLedger = ledger(groupId);
+        return groupLedger ? groupLedger->sync() : nullptr;
     }
     /// get ledger params by group id
     std::shared_ptr<LedgerParamInterface> getParamByGroupId(dev::GROUP_ID const& groupId)
+    {
+        auto groupLedger = ledger(groupId);
+        return groupLedger ? groupLedger->getParam() : nullptr;
+    }
+
+    /**
+     * @brief: the cold group is not initialized at startup, its storage is opened on the first
+     * access by RPC, P2P or consensus
+     * @param _loader: initialize and start the cold group, returns after the group started or
+     * failed
+     */
+    void setColdGroupLoader(std::function<void(dev::GROUP_ID const&)> _loader)
+    {
+        RecursiveGuard l(x_ledgerManager);
+        m_coldGroupLoader = _loader;
+    }
+    void addColdGroup(dev::GROUP_ID const& _groupId)
     {
         RecursiveGuard l(x_ledgerManager);
-        if (!m_ledgerMap.count(groupId))
-            return nullptr;
-        return m_ledgerMap[groupId]->getParam();
+        m_coldGroups.insert(_groupId);
+    }
+    bool isColdGroup(dev::GROUP_ID const& _groupId) const
+    {
+        RecursiveGuard l(x_ledgerManager);
+        return m_coldGroups.count(_groupId) != 0;
     }
 
     std::set<dev::GROUP_ID> getGroupListForRpc() const;
@@ -254,6 +285,10 @@ private:
 
     /// map used to store the mappings between groupId and created ledger objects
     std::map<dev::GROUP_ID, std::shared_ptr<LedgerInterface>> m_ledgerMap;
+
+    /// the groups not initialized yet
+    std::set<dev::GROUP_ID> m_coldGroups;
+    std::function<void(dev::GROUP_ID const&)> m_coldGroupLoader;
 };
 }  // namespace ledger
 }  // namespace dev
@@ -202,8 +202,23 @@ void LedgerParam::initTxExecuteConfig(ptree const& pt)
     {
         mutableTxParam().enableParallel = false;
     }
+    if (mutableTxParam().enableParallel)
+    {
+        mutableTxParam().conflictAwarePacking =
+            pt.get<bool>("tx_execute.conflict_aware_packing", false);
+        mutableTxParam().maxPackingDelay = pt.get<int64_t>("tx_execute.max_packing_delay", 1000);
+        if (mutableTxParam().maxPackingDelay < 0)
+        {
+            BOOST_THROW_EXCEPTION(ForbidNegativeValue() << errinfo_comment(
+                                      "Please set tx_execute.max_packing_delay to positive !"));
+        }
+    }
+    mutableTxParam().enableBlockArena = pt.get<bool>("tx_execute.enable_block_arena", true);
     LedgerParam_LOG(INFO) << LOG_BADGE("InitTxExecuteConfig")
-                          << LOG_KV("enableParallel", mutableTxParam().enableParallel);
+                          << LOG_KV("enableParallel", mutableTxParam().enableParallel)
+                          << LOG_KV("conflictAwarePacking", mutableTxParam().conflictAwarePacking)
+                          << LOG_KV("maxPackingDelay", mutableTxParam().maxPackingDelay)
+                          << LOG_KV("enableBlockArena", mutableTxParam().enableBlockArena);
 }
 
 void LedgerParam::initTxPoolConfig(ptree const& pt)
@@ -541,6 +556,31 @@ void LedgerParam::initSyncConfig(ptree const& pt)
         BOOST_THROW_EXCEPTION(InvalidConfiguration() << errinfo_comment(
                                   "txs_gossip_max_peers_num must be no smaller than zero"));
     }
+    mutableSyncParam().txsReconcileInterval = pt.get<int64_t>("sync.txs_reconcile_interval_ms", 0);
+    if (mutableSyncParam().txsReconcileInterval != 0 &&
+        (mutableSyncParam().txsReconcileInterval < 100 ||
+            mutableSyncParam().txsReconcileInterval > 60000))
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfiguration() << errinfo_comment(
+                                  "txs_reconcile_interval_ms must be 0 or between 100 to 60000"));
+    }
+    auto blockChunkSize = pt.get<int64_t>("sync.block_chunk_size_kb", 0);
+    if (blockChunkSize != 0 && (blockChunkSize < 16 || blockChunkSize > 512))
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfiguration() << errinfo_comment(
+                                  "block_chunk_size_kb must be 0 or between 16 to 512"));
+    }
+    mutableSyncParam().blockChunkSize = blockChunkSize * 1024;
+    auto peerUploadBandwidth = pt.get<double>("sync.peer_upload_bandwidth_limit", 0);
+    if (peerUploadBandwidth < 0 || peerUploadBandwidth >= (double)MAX_VALUE_IN_Mb)
+    {
+        BOOST_THROW_EXCEPTION(
+            InvalidConfiguration() << errinfo_comment(
+                "sync.peer_upload_bandwidth_limit must be no smaller than 0 and smaller than " +
+                std::to_string(MAX_VALUE_IN_Mb)));
+    }
+    // convert Mbit/s to bytes/s
+    mutableSyncParam().peerUploadBandwidthLimit = (int64_t)(peerUploadBandwidth * 1024 * 1024 / 8);
     mutableSyncParam().maxQueueSizeForBlockSync *= 1024 * 1024;
 
     LedgerParam_LOG(INFO)
@@ -550,7 +590,10 @@ void LedgerParam::initSyncConfig(ptree const& pt)
         << LOG_KV("gossipPeers", mutableSyncParam().gossipPeers)
         << LOG_KV("syncTreeWidth", mutableSyncParam().syncTreeWidth)
         << LOG_KV("maxQueueSizeForBlockSync", mutableSyncParam().maxQueueSizeForBlockSync)
-        << LOG_KV("txsStatusGossipMaxPeers", mutableSyncParam().txsStatusGossipMaxPeers);
+        << LOG_KV("txsStatusGossipMaxPeers", mutableSyncParam().txsStatusGossipMaxPeers)
+        << LOG_KV("txsReconcileInterval", mutableSyncParam().txsReconcileInterval)
+        << LOG_KV("blockChunkSize", mutableSyncParam().blockChunkSize)
+        << LOG_KV("peerUploadBandwidthLimit", mutableSyncParam().peerUploadBandwidthLimit);
 }
 
 std::string LedgerParam::uriEncode(const std::string& keyWord)
@@ -610,11 +653,23 @@ void LedgerParam::initStorageConfig(ptree const& pt)
                                   std::to_string(MAX_VALUE_IN_MB)));
     }
 
+    mutableStorageParam().maxCompressedCapacity =
+        pt.get<int>("storage.max_compressed_capacity", 0);
+    if (mutableStorageParam().maxCompressedCapacity < 0 ||
+        mutableStorageParam().maxCompressedCapacity >= MAX_VALUE_IN_MB)
+    {
+        BOOST_THROW_EXCEPTION(
+            InvalidConfiguration() << errinfo_comment(
+                "storage.max_compressed_capacity must be no less than 0 and smaller than " +
+                std::to_string(MAX_VALUE_IN_MB)));
+    }
+
     auto scrollThresholdMultiple = pt.get<uint>("storage.scroll_threshold_multiple", 2);
     mutableStorageParam().scrollThreshold =
         scrollThresholdMultiple > 0 ? scrollThresholdMultiple * g_BCOSConfig.c_blockLimit : 2000;
 
     mutableStorageParam().maxForwardBlock = pt.get<uint>("storage.max_forward_block", 10);
+    mutableStorageParam().maxBatchBlock = pt.get<uint>("storage.max_batch_block", 10);
 
     if (mutableStorageParam().maxRetry <= 1)
     {
@@ -631,6 +686,11 @@ void LedgerParam::initStorageConfig(ptree const& pt)
     mutableStorageParam().dbCharset = pt.get<std::string>("storage.db_charset", "utf8mb4");
     mutableStorageParam().initConnections = pt.get<int>("storage.init_connections", 15);
     mutableStorageParam().maxConnections = pt.get<int>("storage.max_connections", 50);
+    // keep at least one connection for the select
+    mutableStorageParam().commitConnections =
+        std::max(std::min(pt.get<uint>("storage.commit_connections", 4),
+                     mutableStorageParam().maxConnections - 1),
+            (uint32_t)1);
 
     LedgerParam_LOG(INFO) << LOG_BADGE("initStorageConfig")
                           << LOG_KV("stateType", mutableStateParam().type)
@@ -643,6 +703,7 @@ void LedgerParam::initStorageConfig(ptree const& pt)
                           << LOG_KV("dbcharset", mutableStorageParam().dbCharset)
                           << LOG_KV("initconnections", mutableStorageParam().initConnections)
                           << LOG_KV("maxconnections", mutableStorageParam().maxConnections)
+                          << LOG_KV("commitConnections", mutableStorageParam().commitConnections)
                           << LOG_KV("scrollThreshold", mutableStorageParam().scrollThreshold);
 }
 
@@ -114,6 +114,12 @@ struct SyncParam
     int64_t maxQueueSizeForBlockSync = 512 * 1024 * 1024;
     // limit the peers number the txs-status gossip to
     signed txsStatusGossipMaxPeers = 5;
+    // reconcile the pending txs with the peers every interval, 0 means disabled
+    int64_t txsReconcileInterval = 0;
+    // request the blocks streamed in chunks of the size(bytes), 0 means disabled
+    unsigned blockChunkSize = 0;
+    // the upload bandwidth(bytes/s) of responding blocks to every peer, 0 means unlimited
+    int64_t peerUploadBandwidthLimit = 0;
 };
 
 /// modification 2019.03.20: add timeStamp field to GenesisParam
@@ -144,6 +150,8 @@ struct StorageParam
     int maxRetry;
     // MB
     int64_t maxCapacity;
+    // MB, 0 means the compressed cache is disabled
+    int64_t maxCompressedCapacity = 0;
 
     int64_t scrollThreshold = 2000;
     // for zdb storage
@@ -157,6 +165,10 @@ struct StorageParam
     uint32_t initConnections;
     uint32_t maxConnections;
     int maxForwardBlock;
+    // the max blocks merged into one commit of mysql
+    int maxBatchBlock = 10;
+    // the max connections committing the tables of a block in parallel
+    uint32_t commitConnections = 4;
 };
 struct StateParam
 {
@@ -166,6 +178,12 @@ struct TxParam
 {
     int64_t txGasLimit;
     bool enableParallel = false;
+    /// pack the transactions according to the TxDAG, only when enableParallel is true
+    bool conflictAwarePacking = false;
+    /// milliseconds, the transactions waited longer are packed regardless of the conflicts
+    int64_t maxPackingDelay = 1000;
+    /// allocate the objects dying with the executed block in a per-block arena
+    bool enableBlockArena = true;
 };
 
 struct FlowControlParam
@@ -129,8 +129,9 @@ public:
 #endif
     virtual void asyncResolveConnect(std::shared_ptr<SocketFace> socket, Handler_Type handler);
 
+    /// write the buffers by scatter-gather, the buffers must be alive until the handler is called
     virtual void asyncWrite(std::shared_ptr<SocketFace> socket,
-        boost::asio::mutable_buffers_1 buffers, ReadWriteHandler handler)
+        std::vector<boost::asio::const_buffer> buffers, ReadWriteHandler handler)
     {
         auto type = m_type;
         m_ioService->post([type, socket, buffers, handler]() {
@@ -116,6 +116,18 @@ struct NodeInfo
     std::string nodeName;
 };
 
+/// the encoded message written by scatter-gather, the small header is built for every sending
+/// and the payload is shared by all the sessions the message is sent to
+struct EncodedMessage
+{
+    typedef std::shared_ptr<EncodedMessage> Ptr;
+
+    bytes header;
+    std::shared_ptr<const bytes> payload;
+
+    size_t size() const { return header.size() + (payload ? payload->size() : 0); }
+};
+
 class Message : public std::enable_shared_from_this<Message>
 {
 public:
@@ -130,6 +142,15 @@ public:
 
     virtual void encode(bytes& buffer) = 0;
     virtual ssize_t decode(const byte* buffer, size_t size) = 0;
+
+    /// the payload must not be modified after sending, the default one copies the whole message
+    /// into the header
+    virtual EncodedMessage::Ptr encodedMessage()
+    {
+        auto encodedMessage = std::make_shared<EncodedMessage>();
+        encode(encodedMessage->header);
+        return encodedMessage;
+    }
 };
 
 class MessageFactory : public std::enable_shared_from_this<MessageFactory>
@@ -28,6 +28,7 @@
 #include "Host.h"                    // for Host
 #include "SocketFace.h"              // for Socket...
 #include "libdevcore/Guards.h"       // for Guard
+#include "libdevcore/Metrics.h"      // for MetricsRegistry
 #include "libdevcore/ThreadPool.h"   // for Thread...
 #include "libnetwork/SessionFace.h"  // for Respon...
 #include <chrono>
@@ -35,6 +36,23 @@
 using namespace dev;
 using namespace dev::network;
 
+namespace
+{
+MetricGauge& writeQueueMetric()
+{
+    static auto gauge = MetricsRegistry::instance().gauge(
+        "bcos_network_write_queue_size", "messages waiting in the write queues of the sessions");
+    return *gauge;
+}
+
+MetricHistogram& writeWaitMetric()
+{
+    static auto histogram = MetricsRegistry::instance().histogram("bcos_network_write_wait_ms",
+        "time of the messages waiting in the write queue in milliseconds");
+    return *histogram;
+}
+}  // namespace
+
 Session::Session(size_t _bufferSize) : bufferSize(_bufferSize)
 {
     m_recvBuffer.resize(bufferSize);
@@ -60,6 +78,7 @@ Session::~Session()
     {
         SESSION_LOG(ERROR) << "Deconstruct Session exception";
     }
+    writeQueueMetric().add(-(int64_t)m_writeQueue.size());
 }
 
 NodeIPEndpoint Session::nodeIPEndpoint() const
@@ -108,12 +127,17 @@ void Session::asyncSendMessage(Message::Ptr message, Options options, CallbackFu
     SESSION_LOG(TRACE) << LOG_DESC("Session asyncSendMessage")
                        << LOG_KV("seq2Callback.size", m_seq2Callback->size())
                        << LOG_KV("endpoint", nodeIPEndpoint());
-    std::shared_ptr<bytes> p_buffer = std::make_shared<bytes>();
-    message->encode(*p_buffer);
-    send(p_buffer);
+    send(message->encodedMessage());
 }
 
 void Session::send(std::shared_ptr<bytes> _msg)
+{
+    auto encodedMessage = std::make_shared<EncodedMessage>();
+    encodedMessage->payload = _msg;
+    send(encodedMessage);
+}
+
+void Session::send(EncodedMessage::Ptr _msg)
 {
     if (!actived())
     {
@@ -129,11 +153,12 @@ void Session::send(std::shared_ptr<bytes> _msg)
 
         m_writeQueue.push(make_pair(_msg, u256(utcTime())));
     }
+    writeQueueMetric().add(1);
 
     write();
 }
 
-void Session::onWrite(boost::system::error_code ec, std::size_t, std::shared_ptr<bytes>)
+void Session::onWrite(boost::system::error_code ec, std::size_t, EncodedMessage::Ptr)
 {
     if (!actived())
     {
@@ -186,7 +211,7 @@ void Session::write()
 
         m_writing = true;
 
-        std::pair<std::shared_ptr<bytes>, u256> task;
+        std::pair<EncodedMessage::Ptr, u256> task;
         u256 enter_time = u256(0);
 
         if (m_writeQueue.empty())
@@ -197,10 +222,14 @@ void Session::write()
 
         task = m_writeQueue.top();
         m_writeQueue.pop();
+        writeQueueMetric().add(-1);
+        auto now = utcTime();
+        auto enqueueTime = (uint64_t)task.second;
+        writeWaitMetric().observe(now > enqueueTime ? now - enqueueTime : 0);
 
         enter_time = task.second;
         auto session = shared_from_this();
-        auto buffer = task.first;
+        auto encodedMessage = task.first;
 
         auto server = m_server.lock();
         if (server && server->haveNetwork())
@@ -208,9 +237,18 @@ void Session::write()
             if (m_socket->isConnected())
             {
                 // asio::buffer referecne buffer, so buffer need alive before asio::buffer be used
-                server->asioInterface()->asyncWrite(m_socket, boost::asio::buffer(*buffer),
+                std::vector<boost::asio::const_buffer> buffers;
+                if (!encodedMessage->header.empty())
+                {
+                    buffers.push_back(boost::asio::buffer(encodedMessage->header));
+                }
+                if (encodedMessage->payload && !encodedMessage->payload->empty())
+                {
+                    buffers.push_back(boost::asio::buffer(*(encodedMessage->payload)));
+                }
+                server->asioInterface()->asyncWrite(m_socket, buffers,
                     boost::bind(&Session::onWrite, session, boost::asio::placeholders::error,
-                        boost::asio::placeholders::bytes_transferred, buffer));
+                        boost::asio::placeholders::bytes_transferred, encodedMessage));
             }
             else
             {
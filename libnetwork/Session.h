@@ -116,6 +116,7 @@ public:
 
 private:
     void send(std::shared_ptr<bytes> _msg);
+    void send(EncodedMessage::Ptr _msg);
 
     void doRead();
     std::vector<byte> m_data;  ///< Buffer for ingress packet data.
@@ -132,7 +133,8 @@ private:
 
     /// Perform a single round of the write operation. This could end up calling itself
     /// asynchronously.
-    void onWrite(boost::system::error_code ec, std::size_t length, std::shared_ptr<bytes> buffer);
+    void onWrite(
+        boost::system::error_code ec, std::size_t length, EncodedMessage::Ptr encodedMessage);
     void write();
 
     /// call by doRead() to deal with mesage
@@ -146,14 +148,14 @@ private:
     class QueueCompare
     {
     public:
-        bool operator()(const std::pair<std::shared_ptr<bytes>, u256>&,
-            const std::pair<std::shared_ptr<bytes>, u256>&) const
+        bool operator()(const std::pair<EncodedMessage::Ptr, u256>&,
+            const std::pair<EncodedMessage::Ptr, u256>&) const
         {
             return false;
         }
     };
 
-    boost::heap::priority_queue<std::pair<std::shared_ptr<bytes>, u256>,
+    boost::heap::priority_queue<std::pair<EncodedMessage::Ptr, u256>,
         boost::heap::compare<QueueCompare>, boost::heap::stable<true>>
         m_writeQueue;
     std::atomic_bool m_writing = {false};
@@ -118,6 +118,8 @@ public:
     virtual void removeGroupBandwidthLimiter(GROUP_ID const&) {}
     virtual void setChannelNetworkStatHandler(std::shared_ptr<dev::stat::ChannelNetworkStatHandler>)
     {}
+    /// called with the group id when no handler is registered for the request of the group
+    virtual void setUnknownGroupHandler(std::function<void(GROUP_ID const&)>) {}
 };
 
 }  // namespace p2p
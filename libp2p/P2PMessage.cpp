@@ -43,6 +43,26 @@ void P2PMessage::encode(bytes& buffer)
     buffer.insert(buffer.end(), m_buffer->begin(), m_buffer->end());
 }
 
+dev::network::EncodedMessage::Ptr P2PMessage::encodedMessage()
+{
+    auto encodedMessage = std::make_shared<dev::network::EncodedMessage>();
+    m_length = HEADER_LENGTH + m_buffer->size();
+
+    uint32_t length = htonl(m_length);
+    PROTOCOL_ID protocolID = htons(m_protocolID);
+    PACKET_TYPE packetType = htons(m_packetType);
+    uint32_t seq = htonl(m_seq);
+
+    auto& header = encodedMessage->header;
+    header.reserve(HEADER_LENGTH);
+    header.insert(header.end(), (byte*)&length, (byte*)&length + 4);
+    header.insert(header.end(), (byte*)&protocolID, (byte*)&protocolID + 2);
+    header.insert(header.end(), (byte*)&packetType, (byte*)&packetType + 2);
+    header.insert(header.end(), (byte*)&seq, (byte*)&seq + 4);
+    encodedMessage->payload = m_buffer;
+    return encodedMessage;
+}
+
 ssize_t P2PMessage::decode(const byte* buffer, size_t size)
 {
     if (size < HEADER_LENGTH)
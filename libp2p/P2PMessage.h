@@ -74,6 +74,8 @@ public:
     virtual bool isRequestPacket() override { return !((m_protocolID & 0x8000) == 0x8000); }
 
     virtual void encode(bytes& buffer) override;
+    /// the header is encoded for every sending, the payload shares m_buffer
+    dev::network::EncodedMessage::Ptr encodedMessage() override;
 
     /// < If the decoding is successful, the length of the decoded data is returned; otherwise, 0 is
     /// returned.
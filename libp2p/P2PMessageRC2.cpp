@@ -30,48 +30,48 @@ using namespace dev::compress;
 
 void P2PMessageRC2::encode(bytes& buffer)
 {
-    /// re-encode when m_cache is dirty
-    if (dirty())
-    {
-        std::shared_ptr<bytes> compressData = std::make_shared<bytes>();
-        /// compress success
-        if (compress(compressData))
-        {
-            encode(compressData);
-        }
-        else
-        {
-            encode(m_buffer);
-        }
-    }
-    buffer = *m_cache;
-    m_deliveredLength = buffer.size();
+    auto encodedMessage = this->encodedMessage();
+    buffer = encodedMessage->header;
+    buffer.insert(buffer.end(), encodedMessage->payload->begin(), encodedMessage->payload->end());
 }
 
 /**
- * @brief: encode the message into bytes to send
- * @param buffer: the encoded data
- * @param encodeBuffer: the message should be encoded
- * @param protocol: the protocol ID that should be encoded into the buffer
+ * @brief: encode the header of the message for every sending, the payload is compressed only once
+ * and shared by all the sessions, so that the seq can be updated without compressing again
+ * @return the header and the payload to be written by scatter-gather
  */
-void P2PMessageRC2::encode(std::shared_ptr<bytes> encodeBuffer)
+dev::network::EncodedMessage::Ptr P2PMessageRC2::encodedMessage()
 {
-    m_cache->clear();  ///< It is not allowed to be assembled outside.
-    m_length = HEADER_LENGTH + encodeBuffer->size();
+    auto encodedMessage = std::make_shared<dev::network::EncodedMessage>();
+    {
+        Guard l(x_payload);
+        if (!m_payload)
+        {
+            auto compressData = std::make_shared<bytes>();
+            m_compressed = compress(compressData);
+            m_payload = m_compressed ? compressData : m_buffer;
+        }
+        encodedMessage->payload = m_payload;
+    }
+    m_length = HEADER_LENGTH + encodedMessage->payload->size();
 
     uint32_t length = htonl(m_length);
-    VERSION_TYPE versionType = htons(m_version);
+    VERSION_TYPE versionType =
+        htons(m_compressed ? (m_version | dev::eth::CompressFlag) : m_version);
     PROTOCOL_ID protocolID = htonl(m_protocolID);
     PACKET_TYPE packetType = htons(m_packetType);
     uint32_t seq = htonl(m_seq);
 
-    m_cache->insert(m_cache->end(), (byte*)&length, (byte*)&length + sizeof(length));
-    m_cache->insert(m_cache->end(), (byte*)&versionType, (byte*)&versionType + sizeof(versionType));
-    m_cache->insert(m_cache->end(), (byte*)&protocolID, (byte*)&protocolID + sizeof(protocolID));
-    m_cache->insert(m_cache->end(), (byte*)&packetType, (byte*)&packetType + sizeof(packetType));
-    m_cache->insert(m_cache->end(), (byte*)&seq, (byte*)&seq + sizeof(seq));
-    m_cache->insert(m_cache->end(), encodeBuffer->begin(), encodeBuffer->end());
+    auto& header = encodedMessage->header;
+    header.reserve(HEADER_LENGTH);
+    header.insert(header.end(), (byte*)&length, (byte*)&length + sizeof(length));
+    header.insert(header.end(), (byte*)&versionType, (byte*)&versionType + sizeof(versionType));
+    header.insert(header.end(), (byte*)&protocolID, (byte*)&protocolID + sizeof(protocolID));
+    header.insert(header.end(), (byte*)&packetType, (byte*)&packetType + sizeof(packetType));
+    header.insert(header.end(), (byte*)&seq, (byte*)&seq + sizeof(seq));
     m_dirty = false;
+    m_deliveredLength = m_length;
+    return encodedMessage;
 }
 
 /// compress the data to be sended
@@ -91,7 +91,6 @@ bool P2PMessageRC2::compress(std::shared_ptr<bytes> compressData)
     {
         return false;
     }
-    m_version |= dev::eth::CompressFlag;
     return true;
 }
 
@@ -111,8 +110,11 @@ ssize_t P2PMessageRC2::decode(const byte* buffer, size_t size)
         return dev::network::PACKET_INCOMPLETE;
     }
 
-    m_cache->clear();
-    m_cache->insert(m_cache->end(), buffer, buffer + size);
+    {
+        Guard l(x_payload);
+        m_payload.reset();
+        m_compressed = false;
+    }
 
     /// get version
     offset += sizeof(m_length);
@@ -22,6 +22,7 @@
 #pragma once
 
 #include "P2PMessage.h"
+#include <libdevcore/Guards.h>
 
 namespace dev
 {
@@ -38,12 +39,12 @@ public:
     P2PMessageRC2()
     {
         m_buffer = std::make_shared<bytes>();
-        m_cache = std::make_shared<bytes>();
     }
     bool isRequestPacket() override { return (m_protocolID > 0); }
 
     virtual ~P2PMessageRC2() {}
     void encode(bytes& buffer) override;
+    dev::network::EncodedMessage::Ptr encodedMessage() override;
     /// < If the decoding is successful, the length of the decoded data is returned; otherwise, 0 is
     /// returned.
     ssize_t decode(const byte* buffer, size_t size) override;
@@ -53,15 +54,23 @@ public:
 
     uint32_t deliveredLength() override { return m_deliveredLength; }
 
-protected:
-    virtual void encode(std::shared_ptr<bytes> encodeBuffer);
+    void setBuffer(std::shared_ptr<bytes> _buffer) override
+    {
+        P2PMessage::setBuffer(_buffer);
+        Guard l(x_payload);
+        m_payload.reset();
+    }
 
+protected:
     VERSION_TYPE m_version = 0;
 
 private:
     /// compress the data to be sended
     bool compress(std::shared_ptr<bytes>);
-    std::shared_ptr<dev::bytes> m_cache;
+    /// the compressed m_buffer or m_buffer, shared by all the encoded messages
+    std::shared_ptr<const bytes> m_payload;
+    bool m_compressed = false;
+    Mutex x_payload;
     // the packet length delivered by the network
     uint32_t m_deliveredLength = 0;
 };
@@ -353,6 +353,7 @@ void Service::onMessage(dev::network::NetworkException e, dev::network::SessionF
         if (p2pMessage->isRequestPacket())
         {
             CallbackFuncWithSession callback;
+            std::function<void(GROUP_ID const&)> unknownGroupHandler;
             {
                 RecursiveGuard lock(x_protocolID2Handler);
                 auto it = m_protocolID2Handler->find(p2pMessage->protocolID());
@@ -360,6 +361,15 @@ void Service::onMessage(dev::network::NetworkException e, dev::network::SessionF
                 {
                     callback = it->second;
                 }
+                else
+                {
+                    unknownGroupHandler = m_unknownGroupHandler;
+                }
+            }
+            // the group of the message may be cold, the handler must not block
+            if (unknownGroupHandler && p2pMessage->protocolID() > 0)
+            {
+                unknownGroupHandler(dev::eth::getGroupAndProtocol(p2pMessage->protocolID()).first);
             }
 
             if (callback)
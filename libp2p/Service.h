@@ -194,6 +194,12 @@ public:
         m_channelNetworkStatHandler = _channelNetworkStatHandler;
     }
 
+    void setUnknownGroupHandler(std::function<void(GROUP_ID const&)> _handler) override
+    {
+        RecursiveGuard l(x_protocolID2Handler);
+        m_unknownGroupHandler = _handler;
+    }
+
 private:
     NodeIDs getPeersByTopic(std::string const& topic);
     void checkWhitelistAndClearSession();
@@ -235,6 +241,8 @@ private:
 
     std::shared_ptr<std::unordered_map<uint32_t, CallbackFuncWithSession>> m_protocolID2Handler;
     RecursiveMutex x_protocolID2Handler;
+    // wake up the cold groups, protected by x_protocolID2Handler
+    std::function<void(GROUP_ID const&)> m_unknownGroupHandler;
 
     ///< A call B, the function to call after the request is received by B in topic.
     std::shared_ptr<std::unordered_map<std::string, CallbackFuncWithSession>> m_topic2Handler;
@@ -24,6 +24,7 @@
 #include "libprecompiled/TableFactoryPrecompiled.h"
 #include "libstorage/StorageException.h"
 #include <json/json.h>
+#include <libconfig/GlobalConfigure.h>
 #include <libdevcore/Common.h>
 #include <libdevcrypto/Hash.h>
 #include <libethcore/ABI.h>
@@ -39,6 +40,15 @@ const char* const CRUD_METHOD_REMOVE_STR = "remove(string,string,string,string)"
 const char* const CRUD_METHOD_UPDATE_STR = "update(string,string,string,string,string)";
 const char* const CRUD_METHOD_SELECT_STR = "select(string,string,string,string)";
 const char* const CRUD_METHOD_DESC_STR = "desc(string)";
+// the entry and the condition are ABI encoded instead of JSON, the condition is encoded as
+// (string[] fields, int256[] ops, string[] values), ops are the InterfaceOpcode from EQ to Limit
+const char* const CRUD_METHOD_INSERT_ABI_STR = "insert(string,string,string[],string[],string)";
+const char* const CRUD_METHOD_REMOVE_ABI_STR =
+    "remove(string,string,string[],int256[],string[],string)";
+const char* const CRUD_METHOD_UPDATE_ABI_STR =
+    "update(string,string,string[],string[],string[],int256[],string[],string)";
+const char* const CRUD_METHOD_SELECT_ABI_STR =
+    "select(string,string,string[],int256[],string[],string)";
 
 CRUDPrecompiled::CRUDPrecompiled()
 {
@@ -47,6 +57,10 @@ CRUDPrecompiled::CRUDPrecompiled()
     name2Selector[CRUD_METHOD_UPDATE_STR] = getFuncSelector(CRUD_METHOD_UPDATE_STR);
     name2Selector[CRUD_METHOD_SELECT_STR] = getFuncSelector(CRUD_METHOD_SELECT_STR);
     name2Selector[CRUD_METHOD_DESC_STR] = getFuncSelector(CRUD_METHOD_DESC_STR);
+    name2Selector[CRUD_METHOD_INSERT_ABI_STR] = getFuncSelector(CRUD_METHOD_INSERT_ABI_STR);
+    name2Selector[CRUD_METHOD_REMOVE_ABI_STR] = getFuncSelector(CRUD_METHOD_REMOVE_ABI_STR);
+    name2Selector[CRUD_METHOD_UPDATE_ABI_STR] = getFuncSelector(CRUD_METHOD_UPDATE_ABI_STR);
+    name2Selector[CRUD_METHOD_SELECT_ABI_STR] = getFuncSelector(CRUD_METHOD_SELECT_ABI_STR);
 }
 
 std::string CRUDPrecompiled::toString()
@@ -66,6 +80,7 @@ PrecompiledExecResult::Ptr CRUDPrecompiled::call(
     dev::eth::ContractABI abi;
     auto callResult = m_precompiledExecResultFactory->createPrecompiledResult();
     callResult->gasPricer()->setMemUsed(param.size());
+    bool abiInterfaceEnabled = (g_BCOSConfig.version() >= V2_7_0);
 
     if (func == name2Selector[CRUD_METHOD_DESC_STR])
     {  // desc(string)
@@ -99,42 +114,27 @@ PrecompiledExecResult::Ptr CRUDPrecompiled::call(
         abi.abiOut(data, tableName, key, entryStr, optional);
         checkLengthValidate(
             key, USER_TABLE_KEY_VALUE_MAX_LENGTH, CODE_TABLE_KEYVALUE_LENGTH_OVERFLOW);
-
         tableName = precompiled::getTableName(tableName);
-        Table::Ptr table = openTable(context, tableName);
-        callResult->gasPricer()->appendOperation(InterfaceOpcode::OpenTable);
-        if (table)
-        {
-            Entry::Ptr entry = table->newEntry();
-            int parseEntryResult = parseEntry(entryStr, entry);
-            if (parseEntryResult != CODE_SUCCESS)
-            {
-                callResult->setExecResult(abi.abiIn("", u256(parseEntryResult)));
-                return callResult;
-            }
-
-            auto it = entry->begin();
-            for (; it != entry->end(); ++it)
-            {
-                checkLengthValidate(it->second, USER_TABLE_FIELD_VALUE_MAX_LENGTH,
-                    CODE_TABLE_KEYVALUE_LENGTH_OVERFLOW);
-            }
-
-            int result = table->insert(key, entry, std::make_shared<AccessOptions>(origin));
-            if (result > 0)
-            {
-                callResult->gasPricer()->appendOperation(InterfaceOpcode::Insert, result);
-                callResult->gasPricer()->updateMemUsed(entry->capacity() * result);
-            }
-            callResult->setExecResult(abi.abiIn("", u256(result)));
-        }
-        else
-        {
-            PRECOMPILED_LOG(ERROR) << LOG_BADGE("CRUDPrecompiled") << LOG_DESC("table open error")
-                                   << LOG_KV("tableName", tableName);
-            callResult->setExecResult(abi.abiIn("", u256(CODE_TABLE_NOT_EXIST)));
-        }
-
+        insert(context, callResult, tableName, key,
+            [&entryStr]() {
+                PRECOMPILED_LOG(DEBUG) << LOG_BADGE("CRUDPrecompiled")
+                                       << LOG_DESC("table records")
+                                       << LOG_KV("entryStr", entryStr);
+                return compileEntry(entryStr);
+            },
+            origin);
+        return callResult;
+    }
+    else if (abiInterfaceEnabled && func == name2Selector[CRUD_METHOD_INSERT_ABI_STR])
+    {  // insert(string tableName, string key, string[] fields, string[] values, string optional)
+        std::string tableName, key, optional;
+        std::vector<std::string> fields, values;
+        abi.abiOut(data, tableName, key, fields, values, optional);
+        checkLengthValidate(
+            key, USER_TABLE_KEY_VALUE_MAX_LENGTH, CODE_TABLE_KEYVALUE_LENGTH_OVERFLOW);
+        tableName = precompiled::getTableName(tableName);
+        insert(context, callResult, tableName, key,
+            [&fields, &values]() { return compileEntry(fields, values); }, origin);
         return callResult;
     }
     if (func == name2Selector[CRUD_METHOD_UPDATE_STR])
@@ -142,48 +142,32 @@ PrecompiledExecResult::Ptr CRUDPrecompiled::call(
         std::string tableName, key, entryStr, conditionStr, optional;
         abi.abiOut(data, tableName, key, entryStr, conditionStr, optional);
         tableName = precompiled::getTableName(tableName);
-        Table::Ptr table = openTable(context, tableName);
-        callResult->gasPricer()->appendOperation(InterfaceOpcode::OpenTable);
-        if (table)
-        {
-            Entry::Ptr entry = table->newEntry();
-            int parseEntryResult = parseEntry(entryStr, entry);
-            if (parseEntryResult != CODE_SUCCESS)
-            {
-                callResult->setExecResult(abi.abiIn("", u256(parseEntryResult)));
-                return callResult;
-            }
-            Condition::Ptr condition = table->newCondition();
-            int parseConditionResult = parseCondition(conditionStr, condition, callResult);
-            if (parseConditionResult != CODE_SUCCESS)
-            {
-                callResult->setExecResult(abi.abiIn("", u256(parseConditionResult)));
-                return callResult;
-            }
-
-            auto it = entry->begin();
-            for (; it != entry->end(); ++it)
-            {
-                checkLengthValidate(it->second, USER_TABLE_FIELD_VALUE_MAX_LENGTH,
-                    CODE_TABLE_KEYVALUE_LENGTH_OVERFLOW);
-            }
-
-            int result =
-                table->update(key, entry, condition, std::make_shared<AccessOptions>(origin));
-            if (result > 0)
-            {
-                callResult->gasPricer()->updateMemUsed(entry->capacity() * result);
-                callResult->gasPricer()->appendOperation(InterfaceOpcode::Update, result);
-            }
-            callResult->setExecResult(abi.abiIn("", u256(result)));
-        }
-        else
-        {
-            PRECOMPILED_LOG(ERROR) << LOG_BADGE("CRUDPrecompiled") << LOG_DESC("table open error")
-                                   << LOG_KV("tableName", tableName);
-            callResult->setExecResult(abi.abiIn("", u256(CODE_TABLE_NOT_EXIST)));
-        }
-
+        update(context, callResult, tableName, key,
+            [&entryStr]() {
+                PRECOMPILED_LOG(DEBUG) << LOG_BADGE("CRUDPrecompiled")
+                                       << LOG_DESC("table records")
+                                       << LOG_KV("entryStr", entryStr);
+                return compileEntry(entryStr);
+            },
+            [&conditionStr]() { return compileCondition(conditionStr); }, origin);
+        return callResult;
+    }
+    if (abiInterfaceEnabled && func == name2Selector[CRUD_METHOD_UPDATE_ABI_STR])
+    {  // update(string tableName, string key, string[] fields, string[] values,
+       // string[] conditionFields, int256[] conditionOps, string[] conditionValues,
+       // string optional)
+        std::string tableName, key, optional;
+        std::vector<std::string> fields, values, conditionFields, conditionValues;
+        std::vector<s256> conditionOps;
+        abi.abiOut(data, tableName, key, fields, values, conditionFields, conditionOps,
+            conditionValues, optional);
+        tableName = precompiled::getTableName(tableName);
+        update(context, callResult, tableName, key,
+            [&fields, &values]() { return compileEntry(fields, values); },
+            [&conditionFields, &conditionOps, &conditionValues]() {
+                return compileCondition(conditionFields, conditionOps, conditionValues);
+            },
+            origin);
         return callResult;
     }
     if (func == name2Selector[CRUD_METHOD_REMOVE_STR])
@@ -191,31 +175,23 @@ PrecompiledExecResult::Ptr CRUDPrecompiled::call(
         std::string tableName, key, conditionStr, optional;
         abi.abiOut(data, tableName, key, conditionStr, optional);
         tableName = precompiled::getTableName(tableName);
-        Table::Ptr table = openTable(context, tableName);
-        callResult->gasPricer()->appendOperation(InterfaceOpcode::OpenTable);
-        if (table)
-        {
-            Condition::Ptr condition = table->newCondition();
-            int parseConditionResult = parseCondition(conditionStr, condition, callResult);
-            if (parseConditionResult != CODE_SUCCESS)
-            {
-                callResult->setExecResult(abi.abiIn("", u256(parseConditionResult)));
-                return callResult;
-            }
-            int result = table->remove(key, condition, std::make_shared<AccessOptions>(origin));
-            if (result > 0)
-            {
-                callResult->gasPricer()->appendOperation(InterfaceOpcode::Remove, result);
-            }
-            callResult->setExecResult(abi.abiIn("", u256(result)));
-        }
-        else
-        {
-            PRECOMPILED_LOG(ERROR) << LOG_BADGE("CRUDPrecompiled") << LOG_DESC("table open error")
-                                   << LOG_KV("tableName", tableName);
-            callResult->setExecResult(abi.abiIn("", u256(CODE_TABLE_NOT_EXIST)));
-        }
-
+        remove(context, callResult, tableName, key,
+            [&conditionStr]() { return compileCondition(conditionStr); }, origin);
+        return callResult;
+    }
+    if (abiInterfaceEnabled && func == name2Selector[CRUD_METHOD_REMOVE_ABI_STR])
+    {  // remove(string tableName, string key, string[] conditionFields, int256[] conditionOps,
+       // string[] conditionValues, string optional)
+        std::string tableName, key, optional;
+        std::vector<std::string> conditionFields, conditionValues;
+        std::vector<s256> conditionOps;
+        abi.abiOut(data, tableName, key, conditionFields, conditionOps, conditionValues, optional);
+        tableName = precompiled::getTableName(tableName);
+        remove(context, callResult, tableName, key,
+            [&conditionFields, &conditionOps, &conditionValues]() {
+                return compileCondition(conditionFields, conditionOps, conditionValues);
+            },
+            origin);
         return callResult;
     }
     if (func == name2Selector[CRUD_METHOD_SELECT_STR])
@@ -226,44 +202,66 @@ PrecompiledExecResult::Ptr CRUDPrecompiled::call(
         {
             tableName = precompiled::getTableName(tableName);
         }
-        Table::Ptr table = openTable(context, tableName);
-        callResult->gasPricer()->appendOperation(InterfaceOpcode::OpenTable);
-        if (table)
+        auto entries = select(context, callResult, tableName, key,
+            [&conditionStr]() { return compileCondition(conditionStr); });
+        if (entries)
         {
-            Condition::Ptr condition = table->newCondition();
-            int parseConditionResult = parseCondition(conditionStr, condition, callResult);
-            if (parseConditionResult != CODE_SUCCESS)
-            {
-                callResult->setExecResult(abi.abiIn("", u256(parseConditionResult)));
-                return callResult;
-            }
-            auto entries = table->select(key, condition);
-            callResult->gasPricer()->appendOperation(InterfaceOpcode::Select, entries->size());
             Json::Value records = Json::Value(Json::arrayValue);
-            if (entries)
+            for (size_t i = 0; i < entries->size(); i++)
             {
-                for (size_t i = 0; i < entries->size(); i++)
+                auto entry = entries->get(i);
+                Json::Value record;
+                for (auto iter = entry->begin(); iter != entry->end(); iter++)
                 {
-                    auto entry = entries->get(i);
-                    Json::Value record;
-                    for (auto iter = entry->begin(); iter != entry->end(); iter++)
-                    {
-                        record[iter->first] = iter->second;
-                    }
-                    records.append(record);
+                    record[iter->first] = iter->second;
                 }
+                records.append(record);
             }
 
             auto str = records.toStyledString();
             callResult->setExecResult(abi.abiIn("", str));
         }
-        else
+        return callResult;
+    }
+    if (abiInterfaceEnabled && func == name2Selector[CRUD_METHOD_SELECT_ABI_STR])
+    {  // select(string tableName, string key, string[] conditionFields, int256[] conditionOps,
+       // string[] conditionValues, string optional) returns (string[] fields, string[] values)
+        // the values are flattened row by row, every row has fields.size() values
+        std::string tableName, key, optional;
+        std::vector<std::string> conditionFields, conditionValues;
+        std::vector<s256> conditionOps;
+        abi.abiOut(data, tableName, key, conditionFields, conditionOps, conditionValues, optional);
+        if (tableName != storage::SYS_TABLES)
         {
-            PRECOMPILED_LOG(ERROR) << LOG_BADGE("CRUDPrecompiled") << LOG_DESC("table open error")
-                                   << LOG_KV("tableName", tableName);
-            callResult->setExecResult(abi.abiIn("", u256(CODE_TABLE_NOT_EXIST)));
+            tableName = precompiled::getTableName(tableName);
+        }
+        auto entries = select(context, callResult, tableName, key,
+            [&conditionFields, &conditionOps, &conditionValues]() {
+                return compileCondition(conditionFields, conditionOps, conditionValues);
+            });
+        if (entries)
+        {
+            std::vector<std::string> fields;
+            std::vector<std::string> values;
+            if (entries->size() > 0)
+            {
+                auto firstEntry = entries->get(0);
+                for (auto iter = firstEntry->begin(); iter != firstEntry->end(); iter++)
+                {
+                    fields.push_back(iter->first);
+                }
+                values.reserve(fields.size() * entries->size());
+            }
+            for (size_t i = 0; i < entries->size(); i++)
+            {
+                auto entry = entries->get(i);
+                for (auto const& field : fields)
+                {
+                    values.push_back(entry->getField(field));
+                }
+            }
+            callResult->setExecResult(abi.abiIn("", fields, values));
         }
-
         return callResult;
     }
     else
@@ -276,109 +274,140 @@ PrecompiledExecResult::Ptr CRUDPrecompiled::call(
     }
 }
 
-int CRUDPrecompiled::parseCondition(const std::string& conditionStr, Condition::Ptr& condition,
-    PrecompiledExecResult::Ptr _execResult)
+void CRUDPrecompiled::insert(ExecutiveContext::Ptr _context, PrecompiledExecResult::Ptr _callResult,
+    const std::string& _tableName, const std::string& _key, EntryDecoder const& _decodeEntry,
+    Address const& _origin)
 {
-    Json::Reader reader;
-    Json::Value conditionJson;
-    if (!reader.parse(conditionStr, conditionJson))
+    dev::eth::ContractABI abi;
+    Table::Ptr table = openTable(_context, _tableName);
+    _callResult->gasPricer()->appendOperation(InterfaceOpcode::OpenTable);
+    if (!table)
     {
-        PRECOMPILED_LOG(ERROR) << LOG_BADGE("CRUDPrecompiled")
-                               << LOG_DESC("condition json parse error")
-                               << LOG_KV("condition", conditionStr);
-
-        return CODE_PARSE_CONDITION_ERROR;
+        PRECOMPILED_LOG(ERROR) << LOG_BADGE("CRUDPrecompiled") << LOG_DESC("table open error")
+                               << LOG_KV("tableName", _tableName);
+        _callResult->setExecResult(abi.abiIn("", u256(CODE_TABLE_NOT_EXIST)));
+        return;
     }
-    else
+    Entry::Ptr entry = table->newEntry();
+    int parseEntryResult = _decodeEntry()->apply(entry);
+    if (parseEntryResult != CODE_SUCCESS)
     {
-        auto members = conditionJson.getMemberNames();
-        Json::Value OPJson;
-        for (auto iter = members.begin(); iter != members.end(); iter++)
-        {
-            if (!isHashField(*iter))
-            {
-                continue;
-            }
-            OPJson = conditionJson[*iter];
-            auto op = OPJson.getMemberNames();
-            for (auto it = op.begin(); it != op.end(); it++)
-            {
-                if (*it == "eq")
-                {
-                    condition->EQ(*iter, OPJson[*it].asString());
-                    _execResult->gasPricer()->appendOperation(InterfaceOpcode::EQ);
-                }
-                else if (*it == "ne")
-                {
-                    condition->NE(*iter, OPJson[*it].asString());
-                    _execResult->gasPricer()->appendOperation(InterfaceOpcode::NE);
-                }
-                else if (*it == "gt")
-                {
-                    condition->GT(*iter, OPJson[*it].asString());
-                    _execResult->gasPricer()->appendOperation(InterfaceOpcode::GT);
-                }
-                else if (*it == "ge")
-                {
-                    condition->GE(*iter, OPJson[*it].asString());
-                    _execResult->gasPricer()->appendOperation(InterfaceOpcode::GE);
-                }
-                else if (*it == "lt")
-                {
-                    condition->LT(*iter, OPJson[*it].asString());
-                    _execResult->gasPricer()->appendOperation(InterfaceOpcode::LT);
-                }
-                else if (*it == "le")
-                {
-                    condition->LE(*iter, OPJson[*it].asString());
-                    _execResult->gasPricer()->appendOperation(InterfaceOpcode::LE);
-                }
-                else if (*it == "limit")
-                {
-                    std::string offsetCount = OPJson[*it].asString();
-                    std::vector<std::string> offsetCountList;
-                    boost::split(offsetCountList, offsetCount, boost::is_any_of(","));
-                    int offset = boost::lexical_cast<int>(offsetCountList[0]);
-                    int count = boost::lexical_cast<int>(offsetCountList[1]);
-                    condition->limit(offset, count);
-                    _execResult->gasPricer()->appendOperation(InterfaceOpcode::Limit);
-                }
-                else
-                {
-                    PRECOMPILED_LOG(ERROR)
-                        << LOG_BADGE("CRUDPrecompiled") << LOG_DESC("condition operation undefined")
-                        << LOG_KV("operation", *it);
+        _callResult->setExecResult(abi.abiIn("", u256(parseEntryResult)));
+        return;
+    }
 
-                    return CODE_CONDITION_OPERATION_UNDEFINED;
-                }
-            }
-        }
+    auto it = entry->begin();
+    for (; it != entry->end(); ++it)
+    {
+        checkLengthValidate(
+            it->second, USER_TABLE_FIELD_VALUE_MAX_LENGTH, CODE_TABLE_KEYVALUE_LENGTH_OVERFLOW);
     }
 
-    return CODE_SUCCESS;
+    int result = table->insert(_key, entry, std::make_shared<AccessOptions>(_origin));
+    if (result > 0)
+    {
+        _callResult->gasPricer()->appendOperation(InterfaceOpcode::Insert, result);
+        _callResult->gasPricer()->updateMemUsed(entry->capacity() * result);
+    }
+    _callResult->setExecResult(abi.abiIn("", u256(result)));
 }
 
-int CRUDPrecompiled::parseEntry(const std::string& entryStr, Entry::Ptr& entry)
+void CRUDPrecompiled::update(ExecutiveContext::Ptr _context, PrecompiledExecResult::Ptr _callResult,
+    const std::string& _tableName, const std::string& _key, EntryDecoder const& _decodeEntry,
+    ConditionDecoder const& _decodeCondition, Address const& _origin)
 {
-    PRECOMPILED_LOG(DEBUG) << LOG_BADGE("CRUDPrecompiled") << LOG_DESC("table records")
-                           << LOG_KV("entryStr", entryStr);
-    Json::Value entryJson;
-    Json::Reader reader;
-    if (!reader.parse(entryStr, entryJson))
+    dev::eth::ContractABI abi;
+    Table::Ptr table = openTable(_context, _tableName);
+    _callResult->gasPricer()->appendOperation(InterfaceOpcode::OpenTable);
+    if (!table)
+    {
+        PRECOMPILED_LOG(ERROR) << LOG_BADGE("CRUDPrecompiled") << LOG_DESC("table open error")
+                               << LOG_KV("tableName", _tableName);
+        _callResult->setExecResult(abi.abiIn("", u256(CODE_TABLE_NOT_EXIST)));
+        return;
+    }
+    Entry::Ptr entry = table->newEntry();
+    int parseEntryResult = _decodeEntry()->apply(entry);
+    if (parseEntryResult != CODE_SUCCESS)
     {
-        PRECOMPILED_LOG(ERROR) << LOG_BADGE("CRUDPrecompiled") << LOG_DESC("entry json parse error")
-                               << LOG_KV("entry", entryStr);
+        _callResult->setExecResult(abi.abiIn("", u256(parseEntryResult)));
+        return;
+    }
+    Condition::Ptr condition = table->newCondition();
+    int parseConditionResult = _decodeCondition()->apply(condition, _callResult->gasPricer());
+    if (parseConditionResult != CODE_SUCCESS)
+    {
+        _callResult->setExecResult(abi.abiIn("", u256(parseConditionResult)));
+        return;
+    }
 
-        return CODE_PARSE_ENTRY_ERROR;
+    auto it = entry->begin();
+    for (; it != entry->end(); ++it)
+    {
+        checkLengthValidate(
+            it->second, USER_TABLE_FIELD_VALUE_MAX_LENGTH, CODE_TABLE_KEYVALUE_LENGTH_OVERFLOW);
     }
-    else
+
+    int result = table->update(_key, entry, condition, std::make_shared<AccessOptions>(_origin));
+    if (result > 0)
     {
-        auto memebers = entryJson.getMemberNames();
-        for (auto iter = memebers.begin(); iter != memebers.end(); iter++)
-        {
-            entry->setField(*iter, entryJson[*iter].asString());
-        }
+        _callResult->gasPricer()->updateMemUsed(entry->capacity() * result);
+        _callResult->gasPricer()->appendOperation(InterfaceOpcode::Update, result);
+    }
+    _callResult->setExecResult(abi.abiIn("", u256(result)));
+}
 
-        return CODE_SUCCESS;
+void CRUDPrecompiled::remove(ExecutiveContext::Ptr _context, PrecompiledExecResult::Ptr _callResult,
+    const std::string& _tableName, const std::string& _key,
+    ConditionDecoder const& _decodeCondition, Address const& _origin)
+{
+    dev::eth::ContractABI abi;
+    Table::Ptr table = openTable(_context, _tableName);
+    _callResult->gasPricer()->appendOperation(InterfaceOpcode::OpenTable);
+    if (!table)
+    {
+        PRECOMPILED_LOG(ERROR) << LOG_BADGE("CRUDPrecompiled") << LOG_DESC("table open error")
+                               << LOG_KV("tableName", _tableName);
+        _callResult->setExecResult(abi.abiIn("", u256(CODE_TABLE_NOT_EXIST)));
+        return;
+    }
+    Condition::Ptr condition = table->newCondition();
+    int parseConditionResult = _decodeCondition()->apply(condition, _callResult->gasPricer());
+    if (parseConditionResult != CODE_SUCCESS)
+    {
+        _callResult->setExecResult(abi.abiIn("", u256(parseConditionResult)));
+        return;
+    }
+    int result = table->remove(_key, condition, std::make_shared<AccessOptions>(_origin));
+    if (result > 0)
+    {
+        _callResult->gasPricer()->appendOperation(InterfaceOpcode::Remove, result);
+    }
+    _callResult->setExecResult(abi.abiIn("", u256(result)));
+}
+
+Entries::ConstPtr CRUDPrecompiled::select(ExecutiveContext::Ptr _context,
+    PrecompiledExecResult::Ptr _callResult, const std::string& _tableName,
+    const std::string& _key, ConditionDecoder const& _decodeCondition)
+{
+    dev::eth::ContractABI abi;
+    Table::Ptr table = openTable(_context, _tableName);
+    _callResult->gasPricer()->appendOperation(InterfaceOpcode::OpenTable);
+    if (!table)
+    {
+        PRECOMPILED_LOG(ERROR) << LOG_BADGE("CRUDPrecompiled") << LOG_DESC("table open error")
+                               << LOG_KV("tableName", _tableName);
+        _callResult->setExecResult(abi.abiIn("", u256(CODE_TABLE_NOT_EXIST)));
+        return nullptr;
+    }
+    Condition::Ptr condition = table->newCondition();
+    int parseConditionResult = _decodeCondition()->apply(condition, _callResult->gasPricer());
+    if (parseConditionResult != CODE_SUCCESS)
+    {
+        _callResult->setExecResult(abi.abiIn("", u256(parseConditionResult)));
+        return nullptr;
     }
+    auto entries = table->select(_key, condition);
+    _callResult->gasPricer()->appendOperation(InterfaceOpcode::Select, entries->size());
+    return entries;
 }
@@ -20,7 +20,9 @@
  */
 #pragma once
 #include "Common.h"
+#include "CompiledCondition.h"
 #include "libstorage/Table.h"
+#include <functional>
 
 namespace dev
 {
@@ -45,9 +47,25 @@ public:
         Address const& _sender = Address()) override;
 
 private:
-    int parseEntry(const std::string& entryStr, storage::Entry::Ptr& entry);
-    int parseCondition(const std::string& conditionStr, storage::Condition::Ptr& condition,
-        PrecompiledExecResult::Ptr _execResult);
+    // the entry and the condition are decoded after the table is opened, so that the result
+    // code and the gas are the same for the JSON and the ABI interface
+    using EntryDecoder = std::function<CompiledEntry::Ptr()>;
+    using ConditionDecoder = std::function<CompiledCondition::Ptr()>;
+
+    void insert(std::shared_ptr<dev::blockverifier::ExecutiveContext> _context,
+        PrecompiledExecResult::Ptr _callResult, const std::string& _tableName,
+        const std::string& _key, EntryDecoder const& _decodeEntry, Address const& _origin);
+    void update(std::shared_ptr<dev::blockverifier::ExecutiveContext> _context,
+        PrecompiledExecResult::Ptr _callResult, const std::string& _tableName,
+        const std::string& _key, EntryDecoder const& _decodeEntry,
+        ConditionDecoder const& _decodeCondition, Address const& _origin);
+    void remove(std::shared_ptr<dev::blockverifier::ExecutiveContext> _context,
+        PrecompiledExecResult::Ptr _callResult, const std::string& _tableName,
+        const std::string& _key, ConditionDecoder const& _decodeCondition, Address const& _origin);
+    // return nullptr and set the result code of _callResult on error
+    storage::Entries::ConstPtr select(std::shared_ptr<dev::blockverifier::ExecutiveContext> _context,
+        PrecompiledExecResult::Ptr _callResult, const std::string& _tableName,
+        const std::string& _key, ConditionDecoder const& _decodeCondition);
 };
 
 }  // namespace precompiled
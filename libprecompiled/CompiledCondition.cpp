@@ -0,0 +1,327 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : conditions and entries of CRUDPrecompiled decoded once and reused
+ * @file: CompiledCondition.cpp
+ */
+#include "CompiledCondition.h"
+#include <json/json.h>
+#include <libdevcore/Guards.h>
+#include <libdevcrypto/Hash.h>
+#include <libstorage/Common.h>
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+#include <map>
+
+using namespace std;
+using namespace dev;
+using namespace dev::storage;
+using namespace dev::precompiled;
+
+namespace
+{
+/**
+ * @brief Simple thread-safe cache from the hash of the input to the decoded object.
+ * If the cache is full, a random element is removed.
+ */
+template <class T>
+class CompiledCache
+{
+public:
+    std::shared_ptr<T const> get(h256 const& _hash) const
+    {
+        ReadGuard l(x_cache);
+        auto it = m_cache.find(_hash);
+        if (it == m_cache.end())
+        {
+            return nullptr;
+        }
+        return it->second;
+    }
+
+    void store(h256 const& _hash, std::shared_ptr<T const> _value)
+    {
+        WriteGuard l(x_cache);
+        if (m_cache.size() >= c_maxSize)
+        {
+            auto it = m_cache.lower_bound(h256::random());
+            if (it == m_cache.end())
+            {
+                it = m_cache.begin();
+            }
+            m_cache.erase(it);
+        }
+        m_cache[_hash] = _value;
+    }
+
+    void clear()
+    {
+        WriteGuard l(x_cache);
+        m_cache.clear();
+    }
+
+    size_t size() const
+    {
+        ReadGuard l(x_cache);
+        return m_cache.size();
+    }
+
+private:
+    static const size_t c_maxSize = 10000;
+    mutable SharedMutex x_cache;
+    std::map<h256, std::shared_ptr<T const>> m_cache;
+};
+
+CompiledCache<CompiledCondition> s_conditionCache;
+CompiledCache<CompiledEntry> s_entryCache;
+
+bool parseLimit(const std::string& _offsetCount, int& _offset, int& _count)
+{
+    std::vector<std::string> offsetCountList;
+    boost::split(offsetCountList, _offsetCount, boost::is_any_of(","));
+    if (offsetCountList.size() != 2)
+    {
+        return false;
+    }
+    _offset = boost::lexical_cast<int>(offsetCountList[0]);
+    _count = boost::lexical_cast<int>(offsetCountList[1]);
+    return true;
+}
+}  // namespace
+
+int CompiledCondition::apply(Condition::Ptr _condition, PrecompiledGas::Ptr _gasPricer) const
+{
+    for (auto& operation : operations)
+    {
+        switch (operation.op)
+        {
+        case InterfaceOpcode::EQ:
+            _condition->EQ(operation.field, operation.value);
+            break;
+        case InterfaceOpcode::NE:
+            _condition->NE(operation.field, operation.value);
+            break;
+        case InterfaceOpcode::GT:
+            _condition->GT(operation.field, operation.value);
+            break;
+        case InterfaceOpcode::GE:
+            _condition->GE(operation.field, operation.value);
+            break;
+        case InterfaceOpcode::LT:
+            _condition->LT(operation.field, operation.value);
+            break;
+        case InterfaceOpcode::LE:
+            _condition->LE(operation.field, operation.value);
+            break;
+        case InterfaceOpcode::Limit:
+            _condition->limit(operation.offset, operation.count);
+            break;
+        default:
+            return CODE_CONDITION_OPERATION_UNDEFINED;
+        }
+        _gasPricer->appendOperation(operation.op);
+    }
+    return errorCode;
+}
+
+int CompiledEntry::apply(Entry::Ptr _entry) const
+{
+    for (auto& field : fields)
+    {
+        _entry->setField(field.first, field.second);
+    }
+    return errorCode;
+}
+
+CompiledCondition::Ptr dev::precompiled::compileCondition(const std::string& _conditionStr)
+{
+    auto hash = sha3(_conditionStr);
+    auto cached = s_conditionCache.get(hash);
+    if (cached)
+    {
+        return cached;
+    }
+
+    auto compiled = std::make_shared<CompiledCondition>();
+    Json::Reader reader;
+    Json::Value conditionJson;
+    if (!reader.parse(_conditionStr, conditionJson))
+    {
+        PRECOMPILED_LOG(ERROR) << LOG_BADGE("CRUDPrecompiled")
+                               << LOG_DESC("condition json parse error")
+                               << LOG_KV("condition", _conditionStr);
+        compiled->errorCode = CODE_PARSE_CONDITION_ERROR;
+        s_conditionCache.store(hash, compiled);
+        return compiled;
+    }
+    static const std::map<std::string, InterfaceOpcode> name2Op = {{"eq", InterfaceOpcode::EQ},
+        {"ne", InterfaceOpcode::NE}, {"gt", InterfaceOpcode::GT}, {"ge", InterfaceOpcode::GE},
+        {"lt", InterfaceOpcode::LT}, {"le", InterfaceOpcode::LE},
+        {"limit", InterfaceOpcode::Limit}};
+    auto members = conditionJson.getMemberNames();
+    for (auto iter = members.begin(); iter != members.end(); iter++)
+    {
+        if (!isHashField(*iter))
+        {
+            continue;
+        }
+        Json::Value OPJson = conditionJson[*iter];
+        auto op = OPJson.getMemberNames();
+        for (auto it = op.begin(); it != op.end(); it++)
+        {
+            auto opIt = name2Op.find(*it);
+            if (opIt == name2Op.end())
+            {
+                PRECOMPILED_LOG(ERROR)
+                    << LOG_BADGE("CRUDPrecompiled") << LOG_DESC("condition operation undefined")
+                    << LOG_KV("operation", *it);
+                compiled->errorCode = CODE_CONDITION_OPERATION_UNDEFINED;
+                s_conditionCache.store(hash, compiled);
+                return compiled;
+            }
+            CompiledCondition::Operation operation;
+            operation.field = *iter;
+            operation.op = opIt->second;
+            operation.value = OPJson[*it].asString();
+            if (operation.op == InterfaceOpcode::Limit)
+            {
+                std::vector<std::string> offsetCountList;
+                boost::split(offsetCountList, operation.value, boost::is_any_of(","));
+                operation.offset = boost::lexical_cast<int>(offsetCountList[0]);
+                operation.count = boost::lexical_cast<int>(offsetCountList[1]);
+            }
+            compiled->operations.emplace_back(std::move(operation));
+        }
+    }
+    s_conditionCache.store(hash, compiled);
+    return compiled;
+}
+
+CompiledCondition::Ptr dev::precompiled::compileCondition(std::vector<std::string> const& _fields,
+    std::vector<s256> const& _ops, std::vector<std::string> const& _values)
+{
+    auto compiled = std::make_shared<CompiledCondition>();
+    if (_fields.size() != _ops.size() || _fields.size() != _values.size())
+    {
+        PRECOMPILED_LOG(ERROR) << LOG_BADGE("CRUDPrecompiled")
+                               << LOG_DESC("condition size mismatch")
+                               << LOG_KV("fields", _fields.size()) << LOG_KV("ops", _ops.size())
+                               << LOG_KV("values", _values.size());
+        compiled->errorCode = CODE_PARSE_CONDITION_ERROR;
+        return compiled;
+    }
+    for (size_t i = 0; i < _fields.size(); ++i)
+    {
+        if (_ops[i] < InterfaceOpcode::EQ || _ops[i] > InterfaceOpcode::Limit)
+        {
+            PRECOMPILED_LOG(ERROR)
+                << LOG_BADGE("CRUDPrecompiled") << LOG_DESC("condition operation undefined")
+                << LOG_KV("operation", _ops[i]);
+            compiled->errorCode = CODE_CONDITION_OPERATION_UNDEFINED;
+            return compiled;
+        }
+        CompiledCondition::Operation operation;
+        operation.field = _fields[i];
+        operation.op = static_cast<InterfaceOpcode>(static_cast<int64_t>(_ops[i]));
+        operation.value = _values[i];
+        if (operation.op == InterfaceOpcode::Limit)
+        {
+            bool valid = false;
+            try
+            {
+                valid = parseLimit(operation.value, operation.offset, operation.count);
+            }
+            catch (boost::bad_lexical_cast const&)
+            {
+                valid = false;
+            }
+            if (!valid)
+            {
+                PRECOMPILED_LOG(ERROR) << LOG_BADGE("CRUDPrecompiled") << LOG_DESC("invalid limit")
+                                       << LOG_KV("limit", operation.value);
+                compiled->errorCode = CODE_PARSE_CONDITION_ERROR;
+                return compiled;
+            }
+        }
+        else if (!isHashField(operation.field))
+        {
+            continue;
+        }
+        compiled->operations.emplace_back(std::move(operation));
+    }
+    return compiled;
+}
+
+CompiledEntry::Ptr dev::precompiled::compileEntry(const std::string& _entryStr)
+{
+    auto hash = sha3(_entryStr);
+    auto cached = s_entryCache.get(hash);
+    if (cached)
+    {
+        return cached;
+    }
+
+    auto compiled = std::make_shared<CompiledEntry>();
+    Json::Value entryJson;
+    Json::Reader reader;
+    if (!reader.parse(_entryStr, entryJson))
+    {
+        PRECOMPILED_LOG(ERROR) << LOG_BADGE("CRUDPrecompiled") << LOG_DESC("entry json parse error")
+                               << LOG_KV("entry", _entryStr);
+        compiled->errorCode = CODE_PARSE_ENTRY_ERROR;
+        s_entryCache.store(hash, compiled);
+        return compiled;
+    }
+    auto memebers = entryJson.getMemberNames();
+    for (auto iter = memebers.begin(); iter != memebers.end(); iter++)
+    {
+        compiled->fields.emplace_back(*iter, entryJson[*iter].asString());
+    }
+    s_entryCache.store(hash, compiled);
+    return compiled;
+}
+
+CompiledEntry::Ptr dev::precompiled::compileEntry(
+    std::vector<std::string> const& _fields, std::vector<std::string> const& _values)
+{
+    auto compiled = std::make_shared<CompiledEntry>();
+    if (_fields.size() != _values.size())
+    {
+        PRECOMPILED_LOG(ERROR) << LOG_BADGE("CRUDPrecompiled") << LOG_DESC("entry size mismatch")
+                               << LOG_KV("fields", _fields.size())
+                               << LOG_KV("values", _values.size());
+        compiled->errorCode = CODE_PARSE_ENTRY_ERROR;
+        return compiled;
+    }
+    compiled->fields.reserve(_fields.size());
+    for (size_t i = 0; i < _fields.size(); ++i)
+    {
+        compiled->fields.emplace_back(_fields[i], _values[i]);
+    }
+    return compiled;
+}
+
+void dev::precompiled::clearCompiledCache()
+{
+    s_conditionCache.clear();
+    s_entryCache.clear();
+}
+
+size_t dev::precompiled::compiledCacheSize()
+{
+    return s_conditionCache.size() + s_entryCache.size();
+}
@@ -0,0 +1,91 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : conditions and entries of CRUDPrecompiled decoded once and reused
+ * @file: CompiledCondition.h
+ */
+#pragma once
+
+#include "Common.h"
+#include "PrecompiledGas.h"
+#include <libstorage/Table.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace dev
+{
+namespace precompiled
+{
+/**
+ * @brief The condition of a CRUD call in the decoded form, it is immutable so that the same
+ * object can be shared by every call with the same input.
+ * The operations keep the order of the JSON members, so that the gas is the same as parsing
+ * the JSON string on every call.
+ */
+class CompiledCondition
+{
+public:
+    using Ptr = std::shared_ptr<CompiledCondition const>;
+
+    struct Operation
+    {
+        std::string field;
+        InterfaceOpcode op;
+        std::string value;
+        // only for InterfaceOpcode::Limit
+        int offset = 0;
+        int count = 0;
+    };
+
+    // apply the operations to _condition, return CODE_SUCCESS or the decoding error
+    int apply(storage::Condition::Ptr _condition, PrecompiledGas::Ptr _gasPricer) const;
+
+    std::vector<Operation> operations;
+    int errorCode = CODE_SUCCESS;
+};
+
+class CompiledEntry
+{
+public:
+    using Ptr = std::shared_ptr<CompiledEntry const>;
+
+    // set the fields of _entry, return CODE_SUCCESS or the decoding error
+    int apply(storage::Entry::Ptr _entry) const;
+
+    std::vector<std::pair<std::string, std::string>> fields;
+    int errorCode = CODE_SUCCESS;
+};
+
+// decode the JSON condition of CRUD v1, the result is cached by the hash of _conditionStr
+CompiledCondition::Ptr compileCondition(const std::string& _conditionStr);
+// decode the ABI condition of CRUD v2, _ops are InterfaceOpcode from EQ to Limit,
+// the value of Limit is "offset,count"
+CompiledCondition::Ptr compileCondition(std::vector<std::string> const& _fields,
+    std::vector<s256> const& _ops, std::vector<std::string> const& _values);
+
+// decode the JSON entry of CRUD v1, the result is cached by the hash of _entryStr
+CompiledEntry::Ptr compileEntry(const std::string& _entryStr);
+// decode the ABI entry of CRUD v2
+CompiledEntry::Ptr compileEntry(
+    std::vector<std::string> const& _fields, std::vector<std::string> const& _values);
+
+// for UT and benchmark
+void clearCompiledCache();
+size_t compiledCacheSize();
+}  // namespace precompiled
+}  // namespace dev
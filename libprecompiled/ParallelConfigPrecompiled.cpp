@@ -22,7 +22,9 @@
 #include "ParallelConfigPrecompiled.h"
 #include <libconfig/GlobalConfigure.h>
 #include <libprecompiled/EntriesPrecompiled.h>
+#include <libethcore/ABIParser.h>
 #include <libprecompiled/TableFactoryPrecompiled.h>
+#include <tbb/concurrent_unordered_map.h>
 #include <boost/algorithm/string.hpp>
 
 using namespace std;
@@ -53,6 +55,55 @@ const string PARA_CONFIG_UNREGISTER_METHOD_ADDR_STR =
 const string PARA_KEY_NAME = PARA_KEY;
 const string PARA_VALUE_NAMES = PARA_SELECTOR + "," + PARA_FUNC_NAME + "," + PARA_CRITICAL_SIZE;
 
+namespace
+{
+// the parsed critical params are shared by all the blocks, the registered functions are few and
+// the cache stops growing at the limit
+const size_t c_maxCachedCriticalParams = 10000;
+tbb::concurrent_unordered_map<string, shared_ptr<const vector<string>>> g_criticalParamsCache;
+
+shared_ptr<const vector<string>> parseCriticalParamsType(
+    string const& _functionName, u256 const& _criticalSize)
+{
+    dev::eth::abi::ABIFunc af;
+    if (!af.parser(_functionName))
+    {
+        PRECOMPILED_LOG(DEBUG) << LOG_BADGE("PARA")
+                               << LOG_DESC("parser function signature failed")
+                               << LOG_KV("func signature", _functionName);
+        return nullptr;
+    }
+    auto paramTypes = af.getParamsType();
+    if (paramTypes.size() < (size_t)_criticalSize)
+    {
+        PRECOMPILED_LOG(DEBUG) << LOG_BADGE("PARA")
+                               << LOG_DESC("params type less than criticalSize")
+                               << LOG_KV("func signature", _functionName)
+                               << LOG_KV("func criticalSize", _criticalSize);
+        return nullptr;
+    }
+    paramTypes.resize((size_t)_criticalSize);
+    return make_shared<const vector<string>>(std::move(paramTypes));
+}
+
+shared_ptr<const vector<string>> getCriticalParamsType(
+    string const& _functionName, u256 const& _criticalSize)
+{
+    auto key = _functionName + "," + toString(_criticalSize);
+    auto it = g_criticalParamsCache.find(key);
+    if (it != g_criticalParamsCache.end())
+    {
+        return it->second;
+    }
+    auto paramsType = parseCriticalParamsType(_functionName, _criticalSize);
+    if (g_criticalParamsCache.size() < c_maxCachedCriticalParams)
+    {
+        g_criticalParamsCache.insert(make_pair(key, paramsType));
+    }
+    return paramsType;
+}
+}  // namespace
+
 
 ParallelConfigPrecompiled::ParallelConfigPrecompiled()
 {
@@ -241,6 +292,10 @@ ParallelConfig::Ptr ParallelConfigPrecompiled::getParallelConfig(
         {
             criticalSize = boost::lexical_cast<u256>(entry->getField(PARA_CRITICAL_SIZE));
         }
-        return make_shared<ParallelConfig>(ParallelConfig{funtionName, criticalSize});
+        auto config = make_shared<ParallelConfig>();
+        config->functionName = funtionName;
+        config->criticalSize = criticalSize;
+        config->criticalParamsType = getCriticalParamsType(funtionName, criticalSize);
+        return config;
     }
 }
@@ -40,6 +40,8 @@ struct ParallelConfig
     typedef std::shared_ptr<ParallelConfig> Ptr;
     std::string functionName;
     u256 criticalSize;
+    /// the types of the first criticalSize params of the function, null if they can't be parsed
+    std::shared_ptr<const std::vector<std::string>> criticalParamsType;
 };
 
 const std::string PARA_CONFIG_TABLE_PREFIX = "_contract_parafunc_";
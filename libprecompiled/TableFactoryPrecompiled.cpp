@@ -42,11 +42,13 @@ using namespace dev::precompiled;
 
 const char* const TABLE_METHOD_OPT_STR = "openTable(string)";
 const char* const TABLE_METHOD_CRT_STR_STR = "createTable(string,string,string)";
+const char* const TABLE_METHOD_CRT_STR_STR_STR = "createTable(string,string,string,string)";
 
 TableFactoryPrecompiled::TableFactoryPrecompiled()
 {
     name2Selector[TABLE_METHOD_OPT_STR] = getFuncSelector(TABLE_METHOD_OPT_STR);
     name2Selector[TABLE_METHOD_CRT_STR_STR] = getFuncSelector(TABLE_METHOD_CRT_STR_STR);
+    name2Selector[TABLE_METHOD_CRT_STR_STR_STR] = getFuncSelector(TABLE_METHOD_CRT_STR_STR_STR);
 }
 
 std::string TableFactoryPrecompiled::toString()
@@ -88,8 +90,10 @@ PrecompiledExecResult::Ptr TableFactoryPrecompiled::call(ExecutiveContext::Ptr c
         }
         callResult->setExecResult(abi.abiIn("", address));
     }
-    else if (func == name2Selector[TABLE_METHOD_CRT_STR_STR])
-    {  // createTable(string,string,string)
+    else if (func == name2Selector[TABLE_METHOD_CRT_STR_STR] ||
+             (g_BCOSConfig.version() >= V2_7_0 &&
+                 func == name2Selector[TABLE_METHOD_CRT_STR_STR_STR]))
+    {  // createTable(string,string,string) or createTable(string,string,string,string)
         if (g_BCOSConfig.version() >= V2_3_0 && !checkAuthority(context, origin, sender))
         {
             PRECOMPILED_LOG(ERROR)
@@ -101,9 +105,18 @@ PrecompiledExecResult::Ptr TableFactoryPrecompiled::call(ExecutiveContext::Ptr c
         string tableName;
         string keyField;
         string valueFiled;
-        abi.abiOut(data, tableName, keyField, valueFiled);
+        string indexFields;
+        if (func == name2Selector[TABLE_METHOD_CRT_STR_STR])
+        {
+            abi.abiOut(data, tableName, keyField, valueFiled);
+        }
+        else
+        {
+            abi.abiOut(data, tableName, keyField, valueFiled, indexFields);
+        }
         PRECOMPILED_LOG(DEBUG) << LOG_BADGE("TableFactory") << LOG_KV("createTable", tableName)
-                               << LOG_KV("keyField", keyField) << LOG_KV("valueFiled", valueFiled);
+                               << LOG_KV("keyField", keyField) << LOG_KV("valueFiled", valueFiled)
+                               << LOG_KV("indexFields", indexFields);
         vector<string> fieldNameList;
         boost::split(fieldNameList, valueFiled, boost::is_any_of(","));
         boost::trim(keyField);
@@ -153,8 +166,23 @@ PrecompiledExecResult::Ptr TableFactoryPrecompiled::call(ExecutiveContext::Ptr c
         }
         try
         {
-            auto table =
-                m_memoryTableFactory->createTable(tableName, keyField, valueFiled, true, origin);
+            Table::Ptr table;
+            if (indexFields.empty())
+            {
+                table =
+                    m_memoryTableFactory->createTable(tableName, keyField, valueFiled, true, origin);
+            }
+            else
+            {
+                vector<string> indexFieldList;
+                boost::split(indexFieldList, indexFields, boost::is_any_of(","));
+                for (auto& str : indexFieldList)
+                {
+                    boost::trim(str);
+                }
+                table = m_memoryTableFactory->createIndexedTable(
+                    tableName, keyField, valueFiled, indexFieldList, true, origin);
+            }
             if (!table)
             {  // table already exist
                 result = CODE_TABLE_NAME_ALREADY_EXIST;
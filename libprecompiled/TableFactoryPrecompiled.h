@@ -34,11 +34,13 @@ namespace precompiled
 #if 0
 {
     "56004b6a": "createTable(string,string,string)",
+    "0a531dfd": "createTable(string,string,string,string)",
     "f23f63c9": "openTable(string)"
 }
 contract TableFactory {
     function openTable(string) public constant returns (Table);
     function createTable(string, string, string) public returns (int);
+    function createTable(string, string, string, string) public returns (int);
 }
 #endif
 
@@ -1,4 +1,5 @@
 pragma solidity ^0.4.24;
+pragma experimental ABIEncoderV2;
 
 contract CRUDPrecompiled {
     function insert(string tableName, string key, string entry, string)
@@ -19,4 +20,41 @@ contract CRUDPrecompiled {
         string condition,
         string
     ) public returns (int256);
+
+    // ABI encoded entry and condition, supported since 2.7.0
+    // conditionOps: 0 eq, 1 ge, 2 gt, 3 le, 4 lt, 5 ne, 6 limit("offset,count")
+    function insert(
+        string tableName,
+        string key,
+        string[] fields,
+        string[] values,
+        string
+    ) public returns (int256);
+    function remove(
+        string tableName,
+        string key,
+        string[] conditionFields,
+        int256[] conditionOps,
+        string[] conditionValues,
+        string
+    ) public returns (int256);
+    // values are flattened row by row
+    function select(
+        string tableName,
+        string key,
+        string[] conditionFields,
+        int256[] conditionOps,
+        string[] conditionValues,
+        string
+    ) public view returns (string[] fields, string[] values);
+    function update(
+        string tableName,
+        string key,
+        string[] fields,
+        string[] values,
+        string[] conditionFields,
+        int256[] conditionOps,
+        string[] conditionValues,
+        string
+    ) public returns (int256);
 }
@@ -3,6 +3,7 @@ pragma solidity ^0.4.24;
 contract TableFactory {
     function openTable(string) public view returns (Table); //open table
     function createTable(string, string, string) public returns (int256); //create table
+    function createTable(string, string, string, string) public returns (int256); //create table with indexed fields
 }
 
 //select condition
@@ -0,0 +1,83 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : the http endpoint for Prometheus to scrape the metrics of the node
+ * @file: MetricsHttpServer.cpp
+ */
+#include "MetricsHttpServer.h"
+#include <libdevcore/Log.h>
+#include <libdevcore/Metrics.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <cstring>
+
+using namespace std;
+using namespace dev;
+
+bool MetricsHttpServer::startListening()
+{
+    if (m_daemon)
+    {
+        return true;
+    }
+    struct sockaddr_in sock;
+    memset(&sock, 0, sizeof(sock));
+    sock.sin_family = AF_INET;
+    sock.sin_port = htons(m_port);
+    sock.sin_addr.s_addr = inet_addr(m_address.c_str());
+    // scraped every few seconds, one thread is enough
+    m_daemon = MHD_start_daemon(MHD_USE_SELECT_INTERNALLY, m_port, NULL, NULL,
+        MetricsHttpServer::callback, this, MHD_OPTION_SOCK_ADDR, &sock, MHD_OPTION_END);
+    LOG(INFO) << LOG_BADGE("MetricsHttpServer") << LOG_DESC("start")
+              << LOG_KV("address", m_address) << LOG_KV("port", m_port)
+              << LOG_KV("succ", m_daemon != nullptr);
+    return m_daemon != nullptr;
+}
+
+void MetricsHttpServer::stopListening()
+{
+    if (m_daemon)
+    {
+        MHD_stop_daemon(m_daemon);
+        m_daemon = nullptr;
+    }
+}
+
+int MetricsHttpServer::callback(void*, MHD_Connection* _connection, const char* _url,
+    const char* _method, const char*, const char*, size_t*, void**)
+{
+    std::string body;
+    unsigned int code = MHD_HTTP_OK;
+    if (std::string("GET") != _method)
+    {
+        code = MHD_HTTP_METHOD_NOT_ALLOWED;
+    }
+    else if (std::string("/metrics") != _url && std::string("/") != _url)
+    {
+        code = MHD_HTTP_NOT_FOUND;
+    }
+    else
+    {
+        body = MetricsRegistry::instance().prometheusText();
+    }
+    struct MHD_Response* response = MHD_create_response_from_buffer(
+        body.size(), static_cast<void*>(const_cast<char*>(body.c_str())), MHD_RESPMEM_MUST_COPY);
+    MHD_add_response_header(response, "Content-Type", "text/plain; version=0.0.4");
+    int ret = MHD_queue_response(_connection, code, response);
+    MHD_destroy_response(response);
+    return ret;
+}
@@ -0,0 +1,50 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : the http endpoint for Prometheus to scrape the metrics of the node
+ * @file: MetricsHttpServer.h
+ */
+#pragma once
+
+#include <microhttpd.h>
+#include <memory>
+#include <string>
+
+namespace dev
+{
+/// GET http://address:port/metrics returns the metrics in the Prometheus text format
+class MetricsHttpServer
+{
+public:
+    using Ptr = std::shared_ptr<MetricsHttpServer>;
+    MetricsHttpServer(std::string const& _address, int _port) : m_address(_address), m_port(_port)
+    {}
+    ~MetricsHttpServer() { stopListening(); }
+
+    bool startListening();
+    void stopListening();
+
+private:
+    static int callback(void* _cls, struct MHD_Connection* _connection, const char* _url,
+        const char* _method, const char* _version, const char* _uploadData,
+        size_t* _uploadDataSize, void** _conCls);
+
+    std::string m_address;
+    int m_port;
+    struct MHD_Daemon* m_daemon = nullptr;
+};
+}  // namespace dev
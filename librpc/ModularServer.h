@@ -26,6 +26,7 @@
 #include <jsonrpccpp/server/abstractserverconnector.h>
 #include <jsonrpccpp/server/iprocedureinvokationhandler.h>
 #include <jsonrpccpp/server/requesthandlerfactory.h>
+#include <libdevcore/Metrics.h>
 #include <libstat/ChannelNetworkStatHandler.h>
 #include <boost/throw_exception.hpp>
 #include <chrono>
@@ -163,7 +164,11 @@ public:
             return;
         for (auto const& method : m_interface->methods())
         {
-            m_methods[std::get<0>(method).GetProcedureName()] = std::get<1>(method);
+            auto const& procedureName = std::get<0>(method).GetProcedureName();
+            m_methods[procedureName] = std::get<1>(method);
+            m_latencies[procedureName] = MetricsRegistry::instance().histogram(
+                "bcos_rpc_latency_us", "latency of the rpc methods in microseconds",
+                "method=\"" + procedureName + "\"");
             this->m_handler->AddProcedure(std::get<0>(method));
         }
 
@@ -185,6 +190,7 @@ public:
         auto pointer = m_methods.find(procedureName);
         if (pointer != m_methods.end())
         {
+            ScopedMetricTimer timer(m_latencies.at(procedureName));
             try
             {
                 (m_interface.get()->*(pointer->second))(_input, _output);
@@ -228,6 +234,7 @@ public:
 private:
     std::unique_ptr<I> m_interface;
     std::map<std::string, MethodPointer> m_methods;
+    std::map<std::string, MetricHistogram::Ptr> m_latencies;
     std::map<std::string, NotificationPointer> m_notifications;
 };
 }  // namespace dev
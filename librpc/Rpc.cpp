@@ -25,6 +25,7 @@
 #include <jsonrpccpp/server.h>
 #include <libconfig/GlobalConfigure.h>
 #include <libdevcore/CommonData.h>
+#include <libdevcore/Metrics.h>
 #include <libethcore/Common.h>
 #include <libethcore/CommonJS.h>
 #include <libethcore/Transaction.h>
@@ -551,6 +552,20 @@ Json::Value Rpc::getGroupList()
     }
 }
 
+Json::Value Rpc::getMetrics()
+{
+    try
+    {
+        RPC_LOG(DEBUG) << LOG_BADGE("getMetrics") << LOG_DESC("request");
+        return Json::Value(MetricsRegistry::instance().prometheusText());
+    }
+    catch (std::exception& e)
+    {
+        BOOST_THROW_EXCEPTION(
+            JsonRpcException(Errors::ERROR_RPC_INTERNAL_ERROR, boost::diagnostic_information(e)));
+    }
+}
+
 
 Json::Value Rpc::getBlockByHash(
     int _groupID, const std::string& _blockHash, bool _includeTransactions)
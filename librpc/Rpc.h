@@ -103,6 +103,7 @@ public:
     Json::Value getPeers(int) override;
     Json::Value getGroupPeers(int _groupID) override;
     Json::Value getGroupList() override;
+    Json::Value getMetrics() override;
     Json::Value getNodeIDList(int _groupID) override;
 
     // block part
@@ -77,6 +77,9 @@ public:
         this->bindAndAddMethod(jsonrpc::Procedure("getGroupList", jsonrpc::PARAMS_BY_POSITION,
                                    jsonrpc::JSON_OBJECT, NULL),
             &dev::rpc::RpcFace::getGroupListI);
+        this->bindAndAddMethod(jsonrpc::Procedure("getMetrics", jsonrpc::PARAMS_BY_POSITION,
+                                   jsonrpc::JSON_STRING, NULL),
+            &dev::rpc::RpcFace::getMetricsI);
         this->bindAndAddMethod(jsonrpc::Procedure("getNodeIDList", jsonrpc::PARAMS_BY_POSITION,
                                    jsonrpc::JSON_OBJECT, "param1", jsonrpc::JSON_INTEGER, NULL),
             &dev::rpc::RpcFace::getNodeIDListI);
@@ -244,6 +247,10 @@ public:
     {
         response = this->getGroupList();
     }
+    inline virtual void getMetricsI(const Json::Value&, Json::Value& response)
+    {
+        response = this->getMetrics();
+    }
     inline virtual void getNodeIDListI(const Json::Value& request, Json::Value& response)
     {
         response = this->getNodeIDList(boost::lexical_cast<int>(request[0u].asString()));
@@ -401,6 +408,8 @@ public:
     virtual Json::Value getPeers(int param1) = 0;
     virtual Json::Value getGroupPeers(int param1) = 0;
     virtual Json::Value getGroupList() = 0;
+    // the metrics of the node in the Prometheus text format
+    virtual Json::Value getMetrics() = 0;
     virtual Json::Value getNodeIDList(int param1) = 0;
 
     // block part
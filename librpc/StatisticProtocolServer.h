@@ -69,7 +69,7 @@ protected:
         "startGroup", "stopGroup", "removeGroup", "recoverGroup", "queryGroupStatus"};
 
     // RPC interface without restrictions
-    std::set<std::string> const m_noRestrictRpcMethodSet = {"getClientVersion"};
+    std::set<std::string> const m_noRestrictRpcMethodSet = {"getClientVersion", "getMetrics"};
 
     dev::stat::ChannelNetworkStatHandler::Ptr m_networkStatHandler;
     dev::flowlimit::RPCQPSLimiter::Ptr m_qpsLimiter;
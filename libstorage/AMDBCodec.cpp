@@ -0,0 +1,363 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : the binary framing of the table data between SQLStorage and amdb-proxy
+ * @file: AMDBCodec.cpp
+ */
+#include "AMDBCodec.h"
+#include "Common.h"
+#include "StorageException.h"
+#include <boost/lexical_cast.hpp>
+#include <unordered_map>
+
+using namespace std;
+using namespace dev;
+using namespace dev::storage;
+
+namespace
+{
+const byte c_magic[] = {0, 'A', 'M', 'B'};
+const uint32_t c_absentValue = 0xFFFFFFFF;
+
+template <typename T>
+void appendValue(bytes& _frame, T _value)
+{
+    for (int i = sizeof(T) - 1; i >= 0; --i)
+    {
+        _frame.push_back((byte)((uint64_t)_value >> (i * 8)));
+    }
+}
+
+void appendString(bytes& _frame, const std::string& _value)
+{
+    appendValue<uint32_t>(_frame, _value.size());
+    _frame.insert(_frame.end(), _value.begin(), _value.end());
+}
+
+void appendHeader(bytes& _frame)
+{
+    _frame.insert(_frame.end(), std::begin(c_magic), std::end(c_magic));
+    appendValue<uint8_t>(_frame, AMDBCodec::c_binaryProtocolVersion);
+}
+
+/// encode the entries of a table with the dictionary of all their columns
+class TableEncoder
+{
+public:
+    TableEncoder(bool _withNum) : m_withNum(_withNum)
+    {
+        addColumn(ID_FIELD);
+        addColumn(STATUS);
+        if (m_withNum)
+        {
+            addColumn(NUM_FIELD);
+        }
+    }
+
+    void addColumns(const Entries& _entries)
+    {
+        for (const auto& entry : _entries)
+        {
+            for (const auto& field : *entry)
+            {
+                addColumn(field.first);
+            }
+        }
+    }
+
+    void encodeColumns(bytes& _frame)
+    {
+        appendValue<uint32_t>(_frame, m_columns.size());
+        for (const auto& column : m_columns)
+        {
+            appendString(_frame, column);
+        }
+    }
+
+    void encodeRow(const Entry& _entry, bytes& _frame)
+    {
+        m_values.assign(m_columns.size(), nullptr);
+        for (const auto& field : _entry)
+        {
+            m_values[m_indexes[field.first]] = &field.second;
+        }
+        m_id = boost::lexical_cast<std::string>(_entry.getID());
+        m_values[0] = &m_id;
+        m_status = boost::lexical_cast<std::string>(_entry.getStatus());
+        m_values[1] = &m_status;
+        if (m_withNum)
+        {
+            m_num = boost::lexical_cast<std::string>(_entry.num());
+            m_values[2] = &m_num;
+        }
+
+        auto offset = _frame.size();
+        appendValue<uint32_t>(_frame, 0);
+        for (auto value : m_values)
+        {
+            if (value)
+            {
+                appendString(_frame, *value);
+            }
+            else
+            {
+                appendValue<uint32_t>(_frame, c_absentValue);
+            }
+        }
+        uint32_t rowLength = _frame.size() - offset - sizeof(uint32_t);
+        for (size_t i = 0; i < sizeof(uint32_t); ++i)
+        {
+            _frame[offset + i] = (byte)(rowLength >> ((sizeof(uint32_t) - 1 - i) * 8));
+        }
+    }
+
+private:
+    void addColumn(const std::string& _column)
+    {
+        if (m_indexes.emplace(_column, m_columns.size()).second)
+        {
+            m_columns.push_back(_column);
+        }
+    }
+
+    bool m_withNum;
+    std::vector<std::string> m_columns;
+    std::unordered_map<std::string, size_t> m_indexes;
+    std::vector<const std::string*> m_values;
+    std::string m_id;
+    std::string m_status;
+    std::string m_num;
+};
+
+class Decoder
+{
+public:
+    Decoder(bytesConstRef _frame) : m_frame(_frame) {}
+
+    template <typename T>
+    T value()
+    {
+        auto data = next(sizeof(T));
+        uint64_t value = 0;
+        for (size_t i = 0; i < sizeof(T); ++i)
+        {
+            value = (value << 8) | data[i];
+        }
+        return (T)value;
+    }
+
+    std::string str()
+    {
+        auto size = value<uint32_t>();
+        return std::string((const char*)next(size), size);
+    }
+
+    void header()
+    {
+        if (!AMDBCodec::isBinaryFrame(m_frame))
+        {
+            BOOST_THROW_EXCEPTION(StorageException(-1, "Decode amdb frame failed: no magic"));
+        }
+        next(sizeof(c_magic));
+        auto version = value<uint8_t>();
+        if (version != AMDBCodec::c_binaryProtocolVersion)
+        {
+            BOOST_THROW_EXCEPTION(StorageException(
+                -1, "Decode amdb frame failed: unsupported version " + std::to_string(version)));
+        }
+    }
+
+    bool end() const { return m_offset == m_frame.size(); }
+
+    /// decode the rows of a table into entries
+    void table(Entries& _entries)
+    {
+        std::vector<std::string> columns(value<uint32_t>());
+        for (auto& column : columns)
+        {
+            column = str();
+        }
+        auto rows = value<uint32_t>();
+        for (uint32_t i = 0; i < rows; ++i)
+        {
+            size_t rowEnd = value<uint32_t>();
+            rowEnd += m_offset;
+            auto entry = std::make_shared<Entry>();
+            for (const auto& column : columns)
+            {
+                auto size = value<uint32_t>();
+                if (size == c_absentValue)
+                {
+                    continue;
+                }
+                auto data = (const char*)next(size);
+                // keep _id_, _num_ and _status_ as fields like the json rows, the callers read
+                // them by getField
+                entry->setField(column, (const byte*)data, size);
+                if (column == ID_FIELD)
+                {
+                    entry->setID(std::string(data, size));
+                }
+                else if (column == NUM_FIELD)
+                {
+                    entry->setNum(std::string(data, size));
+                }
+                else if (column == STATUS)
+                {
+                    entry->setStatus(std::string(data, size));
+                }
+            }
+            if (m_offset != rowEnd)
+            {
+                BOOST_THROW_EXCEPTION(
+                    StorageException(-1, "Decode amdb frame failed: mismatched row length"));
+            }
+            _entries.addEntry(entry);
+        }
+    }
+
+private:
+    const byte* next(size_t _size)
+    {
+        if (m_offset + _size > m_frame.size())
+        {
+            BOOST_THROW_EXCEPTION(
+                StorageException(-1, "Decode amdb frame failed: unexpected end of data"));
+        }
+        auto data = m_frame.data() + m_offset;
+        m_offset += _size;
+        return data;
+    }
+
+    bytesConstRef m_frame;
+    size_t m_offset = 0;
+};
+}  // namespace
+
+bool AMDBCodec::isBinaryFrame(bytesConstRef _frame)
+{
+    return _frame.size() > sizeof(c_magic) &&
+           std::equal(std::begin(c_magic), std::end(c_magic), _frame.data());
+}
+
+void AMDBCodec::encodeCommit(int64_t _num, const std::vector<TableData::Ptr>& _datas, bytes& _frame)
+{
+    appendHeader(_frame);
+    appendValue<uint8_t>(_frame, Op::Commit);
+    appendValue<int64_t>(_frame, _num);
+
+    auto tablesOffset = _frame.size();
+    uint32_t tables = 0;
+    appendValue<uint32_t>(_frame, tables);
+    for (const auto& data : _datas)
+    {
+        auto rows = data->dirtyEntries->size() + data->newEntries->size();
+        if (rows == 0)
+        {
+            continue;
+        }
+        ++tables;
+        appendString(_frame, data->info->name);
+        TableEncoder encoder(false);
+        encoder.addColumns(*data->dirtyEntries);
+        encoder.addColumns(*data->newEntries);
+        encoder.encodeColumns(_frame);
+        appendValue<uint32_t>(_frame, rows);
+        for (const auto& entry : *data->dirtyEntries)
+        {
+            encoder.encodeRow(*entry, _frame);
+        }
+        for (const auto& entry : *data->newEntries)
+        {
+            encoder.encodeRow(*entry, _frame);
+        }
+    }
+    bytes tablesValue;
+    appendValue<uint32_t>(tablesValue, tables);
+    std::copy(tablesValue.begin(), tablesValue.end(), _frame.begin() + tablesOffset);
+}
+
+int64_t AMDBCodec::decodeCommit(bytesConstRef _frame, std::vector<TableData::Ptr>& _datas)
+{
+    Decoder decoder(_frame);
+    decoder.header();
+    auto op = decoder.value<uint8_t>();
+    if (op != Op::Commit)
+    {
+        BOOST_THROW_EXCEPTION(
+            StorageException(-1, "Decode amdb frame failed: unknown op " + std::to_string(op)));
+    }
+    auto num = decoder.value<int64_t>();
+    auto tables = decoder.value<uint32_t>();
+    for (uint32_t i = 0; i < tables; ++i)
+    {
+        auto data = std::make_shared<TableData>();
+        data->info->name = decoder.str();
+        decoder.table(*data->newEntries);
+        _datas.push_back(data);
+    }
+    return num;
+}
+
+void AMDBCodec::encodeCommitResult(int32_t _code, int64_t _count, bytes& _frame)
+{
+    appendHeader(_frame);
+    appendValue<int32_t>(_frame, _code);
+    appendValue<int64_t>(_frame, _count);
+}
+
+int64_t AMDBCodec::decodeCommitResult(bytesConstRef _frame)
+{
+    Decoder decoder(_frame);
+    decoder.header();
+    decoder.value<int32_t>();
+    return decoder.value<int64_t>();
+}
+
+void AMDBCodec::encodeRows(int32_t _code, const Entries& _entries, bytes& _frame)
+{
+    appendHeader(_frame);
+    appendValue<int32_t>(_frame, _code);
+    TableEncoder encoder(true);
+    encoder.addColumns(_entries);
+    encoder.encodeColumns(_frame);
+    appendValue<uint32_t>(_frame, _entries.size());
+    for (const auto& entry : _entries)
+    {
+        encoder.encodeRow(*entry, _frame);
+    }
+}
+
+int32_t AMDBCodec::decodeRows(bytesConstRef _frame, Entries::Ptr _entries)
+{
+    Decoder decoder(_frame);
+    decoder.header();
+    auto code = decoder.value<int32_t>();
+    // the table may be omitted by the error response
+    if (!decoder.end())
+    {
+        decoder.table(*_entries);
+    }
+    return code;
+}
+
+int32_t AMDBCodec::decodeCode(bytesConstRef _frame)
+{
+    Decoder decoder(_frame);
+    decoder.header();
+    return decoder.value<int32_t>();
+}
@@ -0,0 +1,76 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : the binary framing of the table data between SQLStorage and amdb-proxy
+ * @file: AMDBCodec.h
+ */
+#pragma once
+
+#include "Table.h"
+#include <libdevcore/Common.h>
+
+namespace dev
+{
+namespace storage
+{
+/**
+ * @brief The binary protocol is used after the proxy answers the "protocol" op with a version no
+ * less than c_binaryProtocolVersion, the json protocol is used otherwise.
+ *
+ * All the integers are big endian. A frame starts with the magic "\0AMB", which is never the
+ * beginning of a json, and the protocol version:
+ * request:  magic | version(u8) | op(u8) | num(i64) | tables(u32) | {name | table}...
+ * response: magic | version(u8) | code(i32) | table
+ * commit response: magic | version(u8) | code(i32) | count(i64)
+ * table:    columns(u32) | {column}... | rows(u32) | {rowLength(u32) | {value}...}...
+ * A column or a value is length(u32) | bytes, the length of a value is 0xFFFFFFFF if the entry
+ * doesn't have the column. _id_ and _status_ are always the first columns.
+ *
+ * The commit is sent as a request frame and answered by json or a commit response frame, the select
+ * is sent by json with "format":"binary" and answered by a response frame.
+ */
+class AMDBCodec
+{
+public:
+    enum Op : uint8_t
+    {
+        Commit = 1
+    };
+
+    static const uint8_t c_binaryProtocolVersion = 1;
+
+    static bool isBinaryFrame(bytesConstRef _frame);
+
+    /// encode the dirty and new entries of the tables committed in the block _num
+    static void encodeCommit(int64_t _num, const std::vector<TableData::Ptr>& _datas,
+        bytes& _frame);
+    /// decode the commit request into the new entries of the tables
+    static int64_t decodeCommit(bytesConstRef _frame, std::vector<TableData::Ptr>& _datas);
+    /// encode the response to the commit with the count of the committed rows
+    static void encodeCommitResult(int32_t _code, int64_t _count, bytes& _frame);
+    /// @return the count of the committed rows in the commit response
+    static int64_t decodeCommitResult(bytesConstRef _frame);
+
+    /// encode the entries responded to the select with their _num_
+    static void encodeRows(int32_t _code, const Entries& _entries, bytes& _frame);
+    /// @return the code of the response, the rows are appended to _entries
+    static int32_t decodeRows(bytesConstRef _frame, Entries::Ptr _entries);
+    /// @return the code of the response
+    static int32_t decodeCode(bytesConstRef _frame);
+};
+}  // namespace storage
+}  // namespace dev
@@ -33,6 +33,14 @@ using namespace std;
 using namespace dev;
 using namespace dev::storage;
 
+namespace
+{
+// the keys are sharded by hash, every shard is touched and swept under its own lock
+const size_t c_mruShards = 32;
+// the max keys swept out of a shard at a time
+const size_t c_sweepBatch = 64;
+}  // namespace
+
 Cache::Cache()
 {
     m_entries = std::make_shared<Entries>();
@@ -99,27 +107,107 @@ void Cache::setTableInfo(TableInfo::Ptr tableInfo)
     m_tableInfo = tableInfo;
 }
 
+void ClockShard::touch(const std::string& table, const std::string& key)
+{
+    tbb::spin_mutex::scoped_lock lock(m_mutex);
+    auto it = m_index.find(std::make_pair(table, key));
+    if (it != m_index.end())
+    {
+        it->second->referenced = true;
+        return;
+    }
+
+    auto result = m_index.emplace(std::make_pair(table, key), m_items.end());
+    result.first->second = m_items.insert(m_hand, Item{&(result.first->first), false});
+}
+
+std::vector<ClockShard::Key> ClockShard::sweep(size_t _num)
+{
+    std::vector<Key> keys;
+    tbb::spin_mutex::scoped_lock lock(m_mutex);
+    // every key is passed by the hand at most twice
+    for (size_t steps = m_items.size() * 2; steps > 0 && keys.size() < _num && !m_items.empty();
+         --steps)
+    {
+        if (m_hand == m_items.end())
+        {
+            m_hand = m_items.begin();
+        }
+        if (m_hand->referenced)
+        {
+            m_hand->referenced = false;
+            ++m_hand;
+            continue;
+        }
+        keys.push_back(*(m_hand->key));
+        m_index.erase(keys.back());
+        m_hand = m_items.erase(m_hand);
+    }
+    return keys;
+}
+
+void ClockShard::erase(const std::string& table, const std::string& key)
+{
+    tbb::spin_mutex::scoped_lock lock(m_mutex);
+    auto it = m_index.find(std::make_pair(table, key));
+    if (it == m_index.end())
+    {
+        return;
+    }
+
+    if (m_hand == it->second)
+    {
+        m_hand = m_items.erase(it->second);
+    }
+    else
+    {
+        m_items.erase(it->second);
+    }
+    m_index.erase(it);
+}
+
+size_t ClockShard::size()
+{
+    tbb::spin_mutex::scoped_lock lock(m_mutex);
+    return m_items.size();
+}
+
 CachedStorage::CachedStorage(dev::GROUP_ID const& _groupID) : m_groupID(_groupID)
 {
     CACHED_STORAGE_LOG(INFO) << "Init flushStorage thread";
-    m_taskThreadPool =
-        std::make_shared<dev::ThreadPool>("taskPool-" + std::to_string(m_groupID), 1);
-
-    m_asyncThreadPool =
-        std::make_shared<dev::ThreadPool>("touchMRU-" + std::to_string(m_groupID), 1);
-
-    m_mruQueue =
-        std::make_shared<tbb::concurrent_queue<std::tuple<std::string, std::string, ssize_t>>>();
-    m_mru = std::make_shared<boost::multi_index_container<std::pair<std::string, std::string>,
-        boost::multi_index::indexed_by<boost::multi_index::sequenced<>,
-            boost::multi_index::hashed_unique<
-                boost::multi_index::identity<std::pair<std::string, std::string>>>>>>();
+    m_taskThreadPool = dev::createSerialWorker("taskPool-" + std::to_string(m_groupID));
+
+    for (size_t i = 0; i < c_mruShards; ++i)
+    {
+        m_mru.push_back(std::make_shared<ClockShard>());
+    }
     m_syncNum.store(0);
     m_commitNum.store(0);
     m_capacity.store(0);
 
     m_hitTimes.store(0);
     m_queryTimes.store(0);
+    m_compressedHitTimes.store(0);
+    m_compressedQueryTimes.store(0);
+
+    auto groupLabel = metrics::groupLabel(m_groupID);
+    m_queryMetric = MetricsRegistry::instance().counter(
+        "bcos_storage_cache_query_total", "queries to the cache of the storage", groupLabel);
+    m_hitMetric = MetricsRegistry::instance().counter(
+        "bcos_storage_cache_hit_total", "queries hit the cache of the storage", groupLabel);
+    m_capacityMetric = MetricsRegistry::instance().gauge(
+        "bcos_storage_cache_bytes", "bytes of the entries in the cache of the storage", groupLabel);
+    m_compressedQueryMetric =
+        MetricsRegistry::instance().counter("bcos_storage_compressed_cache_query_total",
+            "queries to the compressed cache of the storage", groupLabel);
+    m_compressedHitMetric = MetricsRegistry::instance().counter(
+        "bcos_storage_compressed_cache_hit_total",
+        "queries hit the compressed cache of the storage", groupLabel);
+    m_compressedCapacityMetric = MetricsRegistry::instance().gauge(
+        "bcos_storage_compressed_cache_bytes",
+        "compressed bytes of the entries in the compressed cache of the storage", groupLabel);
+    m_clearMetric = MetricsRegistry::instance().histogram("bcos_storage_cache_clear_us",
+        "time to check and clear the cache of the storage in microseconds", groupLabel);
 
     m_running = std::make_shared<tbb::atomic<bool>>();
     m_running->store(true);
@@ -189,9 +277,7 @@ std::tuple<std::shared_ptr<Cache::RWScoped>, Cache::Ptr> CachedStorage::selectNo
     {
         if (m_backend)
         {
-            auto conditionKey = std::make_shared<Condition>();
-            conditionKey->EQ(tableInfo->key, key);
-            auto backendData = m_backend->select(num, tableInfo, key, conditionKey);
+            auto backendData = loadEntries(num, tableInfo, key);
 
             CACHED_STORAGE_LOG(TRACE) << tableInfo->name << ": " << key << " miss the cache";
 
@@ -278,10 +364,8 @@ size_t CachedStorage::commit(int64_t num, const std::vector<TableData::Ptr>& dat
                                     {
                                         if (m_backend)
                                         {
-                                            auto conditionKey = std::make_shared<Condition>();
-                                            conditionKey->EQ(requestData->info->key, key);
-                                            auto backendData = m_backend->select(
-                                                num, requestData->info, key, conditionKey);
+                                            auto backendData =
+                                                loadEntries(num, requestData->info, key);
 
                                             CACHED_STORAGE_LOG(DEBUG)
                                                 << requestData->info->name << "-" << key
@@ -442,6 +526,10 @@ size_t CachedStorage::commit(int64_t num, const std::vector<TableData::Ptr>& dat
                                 auto result = touchCache(commitData->info, key, true);
 
                                 auto caches = std::get<1>(result);
+                                if (caches->empty() && m_compressedCache)
+                                {  // the forced entry is not queried, drop the evicted entries
+                                    m_compressedCache->erase(commitData->info->name, key);
+                                }
                                 caches->setNum(num);
                                 caches->entries()->addEntry(cacheEntry);
                                 caches->setEmpty(false);
@@ -454,10 +542,8 @@ size_t CachedStorage::commit(int64_t num, const std::vector<TableData::Ptr>& dat
                                 {
                                     if (m_backend)
                                     {
-                                        auto conditionKey = std::make_shared<Condition>();
-                                        conditionKey->EQ(commitData->info->key, key);
-                                        auto backendData = m_backend->select(
-                                            num, commitData->info, key, conditionKey);
+                                        auto backendData =
+                                            loadEntries(num, commitData->info, key);
 
                                         CACHED_STORAGE_LOG(TRACE)
                                             << commitData->info->name << "-" << key
@@ -513,11 +599,16 @@ size_t CachedStorage::commit(int64_t num, const std::vector<TableData::Ptr>& dat
 
         if (!disabled())
         {
-            m_taskThreadPool->enqueue([task, self]() {
+            {
+                std::lock_guard<Mutex> lock(m_pendingTasksMutex);
+                m_pendingTasks.push_back(task);
+            }
+            // the pending tasks are committed together if the backend is slower than the blocks
+            m_taskThreadPool->enqueue([self]() {
                 auto storage = self.lock();
                 if (storage)
                 {
-                    storage->commitBackend(task);
+                    storage->commitPendingTasks();
                 }
             });
 
@@ -633,6 +724,10 @@ void CachedStorage::clear()
     RWMutexScoped lockCache(m_cachesMutex, true);
 
     m_caches.clear();
+    if (m_compressedCache)
+    {
+        m_compressedCache->clear();
+    }
 }
 
 int64_t CachedStorage::syncNum()
@@ -650,11 +745,28 @@ void CachedStorage::setMaxCapacity(int64_t maxCapacity)
     m_maxCapacity = maxCapacity;
 }
 
+void CachedStorage::setMaxCompressedCapacity(int64_t maxCompressedCapacity)
+{
+    if (maxCompressedCapacity > 0)
+    {
+        m_compressedCache = std::make_shared<CompressedCache>(maxCompressedCapacity);
+    }
+    else
+    {
+        m_compressedCache.reset();
+    }
+}
+
 void CachedStorage::setMaxForwardBlock(size_t maxForwardBlock)
 {
     m_maxForwardBlock = maxForwardBlock;
 }
 
+void CachedStorage::setMaxBatchBlock(size_t maxBatchBlock)
+{
+    m_maxBatchBlock = maxBatchBlock;
+}
+
 void CachedStorage::startClearThread()
 {
     std::weak_ptr<CachedStorage> self(std::dynamic_pointer_cast<CachedStorage>(shared_from_this()));
@@ -684,23 +796,69 @@ void CachedStorage::touchMRU(const std::string& table, const std::string& key, s
     {
         return;
     }
-    m_asyncThreadPool->enqueue([this, table, key, capacity]() {
-        m_mruQueue->push(std::make_tuple(table, key, capacity));
-    });
+    if (capacity != 0)
+    {
+        updateCapacity(capacity);
+    }
+    mruShard(table, key)->touch(table, key);
 }
 
-void CachedStorage::updateMRU(const std::string& table, const std::string& key, ssize_t capacity)
+ClockShard::Ptr CachedStorage::mruShard(const std::string& table, const std::string& key)
 {
-    if (capacity != 0)
+    size_t seed = 0;
+    boost::hash_combine(seed, table);
+    boost::hash_combine(seed, key);
+    return m_mru[seed % m_mru.size()];
+}
+
+size_t CachedStorage::mruSize()
+{
+    size_t size = 0;
+    for (auto const& shard : m_mru)
     {
-        updateCapacity(capacity);
+        size += shard->size();
+    }
+    return size;
+}
+
+bool CachedStorage::evictCache(const std::string& table, const std::string& key)
+{
+    auto cacheKey = table + "_" + key;
+    Cache::Ptr cache;
+    {
+        RWMutexScoped lockCache(m_cachesMutex, false);
+        auto it = m_caches.find(cacheKey);
+        if (it == m_caches.end())
+        {  // already removed, nothing to evict
+            return true;
+        }
+        cache = it->second;
+    }
+
+    Cache::RWScoped cacheLock(*(cache->mutex()), true);
+    if (cache->empty())
+    {  // not loaded yet, the next access loads it from the backend
+        return true;
+    }
+    if (cache->num() > m_syncNum)
+    {
+        return false;
     }
 
-    auto r = m_mru->push_back(std::make_pair(table, key));
-    if (!r.second)
+    int64_t totalCapacity = 0;
+    for (auto entryIt : *(cache->entries()))
     {
-        m_mru->relocate(m_mru->end(), r.first);
+        totalCapacity += entryIt->capacity();
     }
+    updateCapacity(0 - totalCapacity);
+    if (m_compressedCache)
+    {
+        m_compressedCache->put(table, key, cache->entries());
+    }
+
+    cache->setEmpty(true);
+    removeCache(table, key);
+    return true;
 }
 
 std::tuple<std::shared_ptr<Cache::RWScoped>, Cache::Ptr, bool> CachedStorage::touchCache(
@@ -709,6 +867,7 @@ std::tuple<std::shared_ptr<Cache::RWScoped>, Cache::Ptr, bool> CachedStorage::to
     bool hit = true;
 
     ++m_queryTimes;
+    m_queryMetric->inc();
 
     auto cache = std::make_shared<Cache>();
     auto cacheKey = tableInfo->name + "_" + key;
@@ -733,12 +892,20 @@ std::tuple<std::shared_ptr<Cache::RWScoped>, Cache::Ptr, bool> CachedStorage::to
     }
     else
     {
-        RWMutexScoped lockCache(m_cachesMutex, false);
-
-        auto result = m_caches.insert(std::make_pair(cacheKey, cache));
-        if (!result.second && cache != result.first->second)
+        while (true)
         {
-            cache = result.first->second;
+            {
+                RWMutexScoped lockCache(m_cachesMutex, false);
+
+                auto result = m_caches.insert(std::make_pair(cacheKey, cache));
+                if (result.second || cache == result.first->second)
+                {
+                    break;
+                }
+                cache = result.first->second;
+            }
+            // lock the replaced cache out of m_cachesMutex, the eviction holds the cache lock
+            // and then waits for m_cachesMutex
             cacheLock.reset();
             cacheLock = std::make_shared<Cache::RWScoped>(*(cache->mutex()), write);
         }
@@ -747,6 +914,7 @@ std::tuple<std::shared_ptr<Cache::RWScoped>, Cache::Ptr, bool> CachedStorage::to
     if (hit)
     {
         ++m_hitTimes;
+        m_hitMetric->inc();
     }
 
     return std::make_tuple(cacheLock, cache, true);
@@ -795,6 +963,29 @@ void CachedStorage::removeCache(const std::string& table, const std::string& key
 
         exit(1);
     }
+    // a select may touch the key again after the sweep, drop it to keep no key without a cache
+    mruShard(table, key)->erase(table, key);
+}
+
+Entries::Ptr CachedStorage::loadEntries(
+    int64_t num, TableInfo::Ptr tableInfo, const std::string& key)
+{
+    if (m_compressedCache)
+    {
+        ++m_compressedQueryTimes;
+        m_compressedQueryMetric->inc();
+        auto entries = m_compressedCache->take(tableInfo->name, key);
+        if (entries)
+        {
+            ++m_compressedHitTimes;
+            m_compressedHitMetric->inc();
+            return entries;
+        }
+    }
+
+    auto conditionKey = std::make_shared<Condition>();
+    conditionKey->EQ(tableInfo->key, key);
+    return m_backend->select(num, tableInfo, key, conditionKey);
 }
 
 bool CachedStorage::disabled()
@@ -839,99 +1030,147 @@ bool CachedStorage::commitBackend(Task::Ptr task)
     return true;
 }
 
-void CachedStorage::checkAndClear()
+void CachedStorage::commitPendingTasks()
 {
-    uint64_t count = 0;
-    // calculate and calculate m_capacity with all elements of m_mruQueue
-    // since inner loop will break once m_mruQueue is empty, here use while(true)
-    while (true)
+    // the backend which commits the whole entries of the keys depends on the order of the blocks
+    size_t maxBatchBlock =
+        m_backend->onlyCommitDirty() ? std::max<uint64_t>(m_maxBatchBlock, 1) : 1;
+    std::vector<Task::Ptr> tasks;
     {
-        std::tuple<std::string, std::string, ssize_t> mru;
-        auto result = m_mruQueue->try_pop(mru);
-        if (!result)
+        std::lock_guard<Mutex> lock(m_pendingTasksMutex);
+        while (!m_pendingTasks.empty() && tasks.size() < maxBatchBlock)
         {
-            break;
+            tasks.push_back(m_pendingTasks.front());
+            m_pendingTasks.pop_front();
         }
-        updateMRU(std::get<0>(mru), std::get<1>(mru), std::get<2>(mru));
-        ++count;
+    }
+    if (tasks.empty())
+    {
+        return;
+    }
+    if (tasks.size() == 1)
+    {
+        commitBackend(tasks.front());
+        return;
     }
 
-    CACHED_STORAGE_LOG(DEBUG) << "CheckAndClear pop: " << count << " elements";
-
-    TIME_RECORD("Check and clear");
+    TIME_RECORD("Merge blocks");
+    auto task = mergeTasks(tasks);
+    CACHED_STORAGE_LOG(INFO) << LOG_DESC("Merge blocks to commit")
+                             << LOG_KV("from", tasks.front()->num) << LOG_KV("to", task->num)
+                             << LOG_KV("tables", task->datas->size());
+    commitBackend(task);
+}
 
-    bool needClear = false;
-    size_t clearTimes = 0;
+Task::Ptr CachedStorage::mergeTasks(const std::vector<Task::Ptr>& tasks)
+{
+    struct EntryPosition
+    {
+        bool isNew;
+        size_t index;
+    };
 
-    auto currentCapacity = m_capacity.load();
+    auto task = std::make_shared<Task>();
+    task->num = tasks.back()->num;
+    task->datas = std::make_shared<std::vector<TableData::Ptr>>();
 
-    size_t clearCount = 0;
-    size_t clearThrough = 0;
-    do
+    std::map<std::string, size_t> tableIndex;
+    std::vector<std::unordered_map<uint64_t, EntryPosition>> entryIndex;
+    for (auto const& blockTask : tasks)
     {
-        needClear = false;
-        if (m_syncNum > 0)
+        for (auto const& data : *(blockTask->datas))
         {
-            if (m_capacity > m_maxCapacity && !m_mru->empty())
+            auto it = tableIndex.find(data->info->name);
+            if (it == tableIndex.end())
             {
-                needClear = true;
+                it = tableIndex.emplace(data->info->name, task->datas->size()).first;
+                task->datas->push_back(std::make_shared<TableData>());
+                entryIndex.emplace_back();
             }
-        }
+            auto mergedData = (*(task->datas))[it->second];
+            auto& positions = entryIndex[it->second];
+            mergedData->info = data->info;
 
-        if (needClear)
-        {
-            for (auto it = m_mru->begin(); it != m_mru->end() && m_running->load();)
-            {
-                if (m_capacity <= (int64_t)m_maxCapacity || m_mru->empty())
+            auto mergeEntry = [&](Entry::Ptr entry, bool isNew) {
+                auto positionIt = positions.find(entry->getID());
+                if (entry->getID() == 0 || positionIt == positions.end())
                 {
-                    break;
+                    auto entries = isNew ? mergedData->newEntries : mergedData->dirtyEntries;
+                    auto index = entries->addEntry(entry);
+                    if (entry->getID() != 0)
+                    {
+                        positions.emplace(entry->getID(), EntryPosition{isNew, index});
+                    }
+                    return;
                 }
+                // the entry inserted in the previous block is still inserted with the latest
+                // version, or the older version would replace it
+                auto entries =
+                    positionIt->second.isNew ? mergedData->newEntries : mergedData->dirtyEntries;
+                (*entries)[positionIt->second.index] = entry;
+            };
+            for (size_t i = 0; i < data->dirtyEntries->size(); ++i)
+            {
+                mergeEntry(data->dirtyEntries->get(i), false);
+            }
+            for (size_t i = 0; i < data->newEntries->size(); ++i)
+            {
+                mergeEntry(data->newEntries->get(i), true);
+            }
+        }
+    }
+    return task;
+}
 
-                ++clearThrough;
+void CachedStorage::checkAndClear()
+{
+    ScopedMetricTimer timer(m_clearMetric);
+    TIME_RECORD("Check and clear");
 
-                auto tableInfo = std::make_shared<TableInfo>();
-                tableInfo->name = it->first;
+    auto currentCapacity = m_capacity.load();
 
-                auto result = touchCache(tableInfo, it->second, true);
-                auto cache = std::get<1>(result);
-                if (std::get<2>(result))
-                {  // FIXME: if always true, simplify this
-                    if (m_syncNum > 0 && (cache->num() <= m_syncNum))
+    std::atomic<size_t> clearCount = {0};
+    std::atomic<size_t> clearThrough = {0};
+    if (m_syncNum > 0 && m_capacity > m_maxCapacity)
+    {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, m_mru.size()),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i < range.end(); ++i)
+                {
+                    auto shard = m_mru[i];
+                    while (m_capacity > m_maxCapacity && m_running->load())
                     {
-                        int64_t totalCapacity = 0;
-                        for (auto entryIt : *(cache->entries()))
+                        auto keys = shard->sweep(c_sweepBatch);
+                        size_t evicted = 0;
+                        for (auto const& key : keys)
                         {
-                            totalCapacity += entryIt->capacity();
+                            ++clearThrough;
+                            if (evictCache(key.first, key.second))
+                            {
+                                ++evicted;
+                            }
+                            else
+                            {  // not committed to the backend, keep it for the next sweep
+                                shard->touch(key.first, key.second);
+                            }
+                        }
+                        clearCount += evicted;
+                        if (evicted == 0)
+                        {
+                            break;
                         }
-
-                        ++clearCount;
-                        updateCapacity(0 - totalCapacity);
-
-                        cache->setEmpty(true);
-                        removeCache(it->first, it->second);
-                        it = m_mru->erase(it);
-                    }
-                    else
-                    {
-                        break;
                     }
                 }
-                else
-                {
-                    ++it;
-                }
-            }
-            ++clearTimes;
-        }
-    } while (needClear && m_running->load());
+            });
+    }
 
     if (clearThrough > 0)
     {
-        CACHED_STORAGE_LOG(INFO) << "Clear finished, total: " << clearCount << " entries, "
-                                 << "through: " << clearThrough << " entries, "
+        CACHED_STORAGE_LOG(INFO) << "Clear finished, total: " << clearCount.load() << " entries, "
+                                 << "through: " << clearThrough.load() << " entries, "
                                  << readableCapacity(currentCapacity - m_capacity)
                                  << ", Current total entries: " << m_caches.size()
-                                 << ", Current total mru entries: " << m_mru->size()
+                                 << ", Current total mru entries: " << mruSize()
                                  << ", total capacaity: " << readableCapacity(m_capacity);
 
         CACHED_STORAGE_LOG(DEBUG)
@@ -944,8 +1183,32 @@ void CachedStorage::checkAndClear()
             << ((double)m_hitTimes / m_queryTimes) * 100 << "%"
             << "\n\n"
             << "Cache capacity: " << readableCapacity(m_capacity) << "\n"
-            << "Cache size: " << m_mru->size()
+            << "Cache size: " << mruSize()
             << "\n---------------------------------------------------------------------\n";
+
+        if (m_compressedCache)
+        {
+            CACHED_STORAGE_LOG(DEBUG)
+                << "Compressed Cache Status: \n\n"
+                << "\n---------------------------------------------------------------------\n"
+                << "Total query: " << m_compressedQueryTimes << "\n"
+                << "Total cache hit: " << m_compressedHitTimes << "\n"
+                << "Total hit ratio: " << std::setiosflags(std::ios::fixed)
+                << std::setprecision(4)
+                << (m_compressedQueryTimes > 0 ?
+                           ((double)m_compressedHitTimes / m_compressedQueryTimes) * 100 :
+                           0)
+                << "%"
+                << "\n\n"
+                << "Cache capacity: " << readableCapacity(m_compressedCache->capacity()) << "\n"
+                << "Cache size: " << m_compressedCache->size()
+                << "\n---------------------------------------------------------------------\n";
+        }
+    }
+    m_capacityMetric->set(m_capacity);
+    if (m_compressedCache)
+    {
+        m_compressedCapacityMetric->set(m_compressedCache->capacity());
     }
 }
 
@@ -21,20 +21,25 @@
 
 #pragma once
 
+#include "CompressedCache.h"
 #include "Storage.h"
 #include "Table.h"
 #include <libdevcore/FixedHash.h>
+#include <libdevcore/Metrics.h>
 #include <libdevcore/ThreadPool.h>
-#include <tbb/concurrent_queue.h>
 #include <tbb/concurrent_unordered_map.h>
 #include <tbb/concurrent_unordered_set.h>
 #include <tbb/spin_mutex.h>
 #include <tbb/spin_rw_mutex.h>
+#include <boost/functional/hash.hpp>
 #include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/identity.hpp>
 #include <boost/multi_index/sequenced_index.hpp>
 #include <boost/multi_index_container.hpp>
+#include <deque>
+#include <list>
 #include <mutex>
+#include <unordered_map>
 
 namespace dev
 {
@@ -76,6 +81,38 @@ private:
     tbb::atomic<uint64_t> m_num;
 };
 
+/**
+ * @brief A shard of the CLOCK replacement policy of the caches. The access only marks the key
+ * referenced under the spin lock of the shard, the hand gives the referenced keys a second
+ * chance and sweeps out the others, the new keys are inserted behind the hand.
+ */
+class ClockShard
+{
+public:
+    typedef std::shared_ptr<ClockShard> Ptr;
+    typedef std::pair<std::string, std::string> Key;
+
+    /// mark the key referenced, insert it unreferenced if not exists
+    void touch(const std::string& table, const std::string& key);
+    /// @return at most _num unreferenced keys removed from the shard, empty if no key
+    std::vector<Key> sweep(size_t _num);
+    /// remove the key if exists
+    void erase(const std::string& table, const std::string& key);
+    size_t size();
+
+private:
+    struct Item
+    {
+        const Key* key;
+        bool referenced;
+    };
+
+    tbb::spin_mutex m_mutex;
+    std::list<Item> m_items;
+    std::unordered_map<Key, std::list<Item>::iterator, boost::hash<Key>> m_index;
+    std::list<Item>::iterator m_hand = m_items.end();
+};
+
 class Task
 {
 public:
@@ -117,17 +154,29 @@ public:
     void setSyncNum(int64_t syncNum);
     void setClearInterval(int64_t clearInterval) { m_clearInterval = clearInterval; }
     void setMaxCapacity(int64_t maxCapacity);
+    /// the capacity of the compressed second tier, 0 disables the tier
+    void setMaxCompressedCapacity(int64_t maxCompressedCapacity);
     void setMaxForwardBlock(size_t maxForwardBlock);
+    /// the max blocks merged into one commit of the backend which only commits the dirty entries
+    void setMaxBatchBlock(size_t maxBatchBlock);
 
     void startClearThread();
     dev::GROUP_ID groupID() const { return m_groupID; }
 
+    /// merge the tasks of the continuous blocks into one task of the last block, the entries of
+    /// the same ID keep the latest version, only for the backend which only commits dirty entries
+    static Task::Ptr mergeTasks(const std::vector<Task::Ptr>& tasks);
+
 protected:
+    void touchMRU(const std::string& table, const std::string& key, ssize_t capacity);
+    size_t mruSize();
+    // evict the cache if it has been committed to the backend, true if the key needs no more sweep
+    bool evictCache(const std::string& table, const std::string& key);
+
     dev::GROUP_ID m_groupID = 0;
 
 private:
-    void touchMRU(const std::string& table, const std::string& key, ssize_t capacity);
-    void updateMRU(const std::string& table, const std::string& key, ssize_t capacity);
+    ClockShard::Ptr mruShard(const std::string& table, const std::string& key);
     std::tuple<std::shared_ptr<Cache::RWScoped>, Cache::Ptr, bool> touchCache(
         TableInfo::Ptr table, const std::string& key, bool write = false);
     void restoreCache(TableInfo::Ptr table, const std::string& key, Cache::Ptr cache);
@@ -136,10 +185,13 @@ private:
         std::shared_ptr<std::vector<tbb::concurrent_unordered_set<std::string>>> _processedKeys);
 
     void removeCache(const std::string& table, const std::string& key);
+    // load the entries missed in the first tier from the compressed tier or the backend
+    Entries::Ptr loadEntries(int64_t num, TableInfo::Ptr tableInfo, const std::string& key);
 
     bool disabled();
 
     bool commitBackend(Task::Ptr task);
+    void commitPendingTasks();
 
     void checkAndClear();
 
@@ -151,16 +203,16 @@ private:
 
     Mutex m_commitMutex;
 
-    std::shared_ptr<boost::multi_index_container<std::pair<std::string, std::string>,
-        boost::multi_index::indexed_by<boost::multi_index::sequenced<>,
-            boost::multi_index::hashed_unique<
-                boost::multi_index::identity<std::pair<std::string, std::string>>>>>>
-        m_mru;
-    std::shared_ptr<tbb::concurrent_queue<std::tuple<std::string, std::string, ssize_t>>>
-        m_mruQueue;
+    // the tasks waiting for the backend commit
+    std::deque<Task::Ptr> m_pendingTasks;
+    Mutex m_pendingTasksMutex;
+
+    std::vector<ClockShard::Ptr> m_mru;
 
     // boost::multi_index
     Storage::Ptr m_backend;
+    // the entries evicted from m_caches, nullptr if disabled
+    CompressedCache::Ptr m_compressedCache;
 
 
     tbb::atomic<uint64_t> m_syncNum;
@@ -169,15 +221,25 @@ private:
 
     // config
     uint64_t m_maxForwardBlock = 10;
+    uint64_t m_maxBatchBlock = 10;
     int64_t m_maxCapacity = 256 * 1024 * 1024;  // default 256MB for cache
     uint64_t m_clearInterval = 1000;
 
     dev::ThreadPool::Ptr m_taskThreadPool;
-    dev::ThreadPool::Ptr m_asyncThreadPool;
     std::shared_ptr<std::thread> m_clearThread;
 
     tbb::atomic<uint64_t> m_hitTimes;
     tbb::atomic<uint64_t> m_queryTimes;
+    tbb::atomic<uint64_t> m_compressedHitTimes;
+    tbb::atomic<uint64_t> m_compressedQueryTimes;
+
+    MetricCounter::Ptr m_queryMetric;
+    MetricCounter::Ptr m_hitMetric;
+    MetricGauge::Ptr m_capacityMetric;
+    MetricCounter::Ptr m_compressedQueryMetric;
+    MetricCounter::Ptr m_compressedHitMetric;
+    MetricGauge::Ptr m_compressedCapacityMetric;
+    MetricHistogram::Ptr m_clearMetric;
 
     std::shared_ptr<tbb::atomic<bool>> m_running;
 };
@@ -21,6 +21,7 @@
 #pragma once
 #include <map>
 #include <string>
+#include <vector>
 
 namespace dev
 {
@@ -58,6 +59,18 @@ static const std::string SYS_CONFIG = "_sys_config_";
 static const std::string SYS_ACCESS_TABLE = "_sys_table_access_";
 static const std::string SYS_BLOCK_2_NONCES = "_sys_block_2_nonces_";
 static const std::string SYS_HASH_2_BLOCKHEADER = "_sys_hash_2_header_";
+static const std::string SYS_TABLE_INDICES = "_sys_table_indices_";
+
+// the prefixes of the tables of the contracts, which never declare indices
+static const std::vector<std::string> CONTRACT_TABLE_PREFIXES = {
+    "_contract_data_", "c_", "_contract_parafunc_"};
+
+// secondary index of user tables (supported_version >= v2.7.0)
+static const std::string INDEX_TABLE_PREFIX = "_idx_";
+static const std::string INDEX_FIELD = "index_field";
+static const std::string INDEX_TABLE = "index_table";
+static const std::string INDEX_KEY = "idx_key";
+static const std::string INDEX_COUNT = "count";
 
 #if 0
 const char* const ID_FIELD = "_id_";
@@ -89,6 +102,7 @@ const int CODE_TABLE_KEYVALUE_LENGTH_OVERFLOW = -50005;
 const int CODE_TABLE_FIELDVALUE_LENGTH_OVERFLOW = -50006;
 const int CODE_TABLE_DUMPLICATE_FIELD = -50007;
 const int CODE_TABLE_INVALIDATE_FIELD = -50008;
+const int CODE_TABLE_INDEX_FIELD_NOT_EXIST = -50009;
 
 enum SQLFieldType : int8_t
 {
@@ -0,0 +1,226 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : the second tier of CachedStorage, keeps the evicted entries compressed by snappy
+ * @file: CompressedCache.cpp
+ */
+#include "CompressedCache.h"
+#include "StorageException.h"
+#include <libdevcore/SnappyCompress.h>
+#include <cstring>
+
+using namespace std;
+using namespace dev;
+using namespace dev::storage;
+
+namespace
+{
+enum EntryFlag : uint8_t
+{
+    Dirty = 1,
+    Force = 2,
+    Deleted = 4
+};
+
+template <typename T>
+void appendValue(bytes& _encoded, T _value)
+{
+    auto offset = _encoded.size();
+    _encoded.resize(offset + sizeof(T));
+    memcpy(&_encoded[offset], &_value, sizeof(T));
+}
+
+void appendString(bytes& _encoded, const std::string& _value)
+{
+    appendValue<uint32_t>(_encoded, _value.size());
+    _encoded.insert(_encoded.end(), _value.begin(), _value.end());
+}
+
+class Decoder
+{
+public:
+    Decoder(bytesConstRef _encoded) : m_encoded(_encoded) {}
+
+    template <typename T>
+    T value()
+    {
+        T value;
+        memcpy(&value, next(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    std::string str()
+    {
+        auto size = value<uint32_t>();
+        return std::string((const char*)next(size), size);
+    }
+
+private:
+    const byte* next(size_t _size)
+    {
+        if (m_offset + _size > m_encoded.size())
+        {
+            BOOST_THROW_EXCEPTION(
+                StorageException(-1, "Decode compressed cache failed: unexpected end of data"));
+        }
+        auto data = m_encoded.data() + m_offset;
+        m_offset += _size;
+        return data;
+    }
+
+    bytesConstRef m_encoded;
+    size_t m_offset = 0;
+};
+}  // namespace
+
+void CompressedCache::put(
+    const std::string& _table, const std::string& _key, Entries::ConstPtr _entries)
+{
+    bytes encoded;
+    encode(*_entries, encoded);
+    bytes compressed;
+    if (compress::SnappyCompress::compress(ref(encoded), compressed) == 0 ||
+        (int64_t)compressed.size() > m_maxCapacity)
+    {
+        erase(_table, _key);
+        return;
+    }
+
+    Key key(_table, _key);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_index.find(key);
+    if (it != m_index.end())
+    {
+        eraseWithoutLock(it);
+    }
+    m_capacity += compressed.size();
+    m_queue.emplace_back(key, std::move(compressed));
+    m_index.emplace(key, std::prev(m_queue.end()));
+
+    while (m_capacity > m_maxCapacity)
+    {
+        eraseWithoutLock(m_index.find(m_queue.front().first));
+    }
+}
+
+Entries::Ptr CompressedCache::take(const std::string& _table, const std::string& _key)
+{
+    bytes compressed;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_index.find(Key(_table, _key));
+        if (it == m_index.end())
+        {
+            return nullptr;
+        }
+        compressed.swap(it->second->second);
+        m_capacity -= compressed.size();
+        m_queue.erase(it->second);
+        m_index.erase(it);
+    }
+
+    bytes encoded;
+    if (compress::SnappyCompress::uncompress(ref(compressed), encoded) == 0)
+    {
+        return nullptr;
+    }
+    return decode(ref(encoded));
+}
+
+void CompressedCache::erase(const std::string& _table, const std::string& _key)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_index.find(Key(_table, _key));
+    if (it != m_index.end())
+    {
+        eraseWithoutLock(it);
+    }
+}
+
+void CompressedCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_index.clear();
+    m_queue.clear();
+    m_capacity = 0;
+}
+
+size_t CompressedCache::size()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_index.size();
+}
+
+int64_t CompressedCache::capacity()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_capacity;
+}
+
+void CompressedCache::eraseWithoutLock(Index::iterator _it)
+{
+    m_capacity -= _it->second->second.size();
+    m_queue.erase(_it->second);
+    m_index.erase(_it);
+}
+
+void CompressedCache::encode(Entries const& _entries, bytes& _encoded)
+{
+    appendValue<uint32_t>(_encoded, _entries.size());
+    for (auto const& entry : _entries)
+    {
+        appendValue<uint64_t>(_encoded, entry->getID());
+        appendValue<uint32_t>(_encoded, entry->num());
+        appendValue<int32_t>(_encoded, entry->getStatus());
+        uint8_t flags = (entry->dirty() ? EntryFlag::Dirty : 0) |
+                        (entry->force() ? EntryFlag::Force : 0) |
+                        (entry->deleted() ? EntryFlag::Deleted : 0);
+        appendValue<uint8_t>(_encoded, flags);
+        appendValue<uint32_t>(_encoded, entry->size());
+        for (auto const& field : *entry)
+        {
+            appendString(_encoded, field.first);
+            appendString(_encoded, field.second);
+        }
+    }
+}
+
+Entries::Ptr CompressedCache::decode(bytesConstRef _encoded)
+{
+    Decoder decoder(_encoded);
+    auto entries = std::make_shared<Entries>();
+    auto entriesSize = decoder.value<uint32_t>();
+    for (uint32_t i = 0; i < entriesSize; ++i)
+    {
+        auto entry = std::make_shared<Entry>();
+        entry->setID(decoder.value<uint64_t>());
+        entry->setNum(decoder.value<uint32_t>());
+        entry->setStatus(decoder.value<int32_t>());
+        auto flags = decoder.value<uint8_t>();
+        auto fieldsSize = decoder.value<uint32_t>();
+        for (uint32_t j = 0; j < fieldsSize; ++j)
+        {
+            auto key = decoder.str();
+            entry->setField(key, decoder.str());
+        }
+        entry->setForce(flags & EntryFlag::Force);
+        entry->setDeleted(flags & EntryFlag::Deleted);
+        entry->setDirty(flags & EntryFlag::Dirty);
+        entries->addEntry(entry);
+    }
+    return entries;
+}
@@ -0,0 +1,76 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : the second tier of CachedStorage, keeps the evicted entries compressed by snappy
+ * @file: CompressedCache.h
+ */
+#pragma once
+
+#include "Table.h"
+#include <libdevcore/Common.h>
+#include <boost/functional/hash.hpp>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace dev
+{
+namespace storage
+{
+/**
+ * @brief The entries evicted from the first tier are kept here in the serialized and compressed
+ * form, a hit takes the entries out of this tier and promotes them to the first tier, so every
+ * key is cached in at most one tier and the oldest key is always at the front of the queue.
+ */
+class CompressedCache
+{
+public:
+    typedef std::shared_ptr<CompressedCache> Ptr;
+    /// {table, key}, the table name and the key are kept apart so that no two rows share a key
+    using Key = std::pair<std::string, std::string>;
+    CompressedCache(int64_t _maxCapacity) : m_maxCapacity(_maxCapacity) {}
+    virtual ~CompressedCache() {}
+
+    /// keep the entries of the key, evict the oldest keys when exceeding the capacity
+    virtual void put(
+        const std::string& _table, const std::string& _key, Entries::ConstPtr _entries);
+    /// @return the entries of the key and remove them from this tier, nullptr if missed
+    virtual Entries::Ptr take(const std::string& _table, const std::string& _key);
+    virtual void erase(const std::string& _table, const std::string& _key);
+    virtual void clear();
+
+    size_t size();
+    /// the compressed bytes of all the entries
+    int64_t capacity();
+    int64_t maxCapacity() const { return m_maxCapacity; }
+
+    static void encode(Entries const& _entries, bytes& _encoded);
+    static Entries::Ptr decode(bytesConstRef _encoded);
+
+private:
+    using Queue = std::list<std::pair<Key, bytes>>;
+    using Index = std::unordered_map<Key, Queue::iterator, boost::hash<Key>>;
+    void eraseWithoutLock(Index::iterator _it);
+
+    std::mutex m_mutex;
+    Queue m_queue;
+    Index m_index;
+    int64_t m_capacity = 0;
+    int64_t m_maxCapacity = 0;
+};
+}  // namespace storage
+}  // namespace dev
@@ -93,8 +93,12 @@ Entries::Ptr MemoryTable2::selectNoLock(const std::string& key, Condition::Ptr c
 {
     try
     {
-        auto entries = std::make_shared<Entries>();
+        auto entries = makeShared<Entries>(m_arena);
         condition->EQ(m_tableInfo->key, key);
+        if (!m_indexTables.empty() && !mayMatch(key, condition))
+        {
+            return entries;
+        }
         if (m_remoteDB)
         {
             // query remoteDB anyway
@@ -148,7 +152,7 @@ Entries::Ptr MemoryTable2::selectNoLock(const std::string& key, Condition::Ptr c
         }
         if (condition->getOffset() >= 0 && condition->getCount() >= 0)
         {
-            Entries::Ptr resultEntries = std::make_shared<Entries>();
+            Entries::Ptr resultEntries = makeShared<Entries>(m_arena);
             proccessLimit(condition, entries, resultEntries);
             return resultEntries;
         }
@@ -195,6 +199,27 @@ int MemoryTable2::update(
                 m_dirty_updated[key].insert(updateEntry->getID());
             }
 
+            if (!m_indexTables.empty())
+            {
+                for (auto& it : *(entry))
+                {
+                    if (m_indexTables.count(it.first) == 0)
+                    {
+                        continue;
+                    }
+                    auto oldIt = updateEntry->find(it.first);
+                    if (oldIt != updateEntry->end())
+                    {
+                        if (oldIt->second == it.second)
+                        {
+                            continue;
+                        }
+                        updateIndex(key, it.first, oldIt->second, -1);
+                    }
+                    updateIndex(key, it.first, it.second, 1);
+                }
+            }
+
             for (auto& it : *(entry))
             {
                 // _id_ always got initialized value 0 from Entry::Entry()
@@ -249,10 +274,14 @@ int MemoryTable2::insert(const std::string& key, Entry::Ptr entry, AccessOptions
 
         if (it == m_newEntries.end())
         {
-            Entries::Ptr entries = std::make_shared<Entries>();
+            Entries::Ptr entries = makeShared<Entries>(m_arena);
             it = m_newEntries.insert(std::make_pair(key, entries)).first;
         }
         auto iter = it->second->addEntry(entry);
+        if (!m_indexTables.empty())
+        {
+            updateIndices(key, entry, 1);
+        }
 
         // auto iter = m_newEntries->addEntry(entry);
         Change::Record record(iter);
@@ -300,6 +329,10 @@ int MemoryTable2::remove(
             Entry::Ptr removeEntry = entries->get(i);
 
             removeEntry->setStatus(1);
+            if (!m_indexTables.empty())
+            {
+                updateIndices(key, removeEntry, -1);
+            }
 
             // if id not equals to zero and not in the m_dirty, must be new dirty entry
             if (removeEntry->getID() != 0 && m_dirty.find(removeEntry->getID()) == m_dirty.end())
@@ -329,6 +362,93 @@ int MemoryTable2::remove(
     return 0;
 }
 
+static std::string getIndexKey(const std::string& _key, const std::string& _value)
+{
+    // the key and the value may be long and contain any byte, so the index key is the hash of
+    // the length-prefixed pair, which always fits in the key column of the backend
+    std::string data = std::to_string(_key.size()) + ":" + _key + _value;
+    return crypto::Hash(data).hex();
+}
+
+int64_t MemoryTable2::indexCount(
+    const std::string& _key, const std::string& _field, const std::string& _value)
+{
+    auto indexTable = m_indexTables[_field];
+    auto indexKey = getIndexKey(_key, _value);
+    auto entries = indexTable->select(indexKey, indexTable->newCondition());
+    if (entries->size() == 0)
+    {
+        return 0;
+    }
+    return boost::lexical_cast<int64_t>(entries->get(0)->getField(INDEX_COUNT));
+}
+
+void MemoryTable2::updateIndex(
+    const std::string& _key, const std::string& _field, const std::string& _value, int64_t _delta)
+{
+    auto indexTable = m_indexTables[_field];
+    auto indexKey = getIndexKey(_key, _value);
+    // the index table is maintained by the table itself, no need to check the authority
+    auto options = std::make_shared<AccessOptions>(Address(), false);
+    auto entries = indexTable->select(indexKey, indexTable->newCondition());
+    int64_t count = _delta;
+    if (entries->size() > 0)
+    {
+        count += boost::lexical_cast<int64_t>(entries->get(0)->getField(INDEX_COUNT));
+    }
+
+    if (count <= 0)
+    {
+        if (entries->size() > 0)
+        {
+            indexTable->remove(indexKey, indexTable->newCondition(), options);
+        }
+        return;
+    }
+    auto indexEntry = indexTable->newEntry();
+    indexEntry->setField(INDEX_COUNT, std::to_string(count));
+    if (entries->size() > 0)
+    {
+        indexTable->update(indexKey, indexEntry, indexTable->newCondition(), options);
+    }
+    else
+    {
+        indexTable->insert(indexKey, indexEntry, options);
+    }
+}
+
+void MemoryTable2::updateIndices(const std::string& _key, Entry::Ptr _entry, int64_t _delta)
+{
+    for (auto& it : m_indexTables)
+    {
+        auto fieldIt = _entry->find(it.first);
+        if (fieldIt != _entry->end())
+        {
+            updateIndex(_key, it.first, fieldIt->second, _delta);
+        }
+    }
+}
+
+bool MemoryTable2::mayMatch(const std::string& _key, Condition::Ptr _condition)
+{
+    for (auto it = _condition->begin(); it != _condition->end(); ++it)
+    {
+        // Condition::process skips the fields not hashed, the rows without the field never match
+        if (m_indexTables.count(it->first) == 0 || !isHashField(it->first))
+        {
+            continue;
+        }
+        auto& range = it->second;
+        // only EQ can be answered by the index, the other operations scan the rows
+        if (range.left.first && range.right.first && range.left.second == range.right.second &&
+            indexCount(_key, it->first, range.left.second) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 dev::h256 MemoryTable2::hash()
 {
     if (m_hashDirty)
@@ -490,6 +610,10 @@ std::shared_ptr<std::vector<size_t>> MemoryTable2::genDataOffset(
 
 dev::storage::TableData::Ptr MemoryTable2::dump()
 {
+    if (g_BCOSConfig.version() >= V2_7_0)
+    {
+        return dumpWithEntryHash();
+    }
     // >= v2.2.0
     TIME_RECORD("MemoryTable2 Dump-" + m_tableInfo->name);
     if (m_hashDirty)
@@ -633,6 +757,146 @@ dev::storage::TableData::Ptr MemoryTable2::dump()
     return m_tableData;
 }
 
+static h256 entryHash(Entry::Ptr _entry)
+{
+    // the fields are length-prefixed, so that the boundaries of the fields are in the digest
+    thread_local bytes data;
+    data.clear();
+    auto appendField = [](std::string const& _field) {
+        uint32_t size = htonl(_field.size());
+        data.insert(data.end(), (byte*)&size, (byte*)&size + sizeof(size));
+        data.insert(data.end(), _field.begin(), _field.end());
+    };
+    for (auto& fieldIt : *_entry)
+    {
+        if (isHashField(fieldIt.first))
+        {
+            appendField(fieldIt.first);
+            appendField(fieldIt.second);
+        }
+    }
+    data.push_back((byte)_entry->getStatus());
+    return crypto::Hash(data);
+}
+
+dev::storage::TableData::Ptr MemoryTable2::dumpWithEntryHash()
+{
+    TIME_RECORD("MemoryTable2 DumpWithEntryHash-" + m_tableInfo->name);
+    if (m_hashDirty)
+    {
+        m_tableData = std::make_shared<dev::storage::TableData>();
+        m_tableData->info = m_tableInfo;
+        m_tableData->dirtyEntries = std::make_shared<Entries>();
+        m_tableData->newEntries = std::make_shared<Entries>();
+
+        tbb::parallel_for(m_dirty.range(),
+            [&](tbb::concurrent_unordered_map<uint64_t, Entry::Ptr>::range_type& range) {
+                for (auto it = range.begin(); it != range.end(); ++it)
+                {
+                    if (!it->second->deleted())
+                    {
+                        m_tableData->dirtyEntries->addEntry(it->second);
+                    }
+                }
+            });
+        tbb::parallel_for(m_newEntries.range(),
+            [&](tbb::concurrent_unordered_map<std::string, Entries::Ptr>::range_type& range) {
+                for (auto it = range.begin(); it != range.end(); ++it)
+                {
+                    for (size_t i = 0; i < it->second->size(); ++i)
+                    {
+                        if (!it->second->get(i)->deleted())
+                        {
+                            m_tableData->newEntries->addEntry(it->second->get(i));
+                        }
+                    }
+                }
+            });
+
+        if (m_tableInfo->enableConsensus)
+        {
+            auto startT = utcTime();
+            auto& dirtyEntries = *m_tableData->dirtyEntries;
+            auto& newEntries = *m_tableData->newEntries;
+            // every entry is digested once, the entries are ordered by the ids and the digests
+            // instead of comparing the fields, and only the digests are hashed
+            std::vector<std::pair<uint64_t, Entry::Ptr>> dirty(dirtyEntries.size());
+            std::vector<std::pair<h256, Entry::Ptr>> inserted(newEntries.size());
+            std::vector<h256> dirtyHashes(dirtyEntries.size());
+            tbb::parallel_invoke(
+                [&]() {
+                    tbb::parallel_for(tbb::blocked_range<size_t>(0, dirty.size()),
+                        [&](tbb::blocked_range<size_t> const& range) {
+                            for (auto i = range.begin(); i < range.end(); ++i)
+                            {
+                                dirty[i] =
+                                    std::make_pair(dirtyEntries[i]->getID(), dirtyEntries[i]);
+                            }
+                        });
+                    // the ids of the dirty entries are unique
+                    tbb::parallel_sort(dirty.begin(), dirty.end(),
+                        [](std::pair<uint64_t, Entry::Ptr> const& _lhs,
+                            std::pair<uint64_t, Entry::Ptr> const& _rhs) {
+                            return _lhs.first < _rhs.first;
+                        });
+                    tbb::parallel_for(tbb::blocked_range<size_t>(0, dirty.size()),
+                        [&](tbb::blocked_range<size_t> const& range) {
+                            for (auto i = range.begin(); i < range.end(); ++i)
+                            {
+                                dirtyEntries[i] = dirty[i].second;
+                                dirtyHashes[i] = entryHash(dirty[i].second);
+                            }
+                        });
+                },
+                [&]() {
+                    tbb::parallel_for(tbb::blocked_range<size_t>(0, inserted.size()),
+                        [&](tbb::blocked_range<size_t> const& range) {
+                            for (auto i = range.begin(); i < range.end(); ++i)
+                            {
+                                inserted[i] =
+                                    std::make_pair(entryHash(newEntries[i]), newEntries[i]);
+                            }
+                        });
+                    // the new entries have no id, the equal digests mean the same content
+                    tbb::parallel_sort(inserted.begin(), inserted.end(),
+                        [](std::pair<h256, Entry::Ptr> const& _lhs,
+                            std::pair<h256, Entry::Ptr> const& _rhs) {
+                            return _lhs.first < _rhs.first;
+                        });
+                    for (size_t i = 0; i < inserted.size(); ++i)
+                    {
+                        newEntries[i] = inserted[i].second;
+                    }
+                });
+
+            bytes allData;
+            allData.reserve(h256::size * (dirtyHashes.size() + inserted.size()));
+            for (auto const& hash : dirtyHashes)
+            {
+                allData.insert(allData.end(), hash.begin(), hash.end());
+            }
+            for (auto const& item : inserted)
+            {
+                allData.insert(allData.end(), item.first.begin(), item.first.end());
+            }
+            m_hash = allData.empty() ? h256() : crypto::Hash(allData);
+            STORAGE_LOG(DEBUG) << LOG_BADGE("MemoryTable2 dumpWithEntryHash")
+                               << LOG_KV("table", m_tableInfo->name)
+                               << LOG_KV("dirty", dirtyHashes.size())
+                               << LOG_KV("new", inserted.size())
+                               << LOG_KV("timeCost", utcTime() - startT)
+                               << LOG_KV("hash", m_hash.abridged());
+        }
+        else
+        {
+            m_hash = dev::h256();
+        }
+        m_hashDirty = false;
+    }
+
+    return m_tableData;
+}
+
 void MemoryTable2::rollback(const Change& _change)
 {
 #if 0
@@ -85,7 +85,23 @@ public:
 
     void rollback(const Change& _change) override;
 
+    // attach the secondary index table of _field, _field must be in m_tableInfo->indices
+    void setIndexTable(const std::string& _field, Table::Ptr _indexTable)
+    {
+        m_indexTables[_field] = _indexTable;
+    }
+
 private:
+    // maintain the secondary indices of _entry, _delta is 1 when added, -1 when removed
+    void updateIndices(const std::string& _key, Entry::Ptr _entry, int64_t _delta);
+    void updateIndex(const std::string& _key, const std::string& _field,
+        const std::string& _value, int64_t _delta);
+    // the number of rows under _key whose _field equals to _value
+    int64_t indexCount(
+        const std::string& _key, const std::string& _field, const std::string& _value);
+    // return false if the secondary indices prove that no row matches the condition
+    bool mayMatch(const std::string& _key, Condition::Ptr _condition);
+
     void parallelGenData(bytes& _generatedData, std::shared_ptr<std::vector<size_t>> _offsetVec,
         Entries::Ptr _entries);
 
@@ -94,6 +110,8 @@ private:
 
     Entries::Ptr selectNoLock(const std::string& key, Condition::Ptr condition);
     dev::storage::TableData::Ptr dumpWithoutOptimize();
+    // >= v2.7.0, the table hash is the hash of the digests of the entries
+    dev::storage::TableData::Ptr dumpWithEntryHash();
 
     tbb::concurrent_unordered_map<std::string, Entries::Ptr> m_newEntries;
     tbb::concurrent_unordered_map<uint64_t, Entry::Ptr> m_dirty;
@@ -151,6 +169,8 @@ private:
 
     dev::h256 m_hash;
     dev::storage::TableData::Ptr m_tableData;
+    // field => secondary index table
+    std::map<std::string, Table::Ptr> m_indexTables;
 };
 }  // namespace storage
 }  // namespace dev
@@ -93,6 +93,7 @@ Table::Ptr MemoryTableFactory::openTable(
     memoryTable->setStateStorage(m_stateStorage);
     memoryTable->setBlockHash(m_blockHash);
     memoryTable->setBlockNum(m_blockNum);
+    memoryTable->setArena(m_arena);
     memoryTable->setTableInfo(tableInfo);
 
     // authority flag
@@ -30,6 +30,7 @@
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_sort.h>
 #include <boost/algorithm/string.hpp>
+#include <algorithm>
 #include <memory>
 #include <thread>
 #include <utility>
@@ -52,6 +53,17 @@ MemoryTableFactory2::MemoryTableFactory2()
     m_sysTables.push_back(SYS_CONFIG);
     m_sysTables.push_back(SYS_BLOCK_2_NONCES);
     m_sysTables.push_back(SYS_HASH_2_BLOCKHEADER);
+    if (g_BCOSConfig.version() >= V2_7_0)
+    {
+        m_sysTables.push_back(SYS_TABLE_INDICES);
+    }
+}
+
+std::string MemoryTableFactory2::getIndexTableName(
+    const std::string& _tableName, const std::string& _field)
+{
+    // '.' can't appear in table name or field name, the hash keeps the name short enough for SQL
+    return INDEX_TABLE_PREFIX + crypto::Hash(_tableName + "." + _field).hex().substr(0, 32);
 }
 
 
@@ -74,6 +86,17 @@ void MemoryTableFactory2::init()
     }
 }
 
+void MemoryTableFactory2::setArena(BlockArena::Ptr _arena)
+{
+    tbb::spin_mutex::scoped_lock l(x_name2Table);
+    m_arena = _arena;
+    // the system tables opened by init
+    for (auto& it : m_name2Table)
+    {
+        it.second->setArena(_arena);
+    }
+}
+
 Table::Ptr MemoryTableFactory2::openTable(const std::string& _tableName, bool _authorityFlag, bool)
 {
     tbb::spin_mutex::scoped_lock l(x_name2Table);
@@ -118,6 +141,7 @@ Table::Ptr MemoryTableFactory2::openTableWithoutLock(
     memoryTable->setStateStorage(m_stateStorage);
     memoryTable->setBlockHash(m_blockHash);
     memoryTable->setBlockNum(m_blockNum);
+    memoryTable->setArena(m_arena);
     memoryTable->setTableInfo(tableInfo);
 
     // authority flag
@@ -142,6 +166,19 @@ Table::Ptr MemoryTableFactory2::openTableWithoutLock(
         }
     }
 
+    // only the tables created by the TableFactory precompiled can declare indices, the contract
+    // tables, opened by every call of the contracts, are skipped
+    if (g_BCOSConfig.version() >= V2_7_0 &&
+        m_sysTables.end() == find(m_sysTables.begin(), m_sysTables.end(), tableName) &&
+        !boost::starts_with(tableName, INDEX_TABLE_PREFIX) &&
+        std::none_of(CONTRACT_TABLE_PREFIXES.begin(), CONTRACT_TABLE_PREFIXES.end(),
+            [&tableName](std::string const& _prefix) {
+                return boost::starts_with(tableName, _prefix);
+            }))
+    {
+        setIndexTables(memoryTable2, tableInfo);
+    }
+
     memoryTable->setTableInfo(tableInfo);
     memoryTable->setRecorder([&](Table::Ptr _table, Change::Kind _kind, std::string const& _key,
                                  std::vector<Change::Record>& _records) {
@@ -184,6 +221,8 @@ Table::Ptr MemoryTableFactory2::createTable(const std::string& tableName,
                                  << LOG_KV("table name", tableName);
             BOOST_THROW_EXCEPTION(StorageException(result, "create table permission denied"));
         }
+        // the indices of the table created again after a rollback may differ
+        m_indicesCache->erase(tableName);
         STORAGE_LOG(INFO) << LOG_BADGE("MemoryTableFactory2") << LOG_DESC("createTable")
                           << LOG_KV("table name", tableName) << LOG_KV("keyField", keyField)
                           << LOG_KV("valueField", valueField);
@@ -191,6 +230,91 @@ Table::Ptr MemoryTableFactory2::createTable(const std::string& tableName,
     return openTable(tableName, authorityFlag, isPara);
 }
 
+Table::Ptr MemoryTableFactory2::createIndexedTable(const std::string& tableName,
+    const std::string& keyField, const std::string& valueField,
+    const std::vector<std::string>& indexFields, bool authorityFlag, Address const& _origin)
+{
+    std::vector<std::string> fields;
+    boost::split(fields, valueField, boost::is_any_of(","));
+    for (auto& indexField : indexFields)
+    {
+        if (fields.end() == find(fields.begin(), fields.end(), indexField))
+        {
+            STORAGE_LOG(WARNING) << LOG_BADGE("MemoryTableFactory2")
+                                 << LOG_DESC("index field not exist")
+                                 << LOG_KV("table name", tableName)
+                                 << LOG_KV("index field", indexField);
+            BOOST_THROW_EXCEPTION(StorageException(
+                CODE_TABLE_INDEX_FIELD_NOT_EXIST, "index field not exist: " + indexField));
+        }
+    }
+    {
+        // indices can only be declared on creation, so the index tables never need a backfill
+        auto sysTable = openTable(SYS_TABLES, authorityFlag);
+        tbb::spin_mutex::scoped_lock l(x_name2Table);
+        auto tableEntries = sysTable->select(tableName, sysTable->newCondition());
+        if (tableEntries->size() != 0)
+        {
+            STORAGE_LOG(WARNING) << LOG_BADGE("MemoryTableFactory2")
+                                 << LOG_DESC("table already exist in _sys_tables_")
+                                 << LOG_KV("table name", tableName);
+            return nullptr;
+        }
+    }
+    auto indicesTable = openTable(SYS_TABLE_INDICES, false);
+    for (auto& indexField : indexFields)
+    {
+        auto indexTableName = getIndexTableName(tableName, indexField);
+        auto indexTable = createTable(indexTableName, INDEX_KEY, INDEX_COUNT, authorityFlag,
+            _origin, false);
+        if (!indexTable)
+        {  // the index has been declared in the same call
+            continue;
+        }
+        auto indexEntry = indicesTable->newEntry();
+        indexEntry->setField(INDEX_FIELD, indexField);
+        indexEntry->setField(INDEX_TABLE, indexTableName);
+        indicesTable->insert(tableName, indexEntry, std::make_shared<AccessOptions>(_origin, false));
+        STORAGE_LOG(INFO) << LOG_BADGE("MemoryTableFactory2") << LOG_DESC("createIndex")
+                          << LOG_KV("table name", tableName) << LOG_KV("index field", indexField)
+                          << LOG_KV("index table", indexTableName);
+    }
+    return createTable(tableName, keyField, valueField, authorityFlag, _origin, false);
+}
+
+void MemoryTableFactory2::setIndexTables(
+    std::shared_ptr<MemoryTable2> _table, storage::TableInfo::Ptr _tableInfo)
+{
+    TableIndicesCache::Indices indices;
+    if (!m_indicesCache->get(_tableInfo->name, indices))
+    {
+        auto indicesTable = openTableWithoutLock(SYS_TABLE_INDICES, false);
+        auto indexEntries = indicesTable->select(_tableInfo->name, indicesTable->newCondition());
+        for (size_t i = 0; i < indexEntries->size(); ++i)
+        {
+            auto indexEntry = indexEntries->get(i);
+            indices.emplace_back(
+                indexEntry->getField(INDEX_FIELD), indexEntry->getField(INDEX_TABLE));
+        }
+        m_indicesCache->set(_tableInfo->name, indices);
+    }
+    for (auto const& index : indices)
+    {
+        auto const& indexField = index.first;
+        auto indexTable = openTableWithoutLock(index.second, false);
+        if (!indexTable)
+        {
+            STORAGE_LOG(ERROR) << LOG_BADGE("MemoryTableFactory2")
+                               << LOG_DESC("index table not exist")
+                               << LOG_KV("table name", _tableInfo->name)
+                               << LOG_KV("index field", indexField);
+            continue;
+        }
+        _tableInfo->indices.emplace_back(indexField);
+        _table->setIndexTable(indexField, indexTable);
+    }
+}
+
 size_t MemoryTableFactory2::savepoint()
 {
     auto& changeLog = getChangeLog();
@@ -24,6 +24,7 @@
 #include "MemoryTable.h"
 #include "Storage.h"
 #include "Table.h"
+#include <libdevcore/Guards.h>
 #include <tbb/enumerable_thread_specific.h>
 #include <tbb/spin_mutex.h>
 #include <boost/algorithm/string.hpp>
@@ -39,7 +40,44 @@ class ExecutiveContext;
 }
 namespace storage
 {
+class MemoryTable2;
 const uint64_t ENTRY_ID_START = 100000;
+
+// the index fields and the index tables of the tables in _sys_table_indices_, shared by the table
+// factories of the blocks of a group, the entry of a table is dropped when the table is created
+class TableIndicesCache
+{
+public:
+    using Ptr = std::shared_ptr<TableIndicesCache>;
+    // pairs of the index field and the index table
+    using Indices = std::vector<std::pair<std::string, std::string>>;
+
+    bool get(const std::string& _tableName, Indices& _indices)
+    {
+        ReadGuard l(x_indices);
+        auto it = m_indices.find(_tableName);
+        if (it == m_indices.end())
+        {
+            return false;
+        }
+        _indices = it->second;
+        return true;
+    }
+    void set(const std::string& _tableName, Indices const& _indices)
+    {
+        WriteGuard l(x_indices);
+        m_indices[_tableName] = _indices;
+    }
+    void erase(const std::string& _tableName)
+    {
+        WriteGuard l(x_indices);
+        m_indices.erase(_tableName);
+    }
+
+private:
+    dev::SharedMutex x_indices;
+    std::unordered_map<std::string, Indices> m_indices;
+};
 class MemoryTableFactory2 : public TableFactory
 {
 public:
@@ -53,6 +91,10 @@ public:
     virtual Table::Ptr createTable(const std::string& tableName, const std::string& keyField,
         const std::string& valueField, bool authorityFlag = true,
         Address const& _origin = Address(), bool isPara = true) override;
+    Table::Ptr createIndexedTable(const std::string& tableName, const std::string& keyField,
+        const std::string& valueField, const std::vector<std::string>& indexFields,
+        bool authorityFlag, Address const& _origin = Address()) override;
+    static std::string getIndexTableName(const std::string& _tableName, const std::string& _field);
 
     virtual uint64_t ID() { return m_ID; };
     virtual h256 hash() override;
@@ -60,12 +102,15 @@ public:
     virtual void commit() override;
     virtual void rollback(size_t _savepoint) override;
     virtual void commitDB(h256 const& _blockHash, int64_t _blockNumber) override;
+    void setArena(BlockArena::Ptr _arena) override;
+    void setIndicesCache(TableIndicesCache::Ptr _indicesCache) { m_indicesCache = _indicesCache; }
 
 private:
     virtual Table::Ptr openTableWithoutLock(
         const std::string& tableName, bool authorityFlag = true, bool isPara = true);
 
     void setAuthorizedAddress(storage::TableInfo::Ptr _tableInfo);
+    void setIndexTables(std::shared_ptr<MemoryTable2> _table, storage::TableInfo::Ptr _tableInfo);
     std::vector<Change>& getChangeLog();
     uint64_t m_ID = 1;
     // this map can't be changed, hash() need ordered data
@@ -73,6 +118,7 @@ private:
     tbb::enumerable_thread_specific<std::vector<Change> > s_changeLog;
     h256 m_hash;
     std::vector<std::string> m_sysTables;
+    TableIndicesCache::Ptr m_indicesCache = std::make_shared<TableIndicesCache>();
 
     // mutex
     mutable tbb::spin_mutex x_name2Table;
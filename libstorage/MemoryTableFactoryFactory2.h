@@ -39,6 +39,7 @@ public:
         tableFactory->setStateStorage(m_stroage);
         tableFactory->setBlockHash(hash);
         tableFactory->setBlockNum(number);
+        tableFactory->setIndicesCache(m_indicesCache);
         // TODO: check if need handle exception
         tableFactory->init();
 
@@ -49,6 +50,7 @@ public:
 
 private:
     dev::storage::Storage::Ptr m_stroage;
+    TableIndicesCache::Ptr m_indicesCache = std::make_shared<TableIndicesCache>();
 };
 
 }  // namespace storage
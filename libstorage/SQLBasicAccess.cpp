@@ -27,10 +27,113 @@
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/split.hpp>
 #include <boost/dynamic_bitset.hpp>
+#include <tbb/parallel_for.h>
+#include <atomic>
+#include <numeric>
+#include <tuple>
 
 using namespace dev::storage;
 using namespace std;
 
+namespace dev
+{
+namespace storage
+{
+struct SQLCommitConnection
+{
+    Connection_T connection = NULL;
+    // the prepared statements keyed by the table, the fields and the rows
+    map<tuple<string, string, size_t>, PreparedStatement_T> statements;
+    // the gtrid of the XA branch prepared but neither committed nor rolled back
+    string pendingXid;
+};
+
+struct SQLCommitTable
+{
+    string name;
+    bool blob = false;
+    map<string, vector<string>> field2Values;
+};
+}  // namespace storage
+}  // namespace dev
+
+namespace
+{
+// the prepared statements of the server are limited by max_prepared_stmt_count, 16382 by default
+const size_t c_maxPreparedStatements = 2048;
+// the gtrid of a branch is fisco_bcos_{num}_{branch}, and the bqual is the database name
+const string c_xidPrefix = "fisco_bcos_";
+
+string formatXid(const string& _gtrid, const string& _bqual)
+{
+    string bqual = boost::algorithm::replace_all_copy(_bqual, "\\", "\\\\");
+    bqual = boost::algorithm::replace_all_copy(bqual, "'", "\\'");
+    return "'" + _gtrid + "','" + bqual + "'";
+}
+
+int64_t xidNumber(const string& _gtrid)
+{
+    return atoll(_gtrid.c_str() + c_xidPrefix.size());
+}
+
+bool executeXA(Connection_T _conn, const char* _command, const string& _xid)
+{
+    volatile bool success = true;
+    TRY { Connection_execute(_conn, "XA %s %s", _command, _xid.c_str()); }
+    CATCH(SQLException)
+    {
+        SQLBasicAccess_LOG(WARNING) << "XA " << _command << " " << _xid
+                                    << " exception:" << Exception_frame.message;
+        success = false;
+    }
+    END_TRY;
+    return success;
+}
+
+int64_t currentNumber(Connection_T _conn)
+{
+    int64_t number = -1;
+    ResultSet_T result =
+        Connection_executeQuery(_conn, "select `%s` from `%s` where `%s`='%s' and `%s`=0",
+            SYS_VALUE.c_str(), SYS_CURRENT_STATE.c_str(), SYS_KEY.c_str(),
+            SYS_KEY_CURRENT_NUMBER.c_str(), STATUS.c_str());
+    if (ResultSet_next(result))
+    {
+        auto value = ResultSet_getString(result, 1);
+        if (value)
+        {
+            number = atoll(value);
+        }
+    }
+    return number;
+}
+
+// the current number of the block is the commit marker of the parallel commit
+bool hasCurrentNumber(const vector<TableData::Ptr>& _datas, const string& _num)
+{
+    for (const auto& data : _datas)
+    {
+        if (data->info->name != SYS_CURRENT_STATE)
+        {
+            continue;
+        }
+        for (auto entries : {data->dirtyEntries, data->newEntries})
+        {
+            for (size_t i = 0; i < entries->size(); ++i)
+            {
+                auto entry = entries->get(i);
+                if (entry->getField(SYS_KEY) == SYS_KEY_CURRENT_NUMBER &&
+                    entry->getField(SYS_VALUE) == _num)
+                {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+}  // namespace
+
 SQLBasicAccess::SQLBasicAccess()
 {
     if (g_BCOSConfig.version() >= V2_6_0)
@@ -40,6 +143,14 @@ SQLBasicAccess::SQLBasicAccess()
     }
 }
 
+SQLBasicAccess::~SQLBasicAccess()
+{
+    for (size_t i = 0; i < m_commitConnectionList.size(); ++i)
+    {
+        releaseCommitConnection(i);
+    }
+}
+
 int SQLBasicAccess::Select(int64_t, const string& _table, const string&, Condition::Ptr _condition,
     vector<map<string, string>>& _values)
 {
@@ -392,6 +503,15 @@ int SQLBasicAccess::Commit(int64_t _num, const vector<TableData::Ptr>& _datas)
     ELSE
     {
         SQLBasicAccess_LOG(ERROR) << "commit failed just return";
+        // the transactions of the connections are rolled back when back to the pool
+        for (size_t i = 0; i < m_commitConnectionList.size(); ++i)
+        {
+            if (m_commitConnectionList[i]->pendingXid.empty())
+            {
+                releaseCommitConnection(i);
+            }
+        }
+        m_recoverCommit = true;
         return -1;
     }
     END_TRY;
@@ -407,6 +527,11 @@ int SQLBasicAccess::CommitDo(int64_t _num, const vector<TableData::Ptr>& _datas,
         SQLBasicAccess_LOG(DEBUG) << "empty data just return";
         return 0;
     }
+    if (m_recoverCommit && !RecoverCommit())
+    {
+        _errorMsg = "recover the last commit failed";
+        return -1;
+    }
 
     /*execute commit operation*/
 
@@ -434,67 +559,41 @@ int SQLBasicAccess::CommitDo(int64_t _num, const vector<TableData::Ptr>& _datas,
         return -1;
     }
     END_TRY;
+    m_connPool->ReturnConnection(conn);
 
-    volatile int32_t rowCount = 0;
-    m_connPool->BeginTransaction(conn);
-    TRY
+    vector<SQLCommitTable> tables(_datas.size());
+    for (size_t i = 0; i < _datas.size(); ++i)
     {
-        for (auto data : _datas)
-        {
-            auto tableInfo = data->info;
-            string tableName = tableInfo->name;
-            map<string, vector<string>> field2Values;
-            this->GetCommitFieldNameAndValue(data->dirtyEntries, strNum, field2Values);
-            this->GetCommitFieldNameAndValue(data->newEntries, strNum, field2Values);
+        auto& table = tables[i];
+        this->GetCommitFieldNameAndValue(_datas[i]->dirtyEntries, strNum, table.field2Values);
+        this->GetCommitFieldNameAndValue(_datas[i]->newEntries, strNum, table.field2Values);
 
-            SQLBasicAccess_LOG(DEBUG) << "table:" << tableName << " split to "
-                                      << field2Values.size() << " parts to commit";
+        SQLBasicAccess_LOG(DEBUG) << "table:" << _datas[i]->info->name << " split to "
+                                  << table.field2Values.size() << " parts to commit";
 
-            tableName = boost::algorithm::replace_all_copy(tableName, "\\", "\\\\");
-            tableName = boost::algorithm::replace_all_copy(tableName, "`", "\\`");
+        table.name = boost::algorithm::replace_all_copy(_datas[i]->info->name, "\\", "\\\\");
+        table.name = boost::algorithm::replace_all_copy(table.name, "`", "\\`");
+        table.blob = isBlobType(table.name);
+    }
 
-            auto tableWithBlobField = isBlobType(tableName);
-            for (auto item : field2Values)
-            {
-                const auto& name = item.first;
-                const auto& values = item.second;
-                vector<SQLPlaceholderItem> sqlPlaceholders =
-                    this->BuildCommitSql(tableName, name, values);
-                auto itValue = values.begin();
-                for (auto& placeholder : sqlPlaceholders)
-                {
-                    PreparedStatement_T preStatement =
-                        Connection_prepareStatement(conn, "%s", placeholder.sql.c_str());
-                    SQLBasicAccess_LOG(TRACE)
-                        << "table:" << tableName << " sql:" << placeholder.sql;
+    auto branches = SplitCommitTables(_datas, m_commitConnections);
+    if (branches.size() > 1 && hasCurrentNumber(_datas, strNum))
+    {
+        return CommitParallel(_num, tables, branches, _errorMsg);
+    }
 
-                    uint32_t index = 0;
-                    for (; itValue != values.end(); ++itValue)
-                    {
-                        if (tableWithBlobField)
-                        {
-                            PreparedStatement_setBlob(
-                                preStatement, ++index, itValue->c_str(), itValue->size());
-                        }
-                        else
-                        {
-                            PreparedStatement_setString(preStatement, ++index, itValue->c_str());
-                            SQLBasicAccess_LOG(TRACE) << " index:" << index << " num:" << _num
-                                                      << " setString:" << itValue->c_str();
-                        }
-
-                        if (index == placeholder.placeholderCnt)
-                        {
-                            PreparedStatement_execute(preStatement);
-                            rowCount += (int32_t)PreparedStatement_rowsChanged(preStatement);
-                            ++itValue;
-                            break;
-                        }
-                    }
-                }
-            }
-        }
+    // commit all the tables in one transaction
+    vector<size_t> indexes(tables.size());
+    iota(indexes.begin(), indexes.end(), 0);
+    if (!acquireCommitConnections(1))
+    {
+        _errorMsg = "get connection failed";
+        return -1;
     }
+    auto& commitConn = *m_commitConnectionList[0];
+    volatile int32_t rowCount = 0;
+    m_connPool->BeginTransaction(commitConn.connection);
+    TRY { rowCount = WriteTables(commitConn, tables, indexes); }
     CATCH(SQLException)
     {
         _errorMsg = Exception_frame.message;
@@ -502,8 +601,8 @@ int SQLBasicAccess::CommitDo(int64_t _num, const vector<TableData::Ptr>& _datas,
         SQLBasicAccess_LOG(DEBUG) << "active connections:" << m_connPool->GetActiveConnections()
                                   << " max connetions:" << m_connPool->GetMaxConnections()
                                   << " now connections:" << m_connPool->GetTotalConnections();
-        m_connPool->RollBack(conn);
-        m_connPool->ReturnConnection(conn);
+        m_connPool->RollBack(commitConn.connection);
+        releaseCommitConnection(0);
         return -1;
     }
     END_TRY;
@@ -511,79 +610,378 @@ int SQLBasicAccess::CommitDo(int64_t _num, const vector<TableData::Ptr>& _datas,
     SQLBasicAccess_LOG(INFO) << "commit now active connections:"
                              << m_connPool->GetActiveConnections()
                              << " max connections:" << m_connPool->GetMaxConnections();
-    m_connPool->Commit(conn);
-    m_connPool->ReturnConnection(conn);
+    m_connPool->Commit(commitConn.connection);
     return rowCount;
 }
 
-vector<SQLPlaceholderItem> SQLBasicAccess::BuildCommitSql(
-    const string& _table, const string& _fieldStr, const vector<string>& _fieldValues)
+/*
+    every branch writes its tables in an XA transaction of its own connection, and the block is
+    committed once the first branch with the current number is committed after all the branches
+    are prepared, the others are committed after it or by RecoverCommit
+*/
+int SQLBasicAccess::CommitParallel(int64_t _num, const vector<SQLCommitTable>& _tables,
+    const vector<vector<size_t>>& _branches, string& _errorMsg)
 {
-    vector<string> fieldNames;
-    boost::split(fieldNames, _fieldStr, boost::is_any_of(","));
-    vector<SQLPlaceholderItem> sqlPlaceholders;
-    if (fieldNames.size() == 0 || _fieldValues.size() == 0 ||
-        (_fieldValues.size() % fieldNames.size()))
+    if (!acquireCommitConnections(_branches.size()))
     {
-        /*throw exception*/
-        SQLBasicAccess_LOG(ERROR) << "table name:" << _table << "field size:" << fieldNames.size()
-                                  << " value size:" << _fieldValues.size()
-                                  << " field size and value should be greate than 0";
-        THROW(SQLException, "PreparedStatement_executeQuery");
+        _errorMsg = "get connection failed";
+        return -1;
+    }
+    vector<string> gtrids(_branches.size());
+    vector<string> xids(_branches.size());
+    for (size_t i = 0; i < _branches.size(); ++i)
+    {
+        gtrids[i] = c_xidPrefix + to_string(_num) + "_" + to_string(i);
+        xids[i] = formatXid(gtrids[i], m_connPool->dbName());
     }
 
-    string sqlHeader = "replace into `";
-    sqlHeader.append(_table).append("`(");
-    sqlHeader.append(_fieldStr);
-    sqlHeader.append(") values");
+    vector<int32_t> rowCounts(_branches.size(), -1);
+    vector<string> errors(_branches.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, _branches.size()),
+        [&](const tbb::blocked_range<size_t>& _range) {
+            for (size_t i = _range.begin(); i < _range.end(); ++i)
+            {
+                auto& commitConn = *m_commitConnectionList[i];
+                TRY
+                {
+                    Connection_execute(commitConn.connection, "XA START %s", xids[i].c_str());
+                    int32_t rowCount = WriteTables(commitConn, _tables, _branches[i]);
+                    Connection_execute(commitConn.connection, "XA END %s", xids[i].c_str());
+                    Connection_execute(commitConn.connection, "XA PREPARE %s", xids[i].c_str());
+                    commitConn.pendingXid = gtrids[i];
+                    rowCounts[i] = rowCount;
+                }
+                CATCH(SQLException) { errors[i] = Exception_frame.message; }
+                END_TRY;
+            }
+        });
 
-    SQLBasicAccess_LOG(INFO) << "table name:" << _table << "field size:" << fieldNames.size()
-                             << " value size:" << _fieldValues.size();
+    if (find(rowCounts.begin(), rowCounts.end(), -1) != rowCounts.end())
+    {
+        for (size_t i = 0; i < _branches.size(); ++i)
+        {
+            auto& commitConn = *m_commitConnectionList[i];
+            if (commitConn.pendingXid.empty())
+            {
+                _errorMsg = errors[i];
+                SQLBasicAccess_LOG(ERROR) << "insert data exception:" << _errorMsg
+                                          << " branch:" << i << " num:" << _num;
+                executeXA(commitConn.connection, "END", xids[i]);
+                executeXA(commitConn.connection, "ROLLBACK", xids[i]);
+                releaseCommitConnection(i);
+            }
+            else if (executeXA(commitConn.connection, "ROLLBACK", xids[i]))
+            {
+                commitConn.pendingXid.clear();
+            }
+            else
+            {
+                m_recoverCommit = true;
+            }
+        }
+        return -1;
+    }
 
-    string sql = sqlHeader;
-    uint32_t placeholderCnt = 0;
-    uint32_t valueSize = _fieldValues.size();
-    uint32_t columnSize = fieldNames.size();
-    for (uint32_t index = 0; index < valueSize; ++index)
+    if (!executeXA(m_commitConnectionList[0]->connection, "COMMIT", xids[0]))
     {
-        ++placeholderCnt;
-        if (index % columnSize == 0)
+        _errorMsg = "commit the first branch failed";
+        m_recoverCommit = true;
+        return -1;
+    }
+    m_commitConnectionList[0]->pendingXid.clear();
+
+    std::atomic<bool> committed(true);
+    tbb::parallel_for(tbb::blocked_range<size_t>(1, _branches.size()),
+        [&](const tbb::blocked_range<size_t>& _range) {
+            for (size_t i = _range.begin(); i < _range.end(); ++i)
+            {
+                auto& commitConn = *m_commitConnectionList[i];
+                if (executeXA(commitConn.connection, "COMMIT", xids[i]))
+                {
+                    commitConn.pendingXid.clear();
+                }
+                else
+                {
+                    committed = false;
+                }
+            }
+        });
+    if (!committed)
+    {
+        // the block is committed by the first branch, RecoverCommit commits the others
+        _errorMsg = "commit the branches failed";
+        m_recoverCommit = true;
+        return -1;
+    }
+
+    SQLBasicAccess_LOG(INFO) << "commit in parallel num:" << _num
+                             << " branches:" << _branches.size()
+                             << " now active connections:" << m_connPool->GetActiveConnections()
+                             << " max connections:" << m_connPool->GetMaxConnections();
+    return accumulate(rowCounts.begin(), rowCounts.end(), 0);
+}
+
+int SQLBasicAccess::WriteTables(SQLCommitConnection& _conn, const vector<SQLCommitTable>& _tables,
+    const vector<size_t>& _indexes)
+{
+    int32_t rowCount = 0;
+    for (auto index : _indexes)
+    {
+        const auto& table = _tables[index];
+        for (const auto& item : table.field2Values)
+        {
+            const auto& name = item.first;
+            const auto& values = item.second;
+            size_t columns = count(name.begin(), name.end(), ',') + 1;
+            if (values.size() == 0 || (values.size() % columns))
+            {
+                /*throw exception*/
+                SQLBasicAccess_LOG(ERROR)
+                    << "table name:" << table.name << "field size:" << columns
+                    << " value size:" << values.size()
+                    << " field size and value should be greate than 0";
+                THROW(SQLException, "PreparedStatement_executeQuery");
+            }
+            SQLBasicAccess_LOG(DEBUG) << "table name:" << table.name << "field size:" << columns
+                                      << " value size:" << values.size();
+
+            auto itValue = values.begin();
+            for (auto rows : BatchRows(values.size() / columns, columns))
+            {
+                auto key = make_tuple(table.name, name, rows);
+                auto it = _conn.statements.find(key);
+                if (it == _conn.statements.end())
+                {
+                    string sql = BuildCommitSql(table.name, name, columns, rows);
+                    SQLBasicAccess_LOG(TRACE) << "table:" << table.name << " sql:" << sql;
+                    it = _conn.statements
+                             .emplace(key,
+                                 Connection_prepareStatement(_conn.connection, "%s", sql.c_str()))
+                             .first;
+                }
+                PreparedStatement_T preStatement = it->second;
+                for (uint32_t index = 1; index <= rows * columns; ++index, ++itValue)
+                {
+                    if (table.blob)
+                    {
+                        PreparedStatement_setBlob(
+                            preStatement, index, itValue->c_str(), itValue->size());
+                    }
+                    else
+                    {
+                        PreparedStatement_setString(preStatement, index, itValue->c_str());
+                        SQLBasicAccess_LOG(TRACE)
+                            << " index:" << index << " setString:" << itValue->c_str();
+                    }
+                }
+                PreparedStatement_execute(preStatement);
+                rowCount += (int32_t)PreparedStatement_rowsChanged(preStatement);
+            }
+        }
+    }
+    return rowCount;
+}
+
+bool SQLBasicAccess::RecoverCommit()
+{
+    Connection_T conn = m_connPool->GetConnection();
+    if (conn == NULL)
+    {
+        SQLBasicAccess_LOG(ERROR) << "recover commit get connection failed";
+        return false;
+    }
+    volatile bool success = true;
+    TRY
+    {
+        int64_t number = currentNumber(conn);
+        // the branches prepared by the held connections
+        for (size_t i = 0; i < m_commitConnectionList.size(); ++i)
+        {
+            auto& commitConn = *m_commitConnectionList[i];
+            if (commitConn.pendingXid.empty())
+            {
+                continue;
+            }
+            auto command = xidNumber(commitConn.pendingXid) <= number ? "COMMIT" : "ROLLBACK";
+            SQLBasicAccess_LOG(INFO) << "recover commit xid:" << commitConn.pendingXid
+                                     << " command:" << command << " current number:" << number;
+            if (executeXA(commitConn.connection, command,
+                    formatXid(commitConn.pendingXid, m_connPool->dbName())))
+            {
+                commitConn.pendingXid.clear();
+            }
+            else
+            {
+                // the branch is kept by the server after the broken connection is closed
+                releaseCommitConnection(i);
+            }
+        }
+
+        // the branches of the closed connections, or left by the last run of the node
+        vector<pair<string, string>> recoverXids;
+        ResultSet_T result = Connection_executeQuery(conn, "XA RECOVER");
+        while (ResultSet_next(result))
         {
-            sql.append("(?,");
+            int gtridLength = ResultSet_getInt(result, 2);
+            int bqualLength = ResultSet_getInt(result, 3);
+            int size = 0;
+            auto data = (const char*)ResultSet_getBlob(result, 4, &size);
+            if (!data || gtridLength < 0 || bqualLength < 0 || size < gtridLength + bqualLength)
+            {
+                continue;
+            }
+            string gtrid(data, gtridLength);
+            string bqual(data + gtridLength, bqualLength);
+            if (bqual == m_connPool->dbName() && boost::starts_with(gtrid, c_xidPrefix))
+            {
+                recoverXids.emplace_back(gtrid, bqual);
+            }
         }
-        else
+        for (const auto& xid : recoverXids)
         {
-            sql.append("?,");
+            auto command = xidNumber(xid.first) <= number ? "COMMIT" : "ROLLBACK";
+            SQLBasicAccess_LOG(INFO) << "recover commit xid:" << xid.first
+                                     << " command:" << command << " current number:" << number;
+            Connection_execute(conn, "XA %s %s", command,
+                formatXid(xid.first, xid.second).c_str());
         }
-        if (index % columnSize == (columnSize - 1))
+    }
+    CATCH(SQLException)
+    {
+        SQLBasicAccess_LOG(ERROR) << "recover commit exception:" << Exception_frame.message;
+        success = false;
+    }
+    END_TRY;
+    m_connPool->ReturnConnection(conn);
+    m_recoverCommit = !success;
+    return success;
+}
+
+bool SQLBasicAccess::acquireCommitConnections(size_t _count)
+{
+    while (m_commitConnectionList.size() < _count)
+    {
+        m_commitConnectionList.push_back(make_shared<SQLCommitConnection>());
+    }
+    for (size_t i = 0; i < _count; ++i)
+    {
+        auto& commitConn = *m_commitConnectionList[i];
+        if (commitConn.pendingXid.empty() &&
+            commitConn.statements.size() > c_maxPreparedStatements)
+        {
+            // the prepared statements are freed when the connection is back to the pool
+            releaseCommitConnection(i);
+        }
+        if (commitConn.connection == NULL)
         {
-            sql = sql.substr(0, sql.size() - 1);
-            sql.append("),");
-            /*
-                if placeholders count is great than 65535 sql will execute failed
-                so we need to execute in multiple sqls
-            */
-            if (placeholderCnt >= maxPlaceHolderCnt)
+            commitConn.connection = m_connPool->GetConnection();
+            if (commitConn.connection == NULL)
             {
-                sql = sql.substr(0, sql.size() - 1);
-                SQLPlaceholderItem item;
-                item.sql = sql;
-                item.placeholderCnt = placeholderCnt;
-                sqlPlaceholders.emplace_back(item);
-                sql = sqlHeader;
-                placeholderCnt = 0;
+                SQLBasicAccess_LOG(WARNING) << "get commit connection failed index:" << i;
+                return false;
             }
         }
     }
-    if (placeholderCnt > 0)
+    return true;
+}
+
+void SQLBasicAccess::releaseCommitConnection(size_t _index)
+{
+    auto& commitConn = *m_commitConnectionList[_index];
+    if (commitConn.connection != NULL)
     {
-        sql = sql.substr(0, sql.size() - 1);
-        SQLPlaceholderItem item;
-        item.sql = sql;
-        item.placeholderCnt = placeholderCnt;
-        sqlPlaceholders.emplace_back(item);
+        m_connPool->ReturnConnection(commitConn.connection);
+        commitConn.connection = NULL;
     }
-    return sqlPlaceholders;
+    commitConn.statements.clear();
+    commitConn.pendingXid.clear();
+}
+
+vector<size_t> SQLBasicAccess::BatchRows(size_t _rows, size_t _columns)
+{
+    /*
+        if placeholders count is great than 65535 sql will execute failed
+        so we need to execute in multiple sqls
+    */
+    size_t maxRows = max(maxPlaceHolderCnt / max(_columns, (size_t)1), (size_t)1);
+    vector<size_t> batchRows(_rows / maxRows, maxRows);
+    size_t restRows = _rows % maxRows;
+    size_t rows = 1;
+    while (rows * 2 <= restRows)
+    {
+        rows *= 2;
+    }
+    for (; restRows > 0; rows /= 2)
+    {
+        if (restRows & rows)
+        {
+            batchRows.push_back(rows);
+            restRows -= rows;
+        }
+    }
+    return batchRows;
+}
+
+vector<vector<size_t>> SQLBasicAccess::SplitCommitTables(
+    const vector<TableData::Ptr>& _datas, size_t _branches)
+{
+    _branches = max(min(_branches, _datas.size()), (size_t)1);
+    // a statement is executed for a table even if it has few rows
+    auto weight = [&_datas](size_t _index) {
+        return _datas[_index]->dirtyEntries->size() + _datas[_index]->newEntries->size() + 1;
+    };
+    vector<size_t> indexes(_datas.size());
+    iota(indexes.begin(), indexes.end(), 0);
+    stable_sort(indexes.begin(), indexes.end(), [&](size_t _left, size_t _right) {
+        bool leftState = (_datas[_left]->info->name == SYS_CURRENT_STATE);
+        bool rightState = (_datas[_right]->info->name == SYS_CURRENT_STATE);
+        if (leftState != rightState)
+        {
+            return leftState;
+        }
+        return weight(_left) > weight(_right);
+    });
+
+    vector<vector<size_t>> branches(_branches);
+    vector<size_t> branchWeights(_branches, 0);
+    for (auto index : indexes)
+    {
+        auto branch = min_element(branchWeights.begin(), branchWeights.end()) -
+                      branchWeights.begin();
+        branches[branch].push_back(index);
+        branchWeights[branch] += weight(index);
+    }
+    branches.erase(remove_if(branches.begin(), branches.end(),
+                       [](const vector<size_t>& _branch) { return _branch.empty(); }),
+        branches.end());
+    for (auto& branch : branches)
+    {
+        sort(branch.begin(), branch.end());
+    }
+    return branches;
+}
+
+string SQLBasicAccess::BuildCommitSql(
+    const string& _table, const string& _fieldStr, size_t _columns, size_t _rows)
+{
+    string row = "(";
+    for (size_t i = 0; i < _columns; ++i)
+    {
+        row.append("?,");
+    }
+    row.back() = ')';
+
+    string sql = "replace into `";
+    sql.append(_table).append("`(");
+    sql.append(_fieldStr);
+    sql.append(") values");
+    sql.reserve(sql.size() + (row.size() + 1) * _rows);
+    for (size_t i = 0; i < _rows; ++i)
+    {
+        sql.append(row).append(",");
+    }
+    sql.pop_back();
+    return sql;
 }
 
 void SQLBasicAccess::setConnPool(SQLConnectionPool::Ptr& _connPool)
@@ -36,23 +36,32 @@ namespace dev
 namespace storage
 {
 class SQLConnectionPool;
-struct SQLPlaceholderItem
-{
-    std::string sql;
-    uint32_t placeholderCnt;
-
-    SQLPlaceholderItem() : placeholderCnt(0) {}
-};
+struct SQLCommitConnection;
+struct SQLCommitTable;
 
 class SQLBasicAccess
 {
 public:
     SQLBasicAccess();
-    virtual ~SQLBasicAccess() {}
+    virtual ~SQLBasicAccess();
     typedef std::shared_ptr<SQLBasicAccess> Ptr;
     virtual int Select(int64_t _num, const std::string& _table, const std::string& _key,
         Condition::Ptr _condition, std::vector<std::map<std::string, std::string>>& _values);
     virtual int Commit(int64_t _num, const std::vector<TableData::Ptr>& _datas);
+    /*
+        resolve the XA branches left prepared by an interrupted parallel commit: the branches of
+        the blocks not greater than the current number in _sys_current_state_ are committed, the
+        others are rolled back
+    */
+    virtual bool RecoverCommit();
+
+    /// the rows written by every statement, the full batches and then the descending powers of 2,
+    /// so only a few statements of a table are prepared whatever the number of rows is
+    static std::vector<size_t> BatchRows(size_t _rows, size_t _columns);
+    /// split the tables into at most _branches groups of similar rows, _sys_current_state_ is
+    /// always in the first group which is committed before the others
+    static std::vector<std::vector<size_t>> SplitCommitTables(
+        const std::vector<TableData::Ptr>& _datas, size_t _branches);
 
 private:
     std::string BuildQuerySql(std::string _table, Condition::Ptr _condition);
@@ -60,8 +69,8 @@ private:
     std::string BuildConditionSql(const std::string& _strPrefix,
         std::map<std::string, Condition::Range>::const_iterator& _it, Condition::Ptr _condition);
 
-    std::vector<SQLPlaceholderItem> BuildCommitSql(const std::string& _table,
-        const std::string& _fieldStr, const std::vector<std::string>& _fieldValue);
+    std::string BuildCommitSql(
+        const std::string& _table, const std::string& _fieldStr, size_t _columns, size_t _rows);
 
     std::string BuildCreateTableSql(const Entry::Ptr& _data);
     std::string BuildCreateTableSql(const std::string& _tableName, const std::string& _keyField,
@@ -75,6 +84,13 @@ private:
         std::vector<std::string>& _valueList);
 
     int CommitDo(int64_t _num, const std::vector<TableData::Ptr>& _datas, std::string& _errorMsg);
+    int CommitParallel(int64_t _num, const std::vector<SQLCommitTable>& _tables,
+        const std::vector<std::vector<size_t>>& _branches, std::string& _errorMsg);
+    int WriteTables(SQLCommitConnection& _conn, const std::vector<SQLCommitTable>& _tables,
+        const std::vector<size_t>& _indexes);
+
+    bool acquireCommitConnections(size_t _count);
+    void releaseCommitConnection(size_t _index);
 
     SQLFieldType getFieldType(std::string const& _tableName);
     bool inline isBlobType(std::string const& _tableName)
@@ -90,10 +106,21 @@ private:
 public:
     virtual void ExecuteSql(const std::string& _sql);
     void setConnPool(std::shared_ptr<SQLConnectionPool>& _connPool);
+    /// the max connections committing the tables of a block in parallel
+    void setCommitConnections(size_t _commitConnections)
+    {
+        m_commitConnections = std::max(_commitConnections, (size_t)1);
+    }
 
 private:
     std::shared_ptr<SQLConnectionPool> m_connPool;
     std::string m_rowFormat = "";
+
+    // held out of the pool by the commit thread, so the prepared statements are kept
+    std::vector<std::shared_ptr<SQLCommitConnection>> m_commitConnectionList;
+    size_t m_commitConnections = 1;
+    // some branches of the last parallel commit may be left prepared
+    bool m_recoverCommit = false;
 };
 
 }  // namespace storage
@@ -38,6 +38,7 @@ bool SQLConnectionPool::InitConnectionPool(const storage::ConnectionPoolConfig&
            << "?user=" << _dbConfig.dbUsername << "&password=" << _dbConfig.dbPasswd
            << "&charset=" << _dbConfig.dbCharset << "&useUnicode=yes";
 
+        m_dbName = _dbConfig.dbName;
         m_url = URL_new(ss.str().c_str());
         if (m_url == NULL)
         {
@@ -67,10 +67,12 @@ public:
     int GetTotalConnections();
 
     void createDataBase(const ConnectionPoolConfig& _dbConfig);
+    const std::string& dbName() const { return m_dbName; }
 
 private:
     ConnectionPool_T m_connectionPool;
     URL_T m_url;
+    std::string m_dbName;
 };
 
 inline void errorExitOut(std::stringstream& _exitInfo);
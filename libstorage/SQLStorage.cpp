@@ -21,6 +21,7 @@
 
 #include "StorageException.h"
 
+#include "AMDBCodec.h"
 #include "Common.h"
 #include "SQLStorage.h"
 #include "Table.h"
@@ -102,7 +103,30 @@ Entries::Ptr SQLStorage::select(
             }
         }
 
-        Json::Value responseJson = requestDB(requestJson);
+        if (g_BCOSConfig.version() > RC3_VERSION && binaryProtocol())
+        {
+            requestJson["params"]["format"] = "binary";
+        }
+
+        Json::Value responseJson;
+        auto response = requestDB(requestJson, responseJson);
+
+        Entries::Ptr entries = std::make_shared<Entries>();
+        bytesConstRef responseData(response->data(), response->dataSize());
+        if (AMDBCodec::isBinaryFrame(responseData))
+        {
+            auto rows = std::make_shared<Entries>();
+            AMDBCodec::decodeRows(responseData, rows);
+            for (auto entry : *rows)
+            {
+                if (entry->getStatus() == 0)
+                {
+                    entry->setDirty(false);
+                    entries->addEntry(entry);
+                }
+            }
+            return entries;
+        }
 
         int code = responseJson["code"].asInt();
         if (code != 0)
@@ -113,7 +137,6 @@ Entries::Ptr SQLStorage::select(
                 -1, "Remote database return error:" + boost::lexical_cast<std::string>(code)));
         }
 
-        Entries::Ptr entries = std::make_shared<Entries>();
         if (g_BCOSConfig.version() <= RC3_VERSION)
         {
             std::vector<std::string> columns;
@@ -205,6 +228,23 @@ size_t SQLStorage::commit(int64_t num, const std::vector<TableData::Ptr>& datas)
             return 0;
         }
 
+        if (binaryProtocol())
+        {
+            bytes frame;
+            AMDBCodec::encodeCommit(num, datas, frame);
+            STORAGE_EXTERNAL_LOG(DEBUG) << "Commit binary frame" << LOG_KV("num", num)
+                                        << LOG_KV("size", frame.size());
+            Json::Value responseJson;
+            auto response = requestDB(ref(frame), responseJson);
+            bytesConstRef responseData(response->data(), response->dataSize());
+            // the response json is not parsed from the binary response
+            if (AMDBCodec::isBinaryFrame(responseData))
+            {
+                return AMDBCodec::decodeCommitResult(responseData);
+            }
+            return responseJson["result"]["count"].asInt();
+        }
+
         Json::Value requestJson;
 
         requestJson["op"] = "commit";
@@ -298,11 +338,18 @@ TableData::Ptr SQLStorage::selectTableDataByNum(
         requestJson["params"]["num"] = num;
         requestJson["params"]["preIndex"] = start;
         requestJson["params"]["pageSize"] = counts;
+        if (binaryProtocol())
+        {
+            requestJson["params"]["format"] = "binary";
+        }
 
-        Json::Value responseJson = requestDB(requestJson);
+        Json::Value responseJson;
+        auto response = requestDB(requestJson, responseJson);
+        bytesConstRef responseData(response->data(), response->dataSize());
+        bool binary = AMDBCodec::isBinaryFrame(responseData);
         int code = responseJson["code"].asInt();
         std::string message = responseJson["message"].asString();
-        if (code != 0)
+        if (!binary && code != 0)
         {
             STORAGE_EXTERNAL_LOG(ERROR) << LOG_KV("Remote database return error code", code)
                                         << LOG_KV("error message", message);
@@ -319,24 +366,49 @@ TableData::Ptr SQLStorage::selectTableDataByNum(
         STORAGE_EXTERNAL_LOG(TRACE)
             << LOG_DESC("fields in table") << LOG_KV("table", tableInfo->name)
             << LOG_KV("size", tableInfo->fields.size());
-        for (Json::ArrayIndex i = 0; i < responseJson["result"].size(); ++i)
+        auto setField = [&tableInfo](Entry::Ptr _entry, const std::string& _key,
+                            const std::string& _value) {
+            if (std::find(tableInfo->fields.begin(), tableInfo->fields.end(), _key) !=
+                tableInfo->fields.end())
+            {
+                _entry->setField(_key, _value);
+            }
+            else
+            {
+                STORAGE_EXTERNAL_LOG(ERROR) << LOG_DESC("Invalid key in table")
+                                            << LOG_KV("table", tableInfo->name)
+                                            << LOG_KV("key", _key);
+            }
+        };
+        if (binary)
+        {
+            auto rows = std::make_shared<Entries>();
+            AMDBCodec::decodeRows(responseData, rows);
+            for (auto row : *rows)
+            {
+                Entry::Ptr entry = std::make_shared<Entry>();
+                for (const auto& field : *row)
+                {
+                    setField(entry, field.first, field.second);
+                }
+                setField(entry, ID_FIELD, boost::lexical_cast<std::string>(row->getID()));
+                setField(entry, NUM_FIELD, boost::lexical_cast<std::string>(row->num()));
+                setField(entry, STATUS, boost::lexical_cast<std::string>(row->getStatus()));
+                entry->setID(row->getID());
+                entry->setNum(row->num());
+                entry->setStatus(row->getStatus());
+
+                entry->setDirty(false);
+                tableData->newEntries->addEntry(entry);
+            }
+        }
+        for (Json::ArrayIndex i = 0; !binary && i < responseJson["result"].size(); ++i)
         {
             Json::Value line = responseJson["result"][i];
             Entry::Ptr entry = std::make_shared<Entry>();
             for (auto key : line.getMemberNames())
             {
-                if (std::find(tableInfo->fields.begin(), tableInfo->fields.end(), key) !=
-                    tableInfo->fields.end())
-                {
-                    entry->setField(key, line.get(key, "").asString());
-                }
-                else
-                {
-                    STORAGE_EXTERNAL_LOG(ERROR)
-                        << LOG_DESC("Invalid key in table") << LOG_KV("table", tableInfo->name)
-                        << LOG_KV("key", key);
-                    // BOOST_THROW_EXCEPTION(runtime_error("Invalid key in table"));
-                }
+                setField(entry, key, line.get(key, "").asString());
             }
             entry->setID(line.get(ID_FIELD, "").asString());
             entry->setNum(line.get(NUM_FIELD, "").asString());
@@ -360,6 +432,25 @@ TableData::Ptr SQLStorage::selectTableDataByNum(
 }
 
 Json::Value SQLStorage::requestDB(const Json::Value& value)
+{
+    Json::Value responseJson;
+    requestDB(value, responseJson);
+    return responseJson;
+}
+
+dev::channel::TopicChannelMessage::Ptr SQLStorage::requestDB(
+    const Json::Value& _request, Json::Value& _responseJson)
+{
+    std::stringstream ssOut;
+    ssOut << _request;
+
+    auto str = ssOut.str();
+    STORAGE_EXTERNAL_LOG(TRACE) << "Request AMOPDB:" << str;
+    return requestDB(bytesConstRef((const byte*)str.data(), str.size()), _responseJson);
+}
+
+dev::channel::TopicChannelMessage::Ptr SQLStorage::requestDB(
+    bytesConstRef _request, Json::Value& _responseJson)
 {
     int retry = 1;
 
@@ -372,17 +463,14 @@ Json::Value SQLStorage::requestDB(const Json::Value& value)
             request->setType(channel::AMOP_REQUEST);
             request->setSeq(dev::newSeq());
 
-            std::stringstream ssOut;
-            ssOut << value;
-
-            auto str = ssOut.str();
-            STORAGE_EXTERNAL_LOG(TRACE) << "Request AMOPDB:" << request->seq() << " " << str;
+            STORAGE_EXTERNAL_LOG(TRACE)
+                << "Request AMOPDB:" << request->seq() << " size:" << _request.size();
 
 
             dev::channel::TopicChannelMessage::Ptr response;
 
             STORAGE_EXTERNAL_LOG(TRACE) << "Retry Request amdb :" << retry;
-            request->setTopicData(m_topic, (const byte*)str.data(), str.size());
+            request->setTopicData(m_topic, _request.data(), _request.size());
             response = m_channelRPCServer->pushChannelMessage(request, m_timeout);
             if (response.get() == NULL || response->result() != 0)
             {
@@ -397,22 +485,33 @@ Json::Value SQLStorage::requestDB(const Json::Value& value)
             std::string topic = response->topic();
             STORAGE_EXTERNAL_LOG(TRACE) << "Receive topic:" << topic;
 
-            std::stringstream ssIn;
-            std::string jsonStr(response->data(), response->data() + response->dataSize());
-            ssIn << jsonStr;
+            int code = 0;
+            bytesConstRef responseData(response->data(), response->dataSize());
+            if (AMDBCodec::isBinaryFrame(responseData))
+            {
+                STORAGE_EXTERNAL_LOG(TRACE)
+                    << "amdb-proxy binary Response size:" << responseData.size();
+                code = AMDBCodec::decodeCode(responseData);
+            }
+            else
+            {
+                std::stringstream ssIn;
+                std::string jsonStr(response->data(), response->data() + response->dataSize());
+                ssIn << jsonStr;
 
-            STORAGE_EXTERNAL_LOG(TRACE) << "amdb-proxy Response:" << ssIn.str();
+                STORAGE_EXTERNAL_LOG(TRACE) << "amdb-proxy Response:" << ssIn.str();
 
-            Json::Value responseJson;
-            ssIn >> responseJson;
+                _responseJson = Json::Value();
+                ssIn >> _responseJson;
 
-            auto codeValue = responseJson["code"];
-            if (!codeValue.isInt())
-            {
-                BOOST_THROW_EXCEPTION(StorageException(-1, "undefined amdb error code"));
+                auto codeValue = _responseJson["code"];
+                if (!codeValue.isInt())
+                {
+                    BOOST_THROW_EXCEPTION(StorageException(-1, "undefined amdb error code"));
+                }
+                code = codeValue.asInt();
             }
 
-            int code = codeValue.asInt();
             if (code == 1)
             {
                 BOOST_THROW_EXCEPTION(StorageException(
@@ -424,7 +523,7 @@ Json::Value SQLStorage::requestDB(const Json::Value& value)
                     -1, "amdb code error:" + boost::lexical_cast<std::string>(code)));
             }
 
-            return responseJson;
+            return response;
         }
         catch (dev::channel::ChannelException& e)
         {
@@ -466,6 +565,69 @@ Json::Value SQLStorage::requestDB(const Json::Value& value)
     }
 }
 
+bool SQLStorage::binaryProtocol()
+{
+    if (m_protocolVersion < 0)
+    {
+        std::lock_guard<std::mutex> lock(m_protocolMutex);
+        if (m_protocolVersion < 0)
+        {
+            m_protocolVersion = negotiateProtocol();
+            STORAGE_EXTERNAL_LOG(INFO)
+                << LOG_DESC("negotiate amdb protocol") << LOG_KV("version", m_protocolVersion);
+        }
+    }
+    return m_protocolVersion >= AMDBCodec::c_binaryProtocolVersion;
+}
+
+int SQLStorage::negotiateProtocol()
+{
+    Json::Value requestJson;
+    requestJson["op"] = "protocol";
+    requestJson["params"]["version"] = AMDBCodec::c_binaryProtocolVersion;
+    std::stringstream ssOut;
+    ssOut << requestJson;
+    auto str = ssOut.str();
+
+    dev::channel::TopicChannelMessage::Ptr response;
+    try
+    {
+        dev::channel::TopicChannelMessage::Ptr request =
+            std::make_shared<dev::channel::TopicChannelMessage>();
+        request->setType(channel::AMOP_REQUEST);
+        request->setSeq(dev::newSeq());
+        request->setTopicData(m_topic, (const byte*)str.data(), str.size());
+        response = m_channelRPCServer->pushChannelMessage(request, m_timeout);
+    }
+    catch (std::exception& e)
+    {
+        STORAGE_EXTERNAL_LOG(WARNING) << "negotiate amdb protocol error:" << e.what();
+    }
+    if (response.get() == NULL || response->result() != 0)
+    {
+        return -1;
+    }
+
+    // the proxy not knowing the protocol op only supports json
+    try
+    {
+        std::stringstream ssIn;
+        ssIn << std::string(response->data(), response->data() + response->dataSize());
+        Json::Value responseJson;
+        ssIn >> responseJson;
+        auto version = responseJson["result"]["version"];
+        if (responseJson["code"].isInt() && responseJson["code"].asInt() == 0 && version.isInt())
+        {
+            return std::min(version.asInt(), (int)AMDBCodec::c_binaryProtocolVersion);
+        }
+    }
+    catch (std::exception& e)
+    {
+        STORAGE_EXTERNAL_LOG(WARNING) << "negotiate amdb protocol error:" << e.what();
+    }
+    return 0;
+}
+
 void SQLStorage::setTopic(const std::string& topic)
 {
     m_topic = topic;
@@ -25,6 +25,8 @@
 #include <json/json.h>
 #include <libchannelserver/ChannelRPCServer.h>
 #include <libdevcore/FixedHash.h>
+#include <atomic>
+#include <mutex>
 
 namespace dev
 {
@@ -58,6 +60,16 @@ public:
 
 private:
     Json::Value requestDB(const Json::Value& value);
+    dev::channel::TopicChannelMessage::Ptr requestDB(
+        const Json::Value& _request, Json::Value& _responseJson);
+    /// @return the response, _responseJson is parsed only if the response is not a binary frame
+    dev::channel::TopicChannelMessage::Ptr requestDB(
+        bytesConstRef _request, Json::Value& _responseJson);
+
+    /// the binary framing is used if the proxy supports it, see AMDBCodec
+    bool binaryProtocol();
+    /// @return the protocol version supported by both sides, -1 if the proxy doesn't respond
+    int negotiateProtocol();
 
     std::function<void(std::exception&)> m_fatalHandler;
 
@@ -65,6 +77,9 @@ private:
     dev::ChannelRPCServer::Ptr m_channelRPCServer;
     int m_maxRetry = 0;
     size_t m_timeout = 10 * 1000;  // timeout by ms
+
+    std::mutex m_protocolMutex;
+    std::atomic<int> m_protocolVersion = {-1};
 };
 
 }  // namespace storage
@@ -846,6 +846,14 @@ bool Condition::related(Condition::Ptr condition)
     return false;
 }
 
+Table::Ptr TableFactory::createIndexedTable(const std::string& tableName, const std::string&,
+    const std::string&, const std::vector<std::string>&, bool, Address const&)
+{
+    STORAGE_LOG(ERROR) << LOG_BADGE("TableFactory") << LOG_DESC("secondary index not supported")
+                       << LOG_KV("table name", tableName);
+    BOOST_THROW_EXCEPTION(StorageException(-1, "secondary index not supported: " + tableName));
+}
+
 TableInfo::Ptr dev::storage::getSysTableInfo(const string& tableName)
 {
     auto tableInfo = make_shared<storage::TableInfo>();
@@ -912,5 +920,10 @@ TableInfo::Ptr dev::storage::getSysTableInfo(const string& tableName)
         tableInfo->fields = vector<string>{SYS_VALUE};
         tableInfo->enableConsensus = false;
     }
+    else if (tableName == SYS_TABLE_INDICES)
+    {
+        tableInfo->key = "table_name";
+        tableInfo->fields = vector<string>{INDEX_FIELD, INDEX_TABLE};
+    }
     return tableInfo;
 }
@@ -19,6 +19,7 @@
 
 #include "Common.h"
 #include <libdevcore/Address.h>
+#include <libdevcore/BlockArena.h>
 #include <libdevcore/FixedHash.h>
 #include <libdevcore/Guards.h>
 #include <tbb/concurrent_unordered_map.h>
@@ -323,8 +324,8 @@ public:
 
     virtual ~Table() = default;
 
-    virtual Entry::Ptr newEntry() { return std::make_shared<Entry>(); }
-    virtual Condition::Ptr newCondition() { return std::make_shared<Condition>(); }
+    virtual Entry::Ptr newEntry() { return makeShared<Entry>(m_arena); }
+    virtual Condition::Ptr newCondition() { return makeShared<Condition>(m_arena); }
     virtual Entries::ConstPtr select(const std::string& key, Condition::Ptr condition) = 0;
     virtual int update(const std::string& key, Entry::Ptr entry, Condition::Ptr condition,
         AccessOptions::Ptr options = std::make_shared<AccessOptions>()) = 0;
@@ -352,6 +353,8 @@ public:
     virtual TableInfo::Ptr tableInfo() { return m_tableInfo; }
     virtual void setTableInfo(TableInfo::Ptr tableInfo) { m_tableInfo = tableInfo; }
     virtual size_t cacheSize() { return 0; }
+    // the new entries and conditions are allocated in the arena of the executing block
+    virtual void setArena(BlockArena::Ptr _arena) { m_arena = _arena; }
 
 protected:
     std::function<void(Ptr, Change::Kind, std::string const&, std::vector<Change::Record>&)>
@@ -360,6 +363,7 @@ protected:
     TableInfo::Ptr m_tableInfo;
     h256 m_blockHash;
     int64_t m_blockNum = 0;
+    BlockArena::Ptr m_arena;
     bool m_hashDirty = false;  // mark if m_hash need to re-calculate
     bool m_dataDirty = false;  // mark if table has data to commit
 };
@@ -377,6 +381,11 @@ public:
     virtual Table::Ptr createTable(const std::string& tableName, const std::string& keyField,
         const std::string& valueField, bool authorityFlag, Address const& _origin = Address(),
         bool isPara = true) = 0;
+    // create a table whose _indexFields are maintained by secondary index tables
+    virtual Table::Ptr createIndexedTable(const std::string& tableName,
+        const std::string& keyField, const std::string& valueField,
+        const std::vector<std::string>& indexFields, bool authorityFlag,
+        Address const& _origin = Address());
 
     virtual h256 hash() = 0;
     virtual size_t savepoint() = 0;
@@ -391,11 +400,14 @@ public:
     }
     virtual void setBlockHash(h256 const& blockHash) { m_blockHash = blockHash; }
     virtual void setBlockNum(int64_t blockNum) { m_blockNum = blockNum; }
+    virtual void setArena(BlockArena::Ptr _arena) { m_arena = _arena; }
 
 protected:
     std::shared_ptr<Storage> m_stateStorage;
     h256 m_blockHash = h256(0);
     int64_t m_blockNum = 0;
+    // null if the tables are not opened for executing a block
+    BlockArena::Ptr m_arena;
 };
 
 class TableFactoryFactory : public std::enable_shared_from_this<TableFactoryFactory>
@@ -101,6 +101,8 @@ void ZdbStorage::setConnPool(std::shared_ptr<SQLConnectionPool>& _connPool)
 {
     m_sqlBasicAcc->setConnPool(_connPool);
     this->initSysTables();
+    // the parallel commit of the last run may be interrupted
+    m_sqlBasicAcc->RecoverCommit();
 }
 
 void ZdbStorage::SetSqlAccess(SQLBasicAccess::Ptr _sqlBasicAcc)
@@ -158,6 +160,10 @@ void ZdbStorage::initSysTables()
     createSysBlock2NoncesTables();
 
     createBlobSysHash2BlockHeaderTable();
+    if (g_BCOSConfig.version() >= V2_7_0)
+    {
+        createSysTableIndicesTable();
+    }
     insertSysTables();
 }
 
@@ -288,6 +294,20 @@ void ZdbStorage::createBlobSysHash2BlockHeaderTable()
     m_sqlBasicAcc->ExecuteSql(sql);
 }
 
+void ZdbStorage::createSysTableIndicesTable()
+{
+    stringstream ss;
+    ss << "CREATE TABLE IF NOT EXISTS `" << SYS_TABLE_INDICES << "` (\n";
+    ss << getCommonFileds();
+    ss << "`table_name` varchar(128) DEFAULT NULL,\n";
+    ss << "`" << INDEX_FIELD << "` varchar(128) DEFAULT NULL,\n";
+    ss << "`" << INDEX_TABLE << "` varchar(128) DEFAULT NULL,\n";
+    ss << " PRIMARY KEY (`_id_`),\n";
+    ss << "KEY `table_name` (`table_name`)\n";
+    ss << ") ENGINE=InnoDB DEFAULT CHARSET=utf8mb4;";
+    string sql = ss.str();
+    m_sqlBasicAcc->ExecuteSql(sql);
+}
 
 void ZdbStorage::createSysConsensus()
 {
@@ -347,6 +367,11 @@ void ZdbStorage::insertSysTables()
     ss << "	('" << SYS_HASH_2_BLOCK << "', 'hash','value'),\n";
     ss << "	('" << SYS_CNS << "', 'name','version,address,abi'),\n";
     ss << "	('" << SYS_CONFIG << "', 'key','value,enable_num'),\n";
+    if (g_BCOSConfig.version() >= V2_7_0)
+    {
+        ss << "	('" << SYS_TABLE_INDICES << "', 'table_name','" << INDEX_FIELD << ","
+           << INDEX_TABLE << "'),\n";
+    }
     ss << "	('" << SYS_BLOCK_2_NONCES << "', 'number','value');";
     ss << "	('" << SYS_HASH_2_BLOCKHEADER << "', 'hash','value', 'sigs');";
     string sql = ss.str();
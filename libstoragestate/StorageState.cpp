@@ -190,9 +190,13 @@ u256 StorageState::storage(Address const& _address, u256 const& _key)
     auto table = getTable(_address);
     if (table)
     {
-        auto entries = table->select(_key.str(), table->newCondition());
+        auto entries = table->select(storageKey(_key), table->newCondition());
         if (entries->size() != 0u)
         {
+            if (g_BCOSConfig.version() >= V2_7_0)
+            {
+                return fromBigEndian<u256>(entries->get(0)->getFieldConst(STORAGE_VALUE));
+            }
             return u256(entries->get(0)->getField(STORAGE_VALUE));
         }
     }
@@ -205,22 +209,27 @@ void StorageState::setStorage(Address const& _address, u256 const& _location, u2
     if (table)
     {
         auto option = std::make_shared<AccessOptions>(Address(), false);
-        auto entries = table->select(_location.str(), table->newCondition());
-        if (entries->size() == 0u)
+        auto key = storageKey(_location);
+        auto entries = table->select(key, table->newCondition());
+        auto entry = table->newEntry();
+        entry->setForce(true);
+        entry->setField(STORAGE_KEY, key);
+        if (g_BCOSConfig.version() >= V2_7_0)
         {
-            auto entry = table->newEntry();
-            entry->setForce(true);
-            entry->setField(STORAGE_KEY, _location.str());
-            entry->setField(STORAGE_VALUE, _value.str());
-            table->insert(_location.str(), entry, option);
+            h256 value(_value);
+            entry->setField(STORAGE_VALUE, value.data(), h256::size);
         }
         else
         {
-            auto entry = table->newEntry();
-            entry->setForce(true);
-            entry->setField(STORAGE_KEY, _location.str());
             entry->setField(STORAGE_VALUE, _value.str());
-            table->update(_location.str(), entry, table->newCondition(), option);
+        }
+        if (entries->size() == 0u)
+        {
+            table->insert(key, entry, option);
+        }
+        else
+        {
+            table->update(key, entry, table->newCondition(), option);
         }
     }
 }
@@ -540,6 +549,15 @@ void StorageState::createAccount(Address const& _address, u256 const& _nonce, u2
     table->insert(ACCOUNT_ALIVE, entry);
 }
 
+inline std::string StorageState::storageKey(u256 const& _location) const
+{
+    if (g_BCOSConfig.version() >= V2_7_0)
+    {  // the big-endian 32 bytes of the slot in hex, no big number division is needed
+        return toHex(h256(_location).ref());
+    }
+    return _location.str();
+}
+
 inline storage::Table::Ptr StorageState::getTable(Address const& _address) const
 {
     std::string tableName("_contract_data_" + _address.hex() + "_");
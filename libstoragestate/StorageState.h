@@ -180,6 +180,9 @@ public:
 private:
     void createAccount(Address const& _address, u256 const& _nonce, u256 const& _amount = u256(0));
     std::shared_ptr<dev::storage::Table> getTable(Address const& _address) const;
+    // the row key of the storage slot _location, since v2.7.0 the slot is fixed length hex and
+    // the value is the raw 32 bytes
+    std::string storageKey(u256 const& _location) const;
     u256 m_accountStartNonce;
     std::shared_ptr<dev::storage::TableFactory> m_memoryTableFactory;
 };
@@ -0,0 +1,230 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : streaming the blocks to the syncing peers in bounded chunks
+ * @file: BlockChunks.cpp
+ */
+#include "BlockChunks.h"
+#include <libdevcore/RLP.h>
+
+using namespace std;
+using namespace dev;
+using namespace dev::eth;
+using namespace dev::sync;
+
+namespace
+{
+// _base is c_rlpDataImmLenStart for the bytes and c_rlpListStart for the list
+void appendRLPPrefix(bytes& _out, byte _base, size_t _length)
+{
+    if (_length < c_rlpListImmLenCount)
+    {
+        _out.push_back(_base + _length);
+        return;
+    }
+    byte lengthBytes = 0;
+    for (size_t length = _length; length > 0; length >>= 8)
+    {
+        ++lengthBytes;
+    }
+    _out.push_back(_base + c_rlpListImmLenCount - 1 + lengthBytes);
+    for (int i = lengthBytes - 1; i >= 0; --i)
+    {
+        _out.push_back((byte)(_length >> (i * 8)));
+    }
+}
+
+/**
+ * @brief parse the prefix of the list at the beginning of _data
+ * @return false if _data is too short to contain the prefix, _prefixSize is 0 if not a list
+ */
+bool parseListPrefix(bytesConstRef _data, size_t& _prefixSize, size_t& _payloadSize)
+{
+    if (_data.empty())
+    {
+        return false;
+    }
+    _prefixSize = 0;
+    byte first = _data[0];
+    if (first < c_rlpListStart)
+    {
+        return true;
+    }
+    if (first <= c_rlpListIndLenZero)
+    {
+        _prefixSize = 1;
+        _payloadSize = first - c_rlpListStart;
+        return true;
+    }
+    size_t lengthBytes = first - c_rlpListIndLenZero;
+    if (_data.size() < 1 + lengthBytes)
+    {
+        return false;
+    }
+    _payloadSize = 0;
+    for (size_t i = 1; i <= lengthBytes; ++i)
+    {
+        _payloadSize = (_payloadSize << 8) | _data[i];
+    }
+    _prefixSize = 1 + lengthBytes;
+    return true;
+}
+}  // namespace
+
+BlockChunksAssembler::Result BlockChunksAssembler::push(NodeID const& _peer, int64_t _number,
+    size_t _blockSize, size_t _offset, bytesConstRef _chunk, bytes& _blocks)
+{
+    Guard l(x_blocks);
+    auto now = std::chrono::steady_clock::now();
+    eraseTimeoutBlocks(now);
+
+    auto it = m_blocks.find(_peer);
+    if (_offset == 0)
+    {
+        // the peer gives up the last block and starts a new one
+        if (it != m_blocks.end())
+        {
+            m_blocks.erase(it);
+        }
+        if (_blockSize == 0 || (int64_t)_blockSize > m_maxBlockSize)
+        {
+            return Result::Dropped;
+        }
+        AssemblingBlock block;
+        block.number = _number;
+        block.blockSize = _blockSize;
+        bytes bytesPrefix;
+        appendRLPPrefix(bytesPrefix, c_rlpDataImmLenStart, _blockSize);
+        appendRLPPrefix(block.buffer, c_rlpListStart, bytesPrefix.size() + _blockSize);
+        block.buffer.insert(block.buffer.end(), bytesPrefix.begin(), bytesPrefix.end());
+        block.prefixSize = block.buffer.size();
+        block.buffer.reserve(block.prefixSize + _blockSize);
+        it = m_blocks.emplace(_peer, std::move(block)).first;
+    }
+    else if (it == m_blocks.end() || it->second.number != _number ||
+             it->second.blockSize != _blockSize || it->second.received != _offset)
+    {
+        // the stream has been dropped, or some chunks are lost
+        if (it != m_blocks.end())
+        {
+            m_blocks.erase(it);
+        }
+        return Result::Dropped;
+    }
+
+    auto& block = it->second;
+    if (_offset + _chunk.size() > block.blockSize)
+    {
+        m_blocks.erase(it);
+        return Result::Dropped;
+    }
+    block.buffer.insert(block.buffer.end(), _chunk.begin(), _chunk.end());
+    block.received += _chunk.size();
+    block.updateTime = now;
+    if (!block.headerChecked && !checkHeader(block))
+    {
+        m_blocks.erase(it);
+        return Result::Dropped;
+    }
+    if (block.received < block.blockSize)
+    {
+        return Result::Pending;
+    }
+    // the whole block arrives but the header can not be parsed
+    if (!block.headerChecked)
+    {
+        m_blocks.erase(it);
+        return Result::Dropped;
+    }
+    _blocks.swap(block.buffer);
+    m_blocks.erase(it);
+    return Result::Completed;
+}
+
+bool BlockChunksAssembler::checkHeader(AssemblingBlock& _block)
+{
+    bytesConstRef received(_block.buffer.data() + _block.prefixSize, _block.received);
+    size_t blockPrefixSize = 0;
+    size_t blockPayloadSize = 0;
+    if (!parseListPrefix(received, blockPrefixSize, blockPayloadSize))
+    {
+        return true;
+    }
+    if (blockPrefixSize == 0 || blockPrefixSize + blockPayloadSize != _block.blockSize)
+    {
+        return false;
+    }
+    // the header is the first item of the block
+    size_t headerPrefixSize = 0;
+    size_t headerPayloadSize = 0;
+    auto headerData = received.cropped(blockPrefixSize);
+    if (!parseListPrefix(headerData, headerPrefixSize, headerPayloadSize))
+    {
+        return true;
+    }
+    if (headerPrefixSize == 0 ||
+        blockPrefixSize + headerPrefixSize + headerPayloadSize > _block.blockSize)
+    {
+        return false;
+    }
+    if (headerPrefixSize + headerPayloadSize > headerData.size())
+    {
+        return true;
+    }
+    try
+    {
+        BlockHeader header(
+            headerData.cropped(0, headerPrefixSize + headerPayloadSize), HeaderData);
+        if (header.number() != _block.number || (m_headerChecker && !m_headerChecker(header)))
+        {
+            return false;
+        }
+    }
+    catch (std::exception const&)
+    {
+        return false;
+    }
+    _block.headerChecked = true;
+    return true;
+}
+
+void BlockChunksAssembler::eraseTimeoutBlocks(std::chrono::steady_clock::time_point _now)
+{
+    for (auto it = m_blocks.begin(); it != m_blocks.end();)
+    {
+        if (_now - it->second.updateTime > std::chrono::milliseconds(c_blockStreamTimeout))
+        {
+            it = m_blocks.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void BlockChunksAssembler::erase(NodeID const& _peer)
+{
+    Guard l(x_blocks);
+    m_blocks.erase(_peer);
+}
+
+size_t BlockChunksAssembler::size() const
+{
+    Guard l(x_blocks);
+    return m_blocks.size();
+}
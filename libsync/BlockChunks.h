@@ -0,0 +1,105 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : streaming the blocks to the syncing peers in bounded chunks
+ * @file: BlockChunks.h
+ */
+#pragma once
+#include "Common.h"
+#include <libdevcore/Guards.h>
+#include <libethcore/BlockHeader.h>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+
+namespace dev
+{
+namespace sync
+{
+// the block being streamed to a peer, only the rest of one block is kept for every peer
+struct UploadingBlock
+{
+    using Ptr = std::shared_ptr<UploadingBlock>;
+    UploadingBlock(int64_t _number, std::shared_ptr<bytes> _blockRLP)
+      : number(_number), blockRLP(_blockRLP)
+    {}
+    int64_t number;
+    std::shared_ptr<bytes> blockRLP;
+    size_t offset = 0;
+};
+
+/**
+ * @brief Reassembles the blocks streamed by the peers.
+ * The chunks of a block are sent in order by one peer, a peer streams one block at a time. The
+ * header of the block is decoded and checked as soon as it arrives, so the streams of the blocks
+ * that are no longer needed are dropped before the rest of them arrives. The reassembled block is
+ * laid out as a BlocksPacket with one block, which is pushed into the DownloadingBlockQueue
+ * without copying.
+ */
+class BlockChunksAssembler
+{
+public:
+    using HeaderChecker = std::function<bool(dev::eth::BlockHeader const&)>;
+
+    enum class Result
+    {
+        Pending,
+        Completed,
+        Dropped
+    };
+
+    explicit BlockChunksAssembler(HeaderChecker const& _headerChecker)
+      : m_headerChecker(_headerChecker)
+    {}
+
+    /**
+     * @brief append a chunk of the block _number streamed by _peer
+     * @param _blocks: the reassembled block encoded as a list of one block, set if Completed
+     */
+    Result push(NodeID const& _peer, int64_t _number, size_t _blockSize, size_t _offset,
+        bytesConstRef _chunk, bytes& _blocks);
+
+    void erase(NodeID const& _peer);
+    size_t size() const;
+
+    // the streams larger than _maxBlockSize are dropped at the first chunk
+    void setMaxBlockSize(int64_t _maxBlockSize) { m_maxBlockSize = _maxBlockSize; }
+
+private:
+    struct AssemblingBlock
+    {
+        int64_t number;
+        size_t blockSize;
+        // the size of the list and the bytes prefixes of the block
+        size_t prefixSize;
+        size_t received = 0;
+        bool headerChecked = false;
+        std::chrono::steady_clock::time_point updateTime;
+        bytes buffer;
+    };
+    // @return false if the header is illegal
+    bool checkHeader(AssemblingBlock& _block);
+    void eraseTimeoutBlocks(std::chrono::steady_clock::time_point _now);
+
+    HeaderChecker m_headerChecker;
+    int64_t m_maxBlockSize = 512 * 1024 * 1024;
+    mutable Mutex x_blocks;
+    std::map<NodeID, AssemblingBlock> m_blocks;
+};
+}  // namespace sync
+}  // namespace dev
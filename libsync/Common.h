@@ -61,6 +61,21 @@ static unsigned const c_syncPacketIDBase = 1;
 
 static uint64_t const c_maintainBlocksTimeout = 5000;  // ms
 
+// transaction reconciliation: the round falls back to the txs status if there are more than
+// c_maxReconcileTxs pending txs, the sketch has between c_minSketchCells and c_maxSketchCells cells
+static size_t const c_maxReconcileTxs = 10000;
+static size_t const c_minSketchCells = 48;
+static size_t const c_maxSketchCells = 3 * 4096;
+// the round of reconciliation is considered lost if no response after c_reconcileTimeout
+static uint64_t const c_reconcileTimeout = 5000;  // ms
+
+// streaming blocks: the chunk size requested by the peers is limited to
+// [c_minBlockChunkSize, c_maxBlockChunkSize], the partially received block is dropped if no chunk
+// arrives in c_blockStreamTimeout
+static size_t const c_minBlockChunkSize = 16 * 1024;
+static size_t const c_maxBlockChunkSize = 512 * 1024;
+static uint64_t const c_blockStreamTimeout = 10000;  // ms
+
 using NodeList = std::set<dev::p2p::NodeID>;
 using NodeID = dev::p2p::NodeID;
 using NodeIDs = std::vector<dev::p2p::NodeID>;
@@ -80,6 +95,9 @@ enum SyncPacketType : byte
     ReqBlocskPacket = 0x03,
     TxsStatusPacket = 0x04,
     TxsRequestPacekt = 0x05,
+    TxsSketchPacket = 0x06,
+    TxsReconcileReqPacket = 0x07,
+    BlockChunksPacket = 0x08,
     PacketCount
 };
 
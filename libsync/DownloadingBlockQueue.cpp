@@ -44,6 +44,19 @@ void DownloadingBlockQueue::push(RLP const& _rlps)
     m_buffer->emplace_back(blocksShard);
 }
 
+void DownloadingBlockQueue::push(bytes&& _blocksBytes)
+{
+    WriteGuard l(x_buffer);
+    if (m_buffer->size() >= c_maxDownloadingBlockQueueBufferSize)
+    {
+        SYNC_LOG(WARNING) << LOG_BADGE("Download") << LOG_BADGE("BlockSync")
+                          << LOG_DESC("DownloadingBlockQueueBuffer is full")
+                          << LOG_KV("queueSize", m_buffer->size());
+        return;
+    }
+    m_buffer->emplace_back(make_shared<DownloadBlocksShard>(0, 0, std::move(_blocksBytes)));
+}
+
 
 void DownloadingBlockQueue::adjustMaxRequestBlocks()
 {
@@ -207,7 +220,7 @@ bool DownloadingBlockQueue::flushOneShard(ShardPtr _blocksShard)
                 // Note: the memory size occupied by Block object will increase to at least treble
                 // for:
                 // 1. txsCache of Block
-                // 2. m_rlpBuffer of every Transaction
+                // 2. the data of every Transaction copied out of txsCache on demand
                 // 3. the Block occupied memory calculated without cache
                 auto blockSize = block->blockSize() * m_blockSizeExpandCoeff;
                 m_blockQueueSize += blockSize;
@@ -40,6 +40,9 @@ public:
     DownloadBlocksShard(int64_t _fromNumber, int64_t _size, bytes const& _blocksBytes)
       : fromNumber(_fromNumber), size(_size), blocksBytes(_blocksBytes)
     {}
+    DownloadBlocksShard(int64_t _fromNumber, int64_t _size, bytes&& _blocksBytes)
+      : fromNumber(_fromNumber), size(_size), blocksBytes(std::move(_blocksBytes))
+    {}
     int64_t fromNumber;
     int64_t size;
     bytes blocksBytes;
@@ -76,6 +79,8 @@ public:
     /// PUsh a block packet
     void push(RLP const& _rlps);
     void push(BlockPtrVec _blocks);
+    /// push the encoded block packet without copying, used by the reassembled blocks
+    void push(bytes&& _blocksBytes);
 
     /// Is the queue empty?
     bool empty();
@@ -104,6 +109,7 @@ public:
     {
         m_maxBlockQueueSize = _maxBlockQueueSize;
     }
+    int64_t maxBlockQueueSize() const { return m_maxBlockQueueSize; }
 
     int64_t maxRequestBlocks() const { return m_maxRequestBlocks; }
     void adjustMaxRequestBlocks();
@@ -22,6 +22,7 @@
 
 #include "DownloadingTxsQueue.h"
 #include <tbb/parallel_for.h>
+#include <unordered_map>
 
 using namespace dev;
 using namespace dev::sync;
@@ -65,6 +66,40 @@ void DownloadingTxsQueue::push(
 }
 
 
+std::shared_ptr<dev::eth::Transactions> DownloadingTxsQueue::decodeShard(
+    std::shared_ptr<DownloadTxsShard> _txsShard, dev::eth::CheckTransaction _checkSig)
+{
+    auto txs = std::make_shared<dev::eth::Transactions>();
+    try
+    {
+        if (g_BCOSConfig.version() >= RC2_VERSION)
+        {
+            RLP const& txsBytesRLP = RLP(ref(_txsShard->txsBytes))[0];
+            dev::eth::TxsParallelParser::decode(
+                txs, txsBytesRLP.toBytesConstRef(), _checkSig, true);
+        }
+        else
+        {
+            RLP const& txsBytesRLP = RLP(ref(_txsShard->txsBytes));
+            unsigned txNum = txsBytesRLP.itemCount();
+            txs->resize(txNum);
+            for (unsigned j = 0; j < txNum; j++)
+            {
+                (*txs)[j] = std::make_shared<dev::eth::Transaction>();
+                (*txs)[j]->decode(txsBytesRLP[j]);
+            }
+        }
+    }
+    catch (std::exception const& e)
+    {
+        SYNC_LOG(WARNING) << LOG_BADGE("Tx") << LOG_DESC("Invalid transactions RLP recieved")
+                          << LOG_KV("reason", e.what())
+                          << LOG_KV("peer", _txsShard->fromPeer.abridged());
+        return nullptr;
+    }
+    return txs;
+}
+
 void DownloadingTxsQueue::pop2TxPool(
     std::shared_ptr<dev::txpool::TxPoolInterface> _txPool, dev::eth::CheckTransaction _checkSig)
 {
@@ -103,88 +138,122 @@ void DownloadingTxsQueue::pop2TxPool(
     int64_t verifySig_time_cost = 0;
     int64_t import_time_cost = 0;
     size_t successCnt = 0;
-    for (size_t i = 0; i < localBuffer->size(); ++i)
+    size_t duplicatedCnt = 0;
+
+    // decode the shards concurrently
+    record_time = utcTime();
+    std::vector<std::shared_ptr<dev::eth::Transactions>> shardTxs(localBuffer->size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, localBuffer->size()),
+        [&](const tbb::blocked_range<size_t>& _r) {
+            for (size_t i = _r.begin(); i != _r.end(); ++i)
+            {
+                shardTxs[i] = decodeShard((*localBuffer)[i], _checkSig);
+            }
+        });
+    decode_time_cost = utcTime() - record_time;
+
+    // drop the txs already in the txPool or in the former shards before recovering the senders,
+    // the peers sent the duplicated txs are recorded as known nodes of the retained txs
+    record_time = utcTime();
+    std::unordered_map<dev::h256, dev::eth::Transaction::Ptr> batchTxs;
+    std::vector<std::pair<dev::eth::Transaction::Ptr, size_t>> duplicatedTxs;
+    auto pendingTxs = std::make_shared<dev::eth::Transactions>();
+    std::vector<std::shared_ptr<dev::eth::Transactions>> importTxs(localBuffer->size());
+    for (size_t i = 0; i < shardTxs.size(); ++i)
     {
-        record_time = utcTime();
-        // decode
-        auto txs = std::make_shared<dev::eth::Transactions>();
-        std::shared_ptr<DownloadTxsShard> txsShard = (*localBuffer)[i];
-        // TODO drop by Txs Shard
-        if (g_BCOSConfig.version() >= RC2_VERSION)
+        importTxs[i] = std::make_shared<dev::eth::Transactions>();
+        if (!shardTxs[i])
         {
-            RLP const& txsBytesRLP = RLP(ref(txsShard->txsBytes))[0];
-            dev::eth::TxsParallelParser::decode(
-                txs, txsBytesRLP.toBytesConstRef(), _checkSig, true);
+            continue;
         }
-        else
+        for (auto const& tx : *shardTxs[i])
         {
-            RLP const& txsBytesRLP = RLP(ref(txsShard->txsBytes));
-            unsigned txNum = txsBytesRLP.itemCount();
-            txs->resize(txNum);
-            for (unsigned j = 0; j < txNum; j++)
+            auto txHash = tx->sha3();
+            auto it = batchTxs.find(txHash);
+            if (it != batchTxs.end())
             {
-                (*txs)[j] = std::make_shared<dev::eth::Transaction>();
-                (*txs)[j]->decode(txsBytesRLP[j]);
+                duplicatedTxs.emplace_back(it->second, i);
+                duplicatedCnt++;
+                continue;
             }
+            if (_txPool->txExists(txHash))
+            {
+                duplicatedCnt++;
+                continue;
+            }
+            batchTxs[txHash] = tx;
+            importTxs[i]->push_back(tx);
+            pendingTxs->push_back(tx);
         }
-        decode_time_cost += (utcTime() - record_time);
-        record_time = utcTime();
+    }
 
-        // parallel verify transaction before import
-        tbb::parallel_for(
-            tbb::blocked_range<size_t>(0, txs->size()), [&](const tbb::blocked_range<size_t>& _r) {
-                for (size_t j = _r.begin(); j != _r.end(); ++j)
+    // recover the senders of all the shards in bulk
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, pendingTxs->size()),
+        [&](const tbb::blocked_range<size_t>& _r) {
+            for (size_t i = _r.begin(); i != _r.end(); ++i)
+            {
+                try
                 {
-                    if (!_txPool->txExists((*txs)[j]->sha3()))
-                        (*txs)[j]->sender();
+                    (*pendingTxs)[i]->sender();
                 }
-            });
-        verifySig_time_cost += (utcTime() - record_time);
+                catch (std::exception const&)
+                {
+                    // the invalid signature is reported by the txPool
+                }
+            }
+        });
+    verifySig_time_cost = utcTime() - record_time;
 
-        // import into tx pool
-        record_time = utcTime();
+    // import into tx pool, one batch per shard
+    record_time = utcTime();
+    for (size_t i = 0; i < importTxs.size(); ++i)
+    {
+        auto const& txs = *importTxs[i];
+        if (txs.size() == 0)
+        {
+            continue;
+        }
+        std::shared_ptr<DownloadTxsShard> txsShard = (*localBuffer)[i];
         NodeID fromPeer = txsShard->fromPeer;
-        for (auto tx : *txs)
+        auto importResults = _txPool->batchImport(txs);
+        for (size_t j = 0; j < txs.size(); ++j)
         {
-            try
+            auto const& tx = txs[j];
+            auto importResult = importResults[j];
+            if (dev::eth::ImportResult::Success == importResult)
             {
-                auto importResult = _txPool->import(tx);
-                if (dev::eth::ImportResult::Success == importResult)
-                {
-                    tx->appendNodeContainsTransaction(fromPeer);
-                    tx->appendNodeListContainTransaction(*(txsShard->knownNodes));
-                    successCnt++;
-                }
-                else if (dev::eth::ImportResult::AlreadyKnown == importResult)
-                {
-                    SYNC_LOG(TRACE)
-                        << LOG_BADGE("Tx")
-                        << LOG_DESC("Import peer transaction into txPool DUPLICATED from peer")
-                        << LOG_KV("reason", int(importResult))
-                        << LOG_KV("peer", fromPeer.abridged())
-                        << LOG_KV("txHash", tx->sha3().abridged());
-                }
-                else
-                {
-                    SYNC_LOG(TRACE)
-                        << LOG_BADGE("Tx")
-                        << LOG_DESC("Import peer transaction into txPool FAILED from peer")
-                        << LOG_KV("reason", int(importResult))
-                        << LOG_KV("peer", fromPeer.abridged())
-                        << LOG_KV("txHash", tx->sha3().abridged());
-                }
+                tx->appendNodeContainsTransaction(fromPeer);
+                tx->appendNodeListContainTransaction(*(txsShard->knownNodes));
+                successCnt++;
             }
-            catch (std::exception& e)
+            else if (dev::eth::ImportResult::AlreadyKnown == importResult)
             {
-                SYNC_LOG(WARNING) << LOG_BADGE("Tx") << LOG_DESC("Invalid transaction RLP recieved")
-                                  << LOG_KV("reason", e.what()) << LOG_KV("rlp", toHex(tx->rlp()));
-                continue;
+                SYNC_LOG(TRACE) << LOG_BADGE("Tx")
+                                << LOG_DESC(
+                                       "Import peer transaction into txPool DUPLICATED from peer")
+                                << LOG_KV("reason", int(importResult))
+                                << LOG_KV("peer", fromPeer.abridged())
+                                << LOG_KV("txHash", tx->sha3().abridged());
+            }
+            else
+            {
+                SYNC_LOG(TRACE) << LOG_BADGE("Tx")
+                                << LOG_DESC("Import peer transaction into txPool FAILED from peer")
+                                << LOG_KV("reason", int(importResult))
+                                << LOG_KV("peer", fromPeer.abridged())
+                                << LOG_KV("txHash", tx->sha3().abridged());
             }
         }
-        import_time_cost += (utcTime() - record_time);
     }
+    for (auto const& duplicated : duplicatedTxs)
+    {
+        auto txsShard = (*localBuffer)[duplicated.second];
+        duplicated.first->appendNodeContainsTransaction(txsShard->fromPeer);
+        duplicated.first->appendNodeListContainTransaction(*(txsShard->knownNodes));
+    }
+    import_time_cost = utcTime() - record_time;
     SYNC_LOG(TRACE) << LOG_BADGE("Tx") << LOG_DESC("Import peer transactions")
-                    << LOG_KV("import", successCnt)
+                    << LOG_KV("import", successCnt) << LOG_KV("duplicated", duplicatedCnt)
                     << LOG_KV("moveBufferTimeCost", moveBuffer_time_cost)
                     << LOG_KV("newBufferTimeCost", newBuffer_time_cost)
                     << LOG_KV("isBufferFullTimeCost", isBufferFull_time_cost)
@@ -91,6 +91,9 @@ public:
     }
 
 private:
+    std::shared_ptr<dev::eth::Transactions> decodeShard(
+        std::shared_ptr<DownloadTxsShard> _txsShard, dev::eth::CheckTransaction _checkSig);
+
     NodeID m_nodeId;
     std::shared_ptr<std::vector<std::shared_ptr<DownloadTxsShard>>> m_buffer;
     mutable SharedMutex x_buffer;
@@ -408,7 +408,7 @@ void SyncMaster::maintainPeersStatus()
             thisTurnFound = true;
             SyncReqBlockPacket packet;
             unsigned size = to - from + 1;
-            packet.encode(from, size);
+            packet.encode(from, size, m_blockChunkSize);
             m_service->asyncSendMessageByNodeID(
                 _p->nodeId, packet.toMessage(m_protocolId), CallbackFuncWithSession(), Options());
 
@@ -674,9 +674,17 @@ void SyncMaster::maintainBlockRequest()
     uint64_t timeout = utcSteadyTime() + c_respondDownloadRequestTimeout;
     m_syncStatus->foreachPeerRandom([&](std::shared_ptr<SyncPeerStatus> _p) {
         DownloadRequestQueue& reqQueue = _p->reqQueue;
-        if (reqQueue.empty())
+        if (reqQueue.empty() && !_p->uploadingBlock)
             return true;  // no need to respond
 
+        if (_p->blockChunkSize > 0)
+        {
+            maintainBlockStream(_p, timeout);
+            return false;
+        }
+        // the peer requests the blocks in batch again
+        _p->uploadingBlock = nullptr;
+
         // Just select one peer per maintain
         DownloadBlocksContainer blockContainer(m_service, m_protocolId, _p->nodeId);
 
@@ -703,21 +711,8 @@ void SyncMaster::maintainBlockRequest()
                         << LOG_KV("nodeId", _p->nodeId.abridged());
                     break;
                 }
-                auto requiredPermits = blockRLP->size() / g_BCOSConfig.c_compressRate;
-                if (m_nodeBandwidthLimiter && !m_nodeBandwidthLimiter->tryAcquire(requiredPermits))
-                {
-                    SYNC_LOG(INFO)
-                        << LOG_BADGE("maintainBlockRequest")
-                        << LOG_DESC("stop responding block for over the channel bandwidth limit")
-                        << LOG_KV("peer", _p->nodeId.abridged());
-                    break;
-                }
-                // over the network-bandwidth-limiter
-                if (m_bandwidthLimiter && !m_bandwidthLimiter->tryAcquire(requiredPermits))
+                if (!acquireUploadPermits(_p, blockRLP->size()))
                 {
-                    SYNC_LOG(INFO) << LOG_BADGE("maintainBlockRequest")
-                                   << LOG_DESC("stop responding block for over the bandwidth limit")
-                                   << LOG_KV("peer", _p->nodeId.abridged());
                     break;
                 }
                 SYNC_LOG(INFO) << LOG_BADGE("Download") << LOG_BADGE("Request")
@@ -743,6 +738,120 @@ void SyncMaster::maintainBlockRequest()
     });
 }
 
+void SyncMaster::maintainBlockStream(std::shared_ptr<SyncPeerStatus> _p, uint64_t _timeout)
+{
+    size_t blockChunkSize = _p->blockChunkSize;
+    while (utcSteadyTime() <= _timeout)
+    {
+        if (!_p->uploadingBlock)
+        {
+            if (_p->reqQueue.empty())
+            {
+                return;
+            }
+            DownloadRequest req = _p->reqQueue.topAndPop();
+            if (req.size <= 0)
+            {
+                return;
+            }
+            // read the encoded block from the storage without decoding it
+            auto blockRLP = m_blockChain->getBlockRLPByNumber(req.fromNumber);
+            if (!blockRLP)
+            {
+                SYNC_LOG(WARNING) << LOG_BADGE("Download") << LOG_BADGE("Request")
+                                  << LOG_DESC("Get block for node failed")
+                                  << LOG_KV("reason", "block is null")
+                                  << LOG_KV("number", req.fromNumber)
+                                  << LOG_KV("nodeId", _p->nodeId.abridged());
+                _p->reqQueue.push(req.fromNumber, req.size);
+                return;
+            }
+            if (req.size > 1)
+            {
+                _p->reqQueue.push(req.fromNumber + 1, req.size - 1);
+            }
+            _p->uploadingBlock = std::make_shared<UploadingBlock>(req.fromNumber, blockRLP);
+        }
+
+        auto& block = *_p->uploadingBlock;
+        auto blockSize = block.blockRLP->size();
+        auto chunkSize = std::min(blockChunkSize, blockSize - block.offset);
+        // the rest of the block is sent when the budget is refilled
+        if (!acquireUploadPermits(_p, chunkSize))
+        {
+            return;
+        }
+        SyncBlockChunksPacket packet;
+        packet.encode(block.number, blockSize, block.offset,
+            bytesConstRef(block.blockRLP->data() + block.offset, chunkSize));
+        auto msg = packet.toMessage(m_protocolId);
+        msg->setPermitsAcquired(true);
+        m_service->asyncSendMessageByNodeID(_p->nodeId, msg, CallbackFuncWithSession(), Options());
+        block.offset += chunkSize;
+        if (block.offset == blockSize)
+        {
+            SYNC_LOG(DEBUG) << LOG_BADGE("Download") << LOG_BADGE("Request")
+                            << LOG_BADGE("BlockSync") << LOG_DESC("Stream block")
+                            << LOG_KV("number", block.number) << LOG_KV("blockSize", blockSize)
+                            << LOG_KV("chunkSize", blockChunkSize)
+                            << LOG_KV("peer", _p->nodeId.abridged());
+            _p->uploadingBlock = nullptr;
+        }
+    }
+}
+
+bool SyncMaster::acquireUploadPermits(std::shared_ptr<SyncPeerStatus> _p, size_t _size)
+{
+    auto requiredPermits = _size / g_BCOSConfig.c_compressRate;
+    // check the upload budget of the peer first, the peer over its budget should not consume the
+    // permits of the node and the group shared by all the peers
+    if (m_peerUploadBandwidthLimit > 0)
+    {
+        if (!_p->uploadLimiter)
+        {
+            _p->uploadLimiter =
+                std::make_shared<dev::flowlimit::RateLimiter>(m_peerUploadBandwidthLimit);
+            _p->uploadLimiter->setMaxPermitsSize(g_BCOSConfig.c_maxPermitsSize);
+        }
+        if (!_p->uploadLimiter->tryAcquire(requiredPermits))
+        {
+            SYNC_LOG(INFO) << LOG_BADGE("maintainBlockRequest")
+                           << LOG_DESC("stop responding block for over the peer upload budget")
+                           << LOG_KV("peer", _p->nodeId.abridged());
+            return false;
+        }
+    }
+    // the block is not responded, give back the permits acquired from the limiters before
+    auto releaseUploadPermits = [&]() {
+        if (m_peerUploadBandwidthLimit > 0 && _p->uploadLimiter)
+        {
+            _p->uploadLimiter->releasePermits(requiredPermits);
+        }
+    };
+    if (m_nodeBandwidthLimiter && !m_nodeBandwidthLimiter->tryAcquire(requiredPermits))
+    {
+        SYNC_LOG(INFO) << LOG_BADGE("maintainBlockRequest")
+                       << LOG_DESC("stop responding block for over the channel bandwidth limit")
+                       << LOG_KV("peer", _p->nodeId.abridged());
+        releaseUploadPermits();
+        return false;
+    }
+    // over the network-bandwidth-limiter
+    if (m_bandwidthLimiter && !m_bandwidthLimiter->tryAcquire(requiredPermits))
+    {
+        SYNC_LOG(INFO) << LOG_BADGE("maintainBlockRequest")
+                       << LOG_DESC("stop responding block for over the bandwidth limit")
+                       << LOG_KV("peer", _p->nodeId.abridged());
+        releaseUploadPermits();
+        if (m_nodeBandwidthLimiter)
+        {
+            m_nodeBandwidthLimiter->releasePermits(requiredPermits);
+        }
+        return false;
+    }
+    return true;
+}
+
 bool SyncMaster::isNextBlock(BlockPtr _block)
 {
     if (_block == nullptr)
@@ -80,10 +80,8 @@ public:
         setName(threadName);
         // signal registration
         m_blockSubmitted = m_blockChain->onReady([&](int64_t) { this->noteNewBlocks(); });
-        m_downloadBlockProcessor =
-            std::make_shared<dev::ThreadPool>("Download-" + std::to_string(m_groupId), 1);
-        m_sendBlockProcessor =
-            std::make_shared<dev::ThreadPool>("SyncSend-" + std::to_string(m_groupId), 1);
+        m_downloadBlockProcessor = dev::createSerialWorker("Download-" + std::to_string(m_groupId));
+        m_sendBlockProcessor = dev::createSerialWorker("SyncSend-" + std::to_string(m_groupId));
 
         // syncStatus should be initialized firstly since it should be deconstruct at final
         m_syncStatus =
@@ -132,6 +130,23 @@ public:
         m_syncTrans->setTxsStatusGossipMaxPeers(_txsStatusGossipMaxPeers);
     }
 
+    virtual void setTxsReconcileInterval(int64_t const& _txsReconcileInterval)
+    {
+        m_syncTrans->setTxsReconcileInterval(_txsReconcileInterval);
+    }
+
+    // request the peers to stream the blocks in chunks of _blockChunkSize, 0 means disabled
+    virtual void setBlockChunkSize(unsigned const& _blockChunkSize)
+    {
+        m_blockChunkSize = _blockChunkSize;
+    }
+
+    // the upload bandwidth budget(bytes/s) of responding blocks to every peer, 0 means unlimited
+    virtual void setPeerUploadBandwidthLimit(int64_t const& _peerUploadBandwidthLimit)
+    {
+        m_peerUploadBandwidthLimit = _peerUploadBandwidthLimit;
+    }
+
     void setSyncMsgPacketFactory(SyncMsgPacketFactory::Ptr _syncMsgPacketFactory)
     {
         m_syncMsgPacketFactory = _syncMsgPacketFactory;
@@ -347,6 +362,9 @@ private:
     dev::flowlimit::RateLimiter::Ptr m_nodeBandwidthLimiter;
     NodeTimeMaintenance::Ptr m_nodeTimeMaintenance;
 
+    unsigned m_blockChunkSize = 0;
+    int64_t m_peerUploadBandwidthLimit = 0;
+
 public:
     void maintainBlocks();
     void maintainPeersStatus();
@@ -354,6 +372,10 @@ public:
     void maintainDownloadingQueueBuffer();
     void maintainPeersConnection();
     void maintainBlockRequest();
+    // stream the requested blocks to the peer in chunks until the budget or _timeout runs out
+    void maintainBlockStream(std::shared_ptr<SyncPeerStatus> _p, uint64_t _timeout);
+    // acquire the permits of all the bandwidth limiters for sending _size bytes to the peer
+    bool acquireUploadPermits(std::shared_ptr<SyncPeerStatus> _p, size_t _size);
 
 private:
     bool isNextBlock(BlockPtr _block);
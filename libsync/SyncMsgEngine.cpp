@@ -124,6 +124,9 @@ bool SyncMsgEngine::interpret(
         case ReqBlocskPacket:
             onPeerRequestBlocks(*_packet);
             break;
+        case BlockChunksPacket:
+            onPeerBlockChunks(*_packet);
+            break;
         // receive transaction hash, _msg is only used to ensure the life-time for rlps of _packet
         case TxsStatusPacket:
             m_txsWorker->enqueue([self, _packet, _peer, _msg]() {
@@ -144,6 +147,26 @@ bool SyncMsgEngine::interpret(
                 }
             });
             break;
+        // receive the sketch of the peer's pending txs
+        case TxsSketchPacket:
+            m_txsWorker->enqueue([self, _packet, _peer, _msg]() {
+                auto msgEngine = self.lock();
+                if (msgEngine)
+                {
+                    msgEngine->onPeerTxsSketch(_packet, _peer, _msg);
+                }
+            });
+            break;
+        // receive the response of the sketch sent by this node
+        case TxsReconcileReqPacket:
+            m_txsSender->enqueue([self, _packet, _peer, _msg]() {
+                auto msgEngine = self.lock();
+                if (msgEngine)
+                {
+                    msgEngine->onPeerTxsReconcileRequest(_packet, _peer, _msg);
+                }
+            });
+            break;
         default:
             return false;
         }
@@ -286,7 +309,8 @@ void SyncMsgEngine::onPeerRequestBlocks(SyncMsgPacket const& _packet)
 
     RLP const& rlp = _packet.rlp();
 
-    if (rlp.itemCount() != 2)
+    // the third item is the chunk size if the requester asks for streaming the blocks
+    if (rlp.itemCount() != 2 && rlp.itemCount() != 3)
     {
         SYNC_ENGINE_LOG(WARNING) << LOG_BADGE("Download") << LOG_BADGE("Request")
                                  << LOG_DESC("Receive invalid request blocks packet format")
@@ -297,15 +321,22 @@ void SyncMsgEngine::onPeerRequestBlocks(SyncMsgPacket const& _packet)
     // request
     int64_t from = rlp[0].toInt<int64_t>();
     unsigned size = rlp[1].toInt<unsigned>();
+    unsigned blockChunkSize = 0;
+    if (rlp.itemCount() == 3)
+    {
+        blockChunkSize = std::min(std::max((size_t)rlp[2].toInt<unsigned>(), c_minBlockChunkSize),
+            c_maxBlockChunkSize);
+    }
 
     SYNC_ENGINE_LOG(INFO) << LOG_BADGE("Download") << LOG_BADGE("Request")
                           << LOG_DESC("Receive block request")
                           << LOG_KV("peer", _packet.nodeId.abridged()) << LOG_KV("from", from)
-                          << LOG_KV("to", from + size - 1);
+                          << LOG_KV("to", from + size - 1) << LOG_KV("chunkSize", blockChunkSize);
 
     auto peerStatus = m_syncStatus->peerStatus(_packet.nodeId);
     if (peerStatus != nullptr && peerStatus)
     {
+        peerStatus->blockChunkSize = blockChunkSize;
         peerStatus->reqQueue.push(from, (int64_t)size);
         // notify sync master to handle block requests
         if (m_onNotifyWorker)
@@ -315,6 +346,50 @@ void SyncMsgEngine::onPeerRequestBlocks(SyncMsgPacket const& _packet)
     }
 }
 
+void SyncMsgEngine::onPeerBlockChunks(SyncMsgPacket const& _packet)
+{
+    RLP const& rlp = _packet.rlp();
+    if (rlp.itemCount() != 4)
+    {
+        SYNC_ENGINE_LOG(WARNING) << LOG_BADGE("Download") << LOG_BADGE("BlockSync")
+                                 << LOG_DESC("Receive invalid block chunks packet format")
+                                 << LOG_KV("peer", _packet.nodeId.abridged());
+        return;
+    }
+    auto number = rlp[0].toInt<int64_t>();
+    auto blockSize = rlp[1].toInt<size_t>();
+    auto offset = rlp[2].toInt<size_t>();
+    auto chunk = rlp[3].toBytesConstRef();
+
+    m_blockChunksAssembler.setMaxBlockSize(m_syncStatus->bq().maxBlockQueueSize());
+    bytes blocks;
+    auto result = m_blockChunksAssembler.push(
+        _packet.nodeId, number, blockSize, offset, chunk, blocks);
+    if (result == BlockChunksAssembler::Result::Pending)
+    {
+        return;
+    }
+    if (result == BlockChunksAssembler::Result::Dropped)
+    {
+        SYNC_ENGINE_LOG(DEBUG) << LOG_BADGE("Download") << LOG_BADGE("BlockSync")
+                               << LOG_DESC("Drop the streamed block")
+                               << LOG_KV("peer", _packet.nodeId.abridged())
+                               << LOG_KV("number", number) << LOG_KV("blockSize", blockSize)
+                               << LOG_KV("offset", offset);
+        return;
+    }
+    SYNC_ENGINE_LOG(DEBUG) << LOG_BADGE("Download") << LOG_BADGE("BlockSync")
+                           << LOG_DESC("Receive streamed block")
+                           << LOG_KV("peer", _packet.nodeId.abridged()) << LOG_KV("number", number)
+                           << LOG_KV("blockSize", blockSize);
+    m_syncStatus->bq().push(std::move(blocks));
+    // notify sync master to solve DownloadingQueue
+    if (m_onNotifyWorker)
+    {
+        m_onNotifyWorker();
+    }
+}
+
 void DownloadBlocksContainer::batchAndSend(BlockPtr _block)
 {
     // TODO: thread safe
@@ -384,6 +459,20 @@ void SyncMsgEngine::onPeerTxsStatus(
     try
     {
         RLP const& rlps = _packet->rlp();
+        m_relayStatistics->statusPackets++;
+        m_relayStatistics->statusBytes += rlps.data().size();
+        auto reason = TxsStatusReason::Gossip;
+        if (rlps.itemCount() > 2)
+        {
+            reason = (TxsStatusReason)rlps[2].toInt<unsigned>();
+        }
+        // the peer fell back to the txs status instead of answering the sketch of this node,
+        // send all the pending txs status back so that the peer can fetch the missed txs
+        if (reason != TxsStatusReason::Gossip &&
+            finishReconcile(_peer, reason == TxsStatusReason::SketchDecodeFailed))
+        {
+            sendTxsStatus(reconcileTxs(), _peer);
+        }
         std::set<dev::h256> txsHash = rlps[1].toSet<dev::h256>();
         // pop all downloaded txs into the txPool
         while (m_txQueue->bufferSize() > 0)
@@ -426,30 +515,260 @@ void SyncMsgEngine::onReceiveTxsRequest(
         RLP const& rlps = _txsReqPacket->rlp();
         std::vector<dev::h256> reqTxs = rlps[0].toVector<dev::h256>();
         auto txs = m_txPool->obtainTransactions(reqTxs);
-        if (0 == txs->size())
+        sendTxs(txs, _peer);
+    }
+    catch (std::exception const& _e)
+    {
+        SYNC_ENGINE_LOG(WARNING) << LOG_BADGE("Rcv") << LOG_BADGE("Packet")
+                                 << LOG_DESC("invalid txs request packet")
+                                 << LOG_KV("peer", _peer.abridged())
+                                 << LOG_KV("reason", boost::diagnostic_information(_e));
+    }
+}
+
+void SyncMsgEngine::sendTxs(std::shared_ptr<dev::eth::Transactions> _txs, dev::h512 const& _peer)
+{
+    if (0 == _txs->size())
+    {
+        return;
+    }
+    std::shared_ptr<std::vector<bytes>> txRLPs = std::make_shared<std::vector<bytes>>();
+    for (auto tx : *_txs)
+    {
+        txRLPs->emplace_back(tx->rlp(WithSignature));
+        tx->appendNodeContainsTransaction(_peer);
+    }
+    std::shared_ptr<SyncTransactionsPacket> txsPacket = std::make_shared<SyncTransactionsPacket>();
+    txsPacket->encode(*txRLPs);
+    auto p2pMsg = txsPacket->toMessage(m_protocolId);
+    m_service->asyncSendMessageByNodeID(_peer, p2pMsg, CallbackFuncWithSession(), Options());
+    m_relayStatistics->sentTxs += txRLPs->size();
+    m_relayStatistics->sentTxsBytes += p2pMsg->length();
+    SYNC_ENGINE_LOG(DEBUG) << LOG_BADGE("Send") << LOG_BADGE("sendTxs")
+                           << LOG_KV("sendedTxsSize", txRLPs->size())
+                           << LOG_KV("messageSize", p2pMsg->length())
+                           << LOG_KV("peer", _peer.abridged());
+}
+
+void SyncMsgEngine::sendTxsStatus(
+    std::shared_ptr<dev::eth::Transactions> _txs, dev::h512 const& _peer, TxsStatusReason _reason)
+{
+    // the answer of the sketch is sent even if empty to finish the round on the peer
+    if (0 == _txs->size() && _reason == TxsStatusReason::Gossip)
+    {
+        return;
+    }
+    auto txsHash = std::make_shared<std::set<dev::h256>>();
+    for (auto const& tx : *_txs)
+    {
+        txsHash->insert(tx->sha3());
+    }
+    std::shared_ptr<SyncTxsStatusPacket> txsStatusPacket = std::make_shared<SyncTxsStatusPacket>();
+    txsStatusPacket->encode(m_blockChain->number(), txsHash, _reason);
+    auto p2pMsg = txsStatusPacket->toMessage(m_protocolId);
+    m_service->asyncSendMessageByNodeID(_peer, p2pMsg, CallbackFuncWithSession(), Options());
+    SYNC_ENGINE_LOG(DEBUG) << LOG_BADGE("Send") << LOG_DESC("send txs status to peer")
+                           << LOG_KV("txNum", txsHash->size()) << LOG_KV("reason", (int)_reason)
+                           << LOG_KV("peer", _peer.abridged())
+                           << LOG_KV("messageSize(B)", p2pMsg->length());
+}
+
+std::shared_ptr<dev::eth::Transactions> SyncMsgEngine::reconcileTxs()
+{
+    // pop all downloaded txs into the txPool
+    while (m_txQueue->bufferSize() > 0)
+    {
+        m_txQueue->pop2TxPool(m_txPool);
+    }
+    return m_txPool->pendingList();
+}
+
+bool SyncMsgEngine::finishReconcile(dev::h512 const& _peer, bool _failed)
+{
+    Guard l(x_reconcileStates);
+    auto it = m_reconcileStates.find(_peer);
+    if (it == m_reconcileStates.end() || !it->second.pending)
+    {
+        return false;
+    }
+    it->second.pending = false;
+    if (_failed)
+    {
+        it->second.cellCount = std::min(it->second.cellCount * 2, c_maxSketchCells);
+        m_relayStatistics->reconcileFailures++;
+    }
+    return true;
+}
+
+void SyncMsgEngine::sendTxsSketch(dev::h512 const& _peer)
+{
+    size_t cellCount = c_minSketchCells;
+    {
+        Guard l(x_reconcileStates);
+        auto& state = m_reconcileStates[_peer];
+        // the last round with the peer has not finished yet
+        if (state.pending && std::chrono::steady_clock::now() - state.sentTime <
+                                 std::chrono::milliseconds(c_reconcileTimeout))
         {
             return;
         }
-        std::shared_ptr<std::vector<bytes>> txRLPs = std::make_shared<std::vector<bytes>>();
-        for (auto tx : *txs)
+        state.pending = true;
+        state.sentTime = std::chrono::steady_clock::now();
+        cellCount = state.cellCount;
+    }
+    auto txs = reconcileTxs();
+    // the difference of the large txpools is too large to be decoded from the sketch of at most
+    // c_maxSketchCells cells, send the hashes of all the pending txs instead
+    if (txs->size() > c_maxReconcileTxs)
+    {
+        {
+            Guard l(x_reconcileStates);
+            m_reconcileStates[_peer].pending = false;
+        }
+        m_relayStatistics->reconcileFallbacks++;
+        SYNC_ENGINE_LOG(INFO) << LOG_BADGE("Reconcile")
+                              << LOG_DESC("too many txs, fall back to the txs status")
+                              << LOG_KV("txsNum", txs->size())
+                              << LOG_KV("maxReconcileTxs", c_maxReconcileTxs)
+                              << LOG_KV("peer", _peer.abridged());
+        sendTxsStatus(txs, _peer);
+        return;
+    }
+    auto sketch = createTxsSketch(*txs, cellCount);
+    auto sketchPacket = std::make_shared<SyncTxsSketchPacket>();
+    sketchPacket->encode(m_blockChain->number(), txs->size(), *sketch);
+    auto p2pMsg = sketchPacket->toMessage(m_protocolId);
+    m_service->asyncSendMessageByNodeID(_peer, p2pMsg, CallbackFuncWithSession(), Options());
+    m_relayStatistics->reconcileRounds++;
+    m_relayStatistics->sketchBytes += p2pMsg->length();
+    SYNC_ENGINE_LOG(DEBUG) << LOG_BADGE("Reconcile") << LOG_DESC("send txs sketch")
+                           << LOG_KV("txsNum", txs->size())
+                           << LOG_KV("cells", sketch->cellCount())
+                           << LOG_KV("messageSize(B)", p2pMsg->length())
+                           << LOG_KV("peer", _peer.abridged());
+}
+
+// the last param (_msg) is necessary to ensure the life-time of _packet->rlp()
+void SyncMsgEngine::onPeerTxsSketch(
+    std::shared_ptr<SyncMsgPacket> _packet, dev::h512 const& _peer, dev::p2p::P2PMessage::Ptr)
+{
+    try
+    {
+        RLP const& rlps = _packet->rlp();
+        auto peerTxsNum = rlps[1].toInt<uint64_t>();
+        auto remoteSketch = TxsSketch::decodeFrom(rlps[2]);
+
+        auto txs = reconcileTxs();
+        if (txs->size() > c_maxReconcileTxs)
         {
-            txRLPs->emplace_back(tx->rlp(WithSignature));
-            tx->appendNodeContainsTransaction(_peer);
+            // the peer will send its txs status back without counting a failure
+            m_relayStatistics->reconcileFallbacks++;
+            SYNC_ENGINE_LOG(INFO) << LOG_BADGE("Reconcile")
+                                  << LOG_DESC("too many txs, fall back to the txs status")
+                                  << LOG_KV("txsNum", txs->size())
+                                  << LOG_KV("peerTxsNum", peerTxsNum)
+                                  << LOG_KV("maxReconcileTxs", c_maxReconcileTxs)
+                                  << LOG_KV("peer", _peer.abridged());
+            sendTxsStatus(txs, _peer, TxsStatusReason::TooManyTxs);
+            return;
         }
-        std::shared_ptr<SyncTransactionsPacket> txsPacket =
-            std::make_shared<SyncTransactionsPacket>();
-        txsPacket->encode(*txRLPs);
-        auto p2pMsg = txsPacket->toMessage(m_protocolId);
+        auto sketch = createTxsSketch(*txs, remoteSketch->cellCount());
+        sketch->subtract(*remoteSketch);
+        std::set<uint64_t> onlyLocal;
+        std::set<uint64_t> onlyRemote;
+        if (!sketch->decode(onlyLocal, onlyRemote))
+        {
+            // fall back to the txs status, the peer will send its txs status back
+            SYNC_ENGINE_LOG(DEBUG) << LOG_BADGE("Reconcile") << LOG_DESC("decode sketch failed")
+                                   << LOG_KV("cells", remoteSketch->cellCount())
+                                   << LOG_KV("txsNum", txs->size())
+                                   << LOG_KV("peerTxsNum", peerTxsNum)
+                                   << LOG_KV("peer", _peer.abridged());
+            sendTxsStatus(txs, _peer, TxsStatusReason::SketchDecodeFailed);
+            return;
+        }
+        // push the txs missed by the peer
+        auto missedTxs = std::make_shared<dev::eth::Transactions>();
+        for (auto const& tx : *txs)
+        {
+            if (onlyLocal.count(txShortId(tx->sha3())))
+            {
+                missedTxs->push_back(tx);
+            }
+        }
+        sendTxs(missedTxs, _peer);
+        // request the txs this node missed, the response is sent even if nothing is missed to
+        // finish the round on the peer
+        auto reqPacket = std::make_shared<SyncTxsReconcileReqPacket>();
+        reqPacket->encode(onlyLocal.size() + onlyRemote.size(), onlyRemote);
+        auto p2pMsg = reqPacket->toMessage(m_protocolId);
         m_service->asyncSendMessageByNodeID(_peer, p2pMsg, CallbackFuncWithSession(), Options());
-        SYNC_ENGINE_LOG(DEBUG) << LOG_BADGE("Rcv") << LOG_BADGE("onReceiveTxsRequest")
-                               << LOG_KV("sendedTxsSize", txRLPs->size())
-                               << LOG_KV("messageSize", p2pMsg->length())
+        m_relayStatistics->reconcileRequestBytes += p2pMsg->length();
+        SYNC_ENGINE_LOG(DEBUG) << LOG_BADGE("Reconcile") << LOG_DESC("onPeerTxsSketch")
+                               << LOG_KV("txsNum", txs->size())
+                               << LOG_KV("peerTxsNum", peerTxsNum)
+                               << LOG_KV("pushTxs", missedTxs->size())
+                               << LOG_KV("reqTxs", onlyRemote.size())
                                << LOG_KV("peer", _peer.abridged());
     }
     catch (std::exception const& _e)
     {
         SYNC_ENGINE_LOG(WARNING) << LOG_BADGE("Rcv") << LOG_BADGE("Packet")
-                                 << LOG_DESC("invalid txs request packet")
+                                 << LOG_DESC("invalid txs sketch")
+                                 << LOG_KV("peer", _peer.abridged())
+                                 << LOG_KV("reason", boost::diagnostic_information(_e));
+    }
+}
+
+// the last param (_msg) is necessary to ensure the life-time of _packet->rlp()
+void SyncMsgEngine::onPeerTxsReconcileRequest(
+    std::shared_ptr<SyncMsgPacket> _packet, dev::h512 const& _peer, dev::p2p::P2PMessage::Ptr)
+{
+    try
+    {
+        RLP const& rlps = _packet->rlp();
+        auto diffSize = rlps[0].toInt<uint64_t>();
+        auto shortIds = rlps[1].toSet<uint64_t>();
+        {
+            Guard l(x_reconcileStates);
+            auto it = m_reconcileStates.find(_peer);
+            if (it == m_reconcileStates.end() || !it->second.pending)
+            {
+                SYNC_ENGINE_LOG(DEBUG)
+                    << LOG_BADGE("Reconcile") << LOG_DESC("drop unexpected reconcile request")
+                    << LOG_KV("peer", _peer.abridged());
+                return;
+            }
+            auto& state = it->second;
+            state.pending = false;
+            // the size of the next sketch follows the size of the difference
+            state.cellCount =
+                std::min(c_maxSketchCells, (size_t)(c_minSketchCells + 2 * diffSize));
+            m_relayStatistics->reconcileLatencyMs +=
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - state.sentTime)
+                    .count();
+        }
+        m_relayStatistics->reconcileDiffTxs += diffSize;
+        if (shortIds.empty())
+        {
+            return;
+        }
+        auto txs = m_txPool->pendingList();
+        auto reqTxs = std::make_shared<dev::eth::Transactions>();
+        for (auto const& tx : *txs)
+        {
+            if (shortIds.count(txShortId(tx->sha3())))
+            {
+                reqTxs->push_back(tx);
+            }
+        }
+        sendTxs(reqTxs, _peer);
+    }
+    catch (std::exception const& _e)
+    {
+        SYNC_ENGINE_LOG(WARNING) << LOG_BADGE("Rcv") << LOG_BADGE("Packet")
+                                 << LOG_DESC("invalid txs reconcile request")
                                  << LOG_KV("peer", _peer.abridged())
                                  << LOG_KV("reason", boost::diagnostic_information(_e));
     }
@@ -21,6 +21,7 @@
  */
 
 #pragma once
+#include "BlockChunks.h"
 #include "Common.h"
 #include "DownloadingTxsQueue.h"
 #include "NodeTimeMaintenance.h"
@@ -30,6 +31,7 @@
 #include "SyncStatus.h"
 #include <libblockchain/BlockChainInterface.h>
 #include <libdevcore/FixedHash.h>
+#include <libdevcore/Guards.h>
 #include <libdevcore/ThreadPool.h>
 #include <libdevcore/Worker.h>
 #include <libethcore/Exceptions.h>
@@ -38,6 +40,8 @@
 #include <libp2p/P2PInterface.h>
 #include <libp2p/P2PMessage.h>
 #include <libtxpool/TxPoolInterface.h>
+#include <chrono>
+#include <map>
 
 namespace dev
 {
@@ -60,15 +64,17 @@ public:
         m_protocolId(_protocolId),
         m_groupId(dev::eth::getGroupAndProtocol(_protocolId).first),
         m_nodeId(_nodeId),
-        m_genesisHash(_genesisHash)
+        m_genesisHash(_genesisHash),
+        m_blockChunksAssembler([_blockChain](dev::eth::BlockHeader const& _header) {
+            // drop the streams of the blocks that have been committed
+            return _header.number() > _blockChain->number();
+        })
     {
         m_service->registerHandlerByProtoclID(
             m_protocolId, boost::bind(&SyncMsgEngine::messageHandler, this, _1, _2, _3));
-        m_txsWorker = std::make_shared<dev::ThreadPool>("SyncMsgE-" + std::to_string(m_groupId), 1);
-        m_txsSender =
-            std::make_shared<dev::ThreadPool>("TxsSender-" + std::to_string(m_groupId), 1);
-        m_txsReceiver =
-            std::make_shared<dev::ThreadPool>("txsRecv-" + std::to_string(m_groupId), 1);
+        m_txsWorker = dev::createSerialWorker("SyncMsgE-" + std::to_string(m_groupId));
+        m_txsSender = dev::createSerialWorker("TxsSender-" + std::to_string(m_groupId));
+        m_txsReceiver = dev::createSerialWorker("txsRecv-" + std::to_string(m_groupId));
     }
 
     virtual void stop();
@@ -100,6 +106,10 @@ public:
 
     NodeTimeMaintenance::Ptr nodeTimeMaintenance() { return m_nodeTimeMaintenance; }
 
+    // start a round of transaction reconciliation with _peer
+    void sendTxsSketch(dev::h512 const& _peer);
+    TxsRelayStatistics::Ptr relayStatistics() { return m_relayStatistics; }
+
 private:
     bool checkSession(std::shared_ptr<dev::p2p::P2PSession> _session);
     bool checkMessage(dev::p2p::P2PMessage::Ptr _msg);
@@ -113,12 +123,26 @@ protected:
     void onPeerTransactions(SyncMsgPacket::Ptr _packet, dev::p2p::P2PMessage::Ptr _msg);
     void onPeerBlocks(SyncMsgPacket const& _packet);
     void onPeerRequestBlocks(SyncMsgPacket const& _packet);
+    void onPeerBlockChunks(SyncMsgPacket const& _packet);
 
     void onPeerTxsStatus(
         std::shared_ptr<SyncMsgPacket> _packet, dev::h512 const& _peer, dev::p2p::P2PMessage::Ptr);
     void onReceiveTxsRequest(std::shared_ptr<SyncMsgPacket> _txsReqPacket, dev::h512 const& _peer,
         dev::p2p::P2PMessage::Ptr);
 
+    void onPeerTxsSketch(
+        std::shared_ptr<SyncMsgPacket> _packet, dev::h512 const& _peer, dev::p2p::P2PMessage::Ptr);
+    void onPeerTxsReconcileRequest(
+        std::shared_ptr<SyncMsgPacket> _packet, dev::h512 const& _peer, dev::p2p::P2PMessage::Ptr);
+
+    void sendTxs(std::shared_ptr<dev::eth::Transactions> _txs, dev::h512 const& _peer);
+    void sendTxsStatus(std::shared_ptr<dev::eth::Transactions> _txs, dev::h512 const& _peer,
+        TxsStatusReason _reason = TxsStatusReason::Gossip);
+    // the pending transactions to be reconciled
+    std::shared_ptr<dev::eth::Transactions> reconcileTxs();
+    // finish the pending round with _peer answered by a txs status, false if no round pending
+    bool finishReconcile(dev::h512 const& _peer, bool _failed);
+
 protected:
     // Outside data
     std::shared_ptr<dev::p2p::P2PInterface> m_service;
@@ -145,6 +169,21 @@ protected:
 
     // factory used to create sync related packet
     SyncMsgPacketFactory::Ptr m_syncMsgPacketFactory;
+
+    // the state of the transaction reconciliation with every peer
+    struct ReconcileState
+    {
+        std::chrono::steady_clock::time_point sentTime;
+        bool pending = false;
+        // adapted to the size of the last difference
+        size_t cellCount = c_minSketchCells;
+    };
+    mutable Mutex x_reconcileStates;
+    std::map<dev::h512, ReconcileState> m_reconcileStates;
+    TxsRelayStatistics::Ptr m_relayStatistics = std::make_shared<TxsRelayStatistics>();
+
+    // reassemble the blocks streamed by the peers
+    BlockChunksAssembler m_blockChunksAssembler;
 };
 
 class DownloadBlocksContainer
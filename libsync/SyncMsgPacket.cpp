@@ -174,23 +174,60 @@ void SyncBlocksPacket::singleEncode(dev::bytes const& _blockRLP)
     m_rlpStream.append(_blockRLP);
 }
 
-void SyncReqBlockPacket::encode(int64_t _from, unsigned _size)
+void SyncReqBlockPacket::encode(int64_t _from, unsigned _size, unsigned _blockChunkSize)
 {
     m_rlpStream.clear();
-    prep(m_rlpStream, ReqBlocskPacket, 2) << _from << _size;
+    // the chunk size is only appended when the blocks are requested to be streamed
+    if (_blockChunkSize == 0)
+    {
+        prep(m_rlpStream, ReqBlocskPacket, 2) << _from << _size;
+        return;
+    }
+    prep(m_rlpStream, ReqBlocskPacket, 3) << _from << _size << _blockChunkSize;
 }
 
-void SyncTxsStatusPacket::encode(
-    int64_t const& _number, std::shared_ptr<std::set<dev::h256>> _txsHash)
+void SyncBlockChunksPacket::encode(
+    int64_t _number, size_t _blockSize, size_t _offset, bytesConstRef _chunk)
 {
     m_rlpStream.clear();
-    auto& retRlp = prep(m_rlpStream, packetType, 2);
+    prep(m_rlpStream, BlockChunksPacket, 4) << _number << u256(_blockSize) << u256(_offset);
+    m_rlpStream.append(_chunk);
+}
+
+void SyncTxsStatusPacket::encode(int64_t const& _number,
+    std::shared_ptr<std::set<dev::h256>> _txsHash, TxsStatusReason _reason)
+{
+    m_rlpStream.clear();
+    // the gossiped status keeps the two items understood by the nodes without reconciliation
+    auto& retRlp = prep(m_rlpStream, packetType, _reason == TxsStatusReason::Gossip ? 2 : 3);
     retRlp << _number;
     retRlp.append(*_txsHash);
+    if (_reason != TxsStatusReason::Gossip)
+    {
+        retRlp << (unsigned)_reason;
+    }
 }
 
 void SyncTxsReqPacket::encode(std::shared_ptr<std::vector<dev::h256>> _requestedTxs)
 {
     m_rlpStream.clear();
     prep(m_rlpStream, packetType, 1).append(*_requestedTxs);
-}
\ No newline at end of file
+}
+
+void SyncTxsSketchPacket::encode(
+    int64_t const& _number, uint64_t const& _txsNum, TxsSketch const& _sketch)
+{
+    m_rlpStream.clear();
+    auto& retRlp = prep(m_rlpStream, packetType, 3);
+    retRlp << _number << _txsNum;
+    _sketch.encode(retRlp);
+}
+
+void SyncTxsReconcileReqPacket::encode(
+    uint64_t const& _diffSize, std::set<uint64_t> const& _shortIds)
+{
+    m_rlpStream.clear();
+    auto& retRlp = prep(m_rlpStream, packetType, 2);
+    retRlp << _diffSize;
+    retRlp.append(_shortIds);
+}
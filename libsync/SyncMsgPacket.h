@@ -23,6 +23,7 @@
 
 #pragma once
 #include "Common.h"
+#include "TxsSketch.h"
 #include <libdevcore/RLP.h>
 #include <libnetwork/Common.h>
 #include <libp2p/P2PMessageFactory.h>
@@ -145,7 +146,26 @@ class SyncReqBlockPacket : public SyncMsgPacket
 {
 public:
     SyncReqBlockPacket() { packetType = ReqBlocskPacket; }
-    void encode(int64_t _from, unsigned _size);
+    // _blockChunkSize: request the blocks to be streamed in chunks, 0 means in BlocksPacket
+    void encode(int64_t _from, unsigned _size, unsigned _blockChunkSize = 0);
+};
+
+// a chunk of the block streamed to the requester: number, size of the block, offset, data
+class SyncBlockChunksPacket : public SyncMsgPacket
+{
+public:
+    SyncBlockChunksPacket() { packetType = BlockChunksPacket; }
+    void encode(int64_t _number, size_t _blockSize, size_t _offset, bytesConstRef _chunk);
+};
+
+// why the txs status is sent, the status answering a sketch carries the reason as the third item
+enum class TxsStatusReason : unsigned
+{
+    Gossip = 0,
+    // the receiver of the sketch failed to decode the difference
+    SketchDecodeFailed = 1,
+    // the receiver of the sketch has more txs than c_maxReconcileTxs
+    TooManyTxs = 2,
 };
 
 // transaction status packet
@@ -153,7 +173,8 @@ class SyncTxsStatusPacket : public SyncMsgPacket
 {
 public:
     SyncTxsStatusPacket() { packetType = TxsStatusPacket; }
-    void encode(int64_t const& _number, std::shared_ptr<std::set<dev::h256>> _txsHash);
+    void encode(int64_t const& _number, std::shared_ptr<std::set<dev::h256>> _txsHash,
+        TxsStatusReason _reason = TxsStatusReason::Gossip);
 };
 
 // transaction request packet
@@ -164,5 +185,22 @@ public:
     void encode(std::shared_ptr<std::vector<dev::h256>> _requestedTxs);
 };
 
+// the sketch of the pending transactions, used by transaction reconciliation
+class SyncTxsSketchPacket : public SyncMsgPacket
+{
+public:
+    SyncTxsSketchPacket() { packetType = TxsSketchPacket; }
+    void encode(int64_t const& _number, uint64_t const& _txsNum, TxsSketch const& _sketch);
+};
+
+// the response of the sketch: the size of the decoded difference and the short ids of the
+// transactions requested from the sender of the sketch
+class SyncTxsReconcileReqPacket : public SyncMsgPacket
+{
+public:
+    SyncTxsReconcileReqPacket() { packetType = TxsReconcileReqPacket; }
+    void encode(uint64_t const& _diffSize, std::set<uint64_t> const& _shortIds);
+};
+
 }  // namespace sync
 }  // namespace dev
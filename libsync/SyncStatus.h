@@ -20,6 +20,7 @@
  * @date: 2018-10-16
  */
 #pragma once
+#include "BlockChunks.h"
 #include "Common.h"
 #include "DownloadingBlockQueue.h"
 #include "RspBlockReq.h"
@@ -28,10 +29,12 @@
 #include <libdevcore/FixedHash.h>
 #include <libdevcore/Worker.h>
 #include <libethcore/Exceptions.h>
+#include <libflowlimit/RateLimiter.h>
 #include <libnetwork/Common.h>
 #include <libnetwork/Session.h>
 #include <libp2p/P2PInterface.h>
 #include <libtxpool/TxPoolInterface.h>
+#include <atomic>
 #include <map>
 #include <queue>
 #include <set>
@@ -85,6 +88,12 @@ public:
     h256 latestHash;
     DownloadRequestQueue reqQueue;
     bool isSealer = false;
+    // the chunk size of the blocks streamed to the peer, 0 means sending the blocks in batch
+    std::atomic<unsigned> blockChunkSize = {0};
+    // the rest of the block being streamed to the peer
+    UploadingBlock::Ptr uploadingBlock;
+    // the upload bandwidth budget of the peer
+    dev::flowlimit::RateLimiter::Ptr uploadLimiter;
 };
 
 class SyncMasterStatus
@@ -32,6 +32,7 @@ using namespace dev::p2p;
 using namespace dev::txpool;
 
 static unsigned const c_maxSendTransactions = 1000;
+static uint64_t const c_relayStatisticsInterval = 60000;  // ms
 
 void SyncTransaction::start()
 {
@@ -72,6 +73,12 @@ void SyncTransaction::doWork()
     {
         forwardRemainingTxs();
     }
+
+    if (m_needMaintainTransactions && m_txsReconcileInterval > 0)
+    {
+        reconcileTransactions();
+    }
+    printRelayStatistics();
 }
 
 void SyncTransaction::workLoop()
@@ -127,7 +134,8 @@ void SyncTransaction::sendTransactions(std::shared_ptr<Transactions> _ts,
 
     // send the transactions from RPC
     broadcastTransactions(selectedPeers, _ts, _fastForwardRemainTxs, _startIndex);
-    if (!_fastForwardRemainTxs && m_running.load())
+    // the txs status is replaced with the reconciliation
+    if (!_fastForwardRemainTxs && m_running.load() && m_txsReconcileInterval == 0)
     {
         // Added sleep to prevent excessive redundant transaction message packets caused by
         // transaction status spreading too fast
@@ -307,6 +315,59 @@ void SyncTransaction::sendTxsStatus(
     m_txsHash->clear();
 }
 
+// reconcile the pending txs with one consensus node every m_txsReconcileInterval in turn
+void SyncTransaction::reconcileTransactions()
+{
+    auto currentTime = utcSteadyTime();
+    if (currentTime - m_lastReconcileTime < (uint64_t)m_txsReconcileInterval)
+    {
+        return;
+    }
+    m_lastReconcileTime = currentTime;
+    std::shared_ptr<NodeIDs> selectedPeers;
+    if (fp_txsReceiversFilter)
+    {
+        selectedPeers = fp_txsReceiversFilter(m_syncStatus->peersSet());
+    }
+    else
+    {
+        selectedPeers = m_syncStatus->peers();
+    }
+    if (!selectedPeers || selectedPeers->size() == 0)
+    {
+        return;
+    }
+    auto peer = (*selectedPeers)[m_reconcilePeerIndex % selectedPeers->size()];
+    m_reconcilePeerIndex++;
+    m_msgEngine->sendTxsSketch(peer);
+}
+
+void SyncTransaction::printRelayStatistics()
+{
+    auto currentTime = utcSteadyTime();
+    if (currentTime - m_lastRelayStatisticsTime < c_relayStatisticsInterval)
+    {
+        return;
+    }
+    m_lastRelayStatisticsTime = currentTime;
+    auto statistics = m_msgEngine->relayStatistics();
+    auto rounds = statistics->reconcileRounds.load();
+    SYNC_LOG(INFO) << LOG_BADGE("Tx") << LOG_DESC("txs relay statistics")
+                   << LOG_KV("reconcileInterval", m_txsReconcileInterval.load())
+                   << LOG_KV("statusPackets", statistics->statusPackets.load())
+                   << LOG_KV("statusBytes", statistics->statusBytes.load())
+                   << LOG_KV("reconcileRounds", rounds)
+                   << LOG_KV("reconcileFailures", statistics->reconcileFailures.load())
+                   << LOG_KV("reconcileFallbacks", statistics->reconcileFallbacks.load())
+                   << LOG_KV("sketchBytes", statistics->sketchBytes.load())
+                   << LOG_KV("reconcileRequestBytes", statistics->reconcileRequestBytes.load())
+                   << LOG_KV("reconcileDiffTxs", statistics->reconcileDiffTxs.load())
+                   << LOG_KV("avgReconcileLatencyMs",
+                          rounds == 0 ? 0 : statistics->reconcileLatencyMs.load() / rounds)
+                   << LOG_KV("sentTxs", statistics->sentTxs.load())
+                   << LOG_KV("sentTxsBytes", statistics->sentTxsBytes.load());
+}
+
 void SyncTransaction::updateNeedMaintainTransactions(bool const& _needMaintainTxs)
 {
     if (_needMaintainTxs != m_needMaintainTransactions)
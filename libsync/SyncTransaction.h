@@ -120,6 +120,11 @@ public:
     {
         m_txsStatusGossipMaxPeers = _txsStatusGossipMaxPeers;
     }
+    // replace the txs status gossip with the reconciliation if _txsReconcileInterval > 0
+    void setTxsReconcileInterval(int64_t const& _txsReconcileInterval)
+    {
+        m_txsReconcileInterval = _txsReconcileInterval;
+    }
 
 private:
     /// p2p service handler
@@ -166,6 +171,11 @@ private:
 
     unsigned m_txsStatusGossipMaxPeers = 5;
 
+    std::atomic<int64_t> m_txsReconcileInterval = {0};
+    uint64_t m_lastReconcileTime = 0;
+    size_t m_reconcilePeerIndex = 0;
+    uint64_t m_lastRelayStatisticsTime = 0;
+
     std::atomic_bool m_running = {false};
 
 private:
@@ -179,6 +189,8 @@ private:
         bool const& _fastForwardRemainTxs, int64_t const& _startIndex);
     void sendTxsStatus(
         std::shared_ptr<dev::eth::Transactions> _txs, std::shared_ptr<NodeIDs> _selectedPeers);
+    void reconcileTransactions();
+    void printRelayStatistics();
 };
 
 }  // namespace sync
@@ -0,0 +1,221 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : sketch of the transaction set used by transaction reconciliation
+ * @file: TxsSketch.cpp
+ */
+#include "TxsSketch.h"
+#include "Common.h"
+#include <deque>
+
+using namespace dev;
+using namespace dev::sync;
+
+namespace
+{
+// every id is hashed into one cell of each of the c_hashCount partitions
+size_t const c_hashCount = 3;
+size_t const c_cellBytes = 24;
+
+uint64_t mix64(uint64_t _x)
+{
+    _x ^= _x >> 33;
+    _x *= 0xff51afd7ed558ccdULL;
+    _x ^= _x >> 33;
+    _x *= 0xc4ceb9fe1a85ec53ULL;
+    _x ^= _x >> 33;
+    return _x;
+}
+
+void putUint64(byte* _out, uint64_t _value)
+{
+    for (size_t i = 0; i < 8; ++i)
+    {
+        _out[i] = (byte)(_value >> (56 - 8 * i));
+    }
+}
+
+uint64_t getUint64(byte const* _in)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        value = (value << 8) | _in[i];
+    }
+    return value;
+}
+}  // namespace
+
+uint64_t dev::sync::txShortId(h256 const& _txHash)
+{
+    return getUint64(_txHash.data());
+}
+
+TxsSketch::Ptr dev::sync::createTxsSketch(dev::eth::Transactions const& _txs, size_t _cellCount)
+{
+    auto sketch = std::make_shared<TxsSketch>(_cellCount);
+    for (auto const& tx : _txs)
+    {
+        sketch->insert(txShortId(tx->sha3()));
+    }
+    return sketch;
+}
+
+TxsSketch::TxsSketch(size_t _cellCount)
+{
+    // round up to the multiple of c_hashCount so that every partition has the same size
+    size_t partitionSize = std::max((size_t)1, (_cellCount + c_hashCount - 1) / c_hashCount);
+    m_cells.resize(partitionSize * c_hashCount);
+}
+
+size_t TxsSketch::cellIndex(uint64_t _shortId, size_t _hashIndex) const
+{
+    size_t partitionSize = m_cells.size() / c_hashCount;
+    return _hashIndex * partitionSize +
+           mix64(_shortId + 0x9e3779b97f4a7c15ULL * (_hashIndex + 1)) % partitionSize;
+}
+
+uint64_t TxsSketch::checkSum(uint64_t _shortId)
+{
+    return mix64(_shortId ^ 0x2545f4914f6cdd1dULL);
+}
+
+void TxsSketch::update(uint64_t _shortId, int64_t _delta)
+{
+    auto sum = checkSum(_shortId);
+    for (size_t i = 0; i < c_hashCount; ++i)
+    {
+        auto& cell = m_cells[cellIndex(_shortId, i)];
+        cell.count += _delta;
+        cell.idSum ^= _shortId;
+        cell.checkSum ^= sum;
+    }
+}
+
+void TxsSketch::insert(uint64_t _shortId)
+{
+    update(_shortId, 1);
+}
+
+void TxsSketch::subtract(TxsSketch const& _sketch)
+{
+    if (_sketch.m_cells.size() != m_cells.size())
+    {
+        BOOST_THROW_EXCEPTION(InValidSyncPacket() << errinfo_comment("sketch size mismatch"));
+    }
+    for (size_t i = 0; i < m_cells.size(); ++i)
+    {
+        m_cells[i].count -= _sketch.m_cells[i].count;
+        m_cells[i].idSum ^= _sketch.m_cells[i].idSum;
+        m_cells[i].checkSum ^= _sketch.m_cells[i].checkSum;
+    }
+}
+
+bool TxsSketch::decode(std::set<uint64_t>& _onlyLocal, std::set<uint64_t>& _onlyRemote) const
+{
+    TxsSketch sketch(*this);
+    auto isPure = [&sketch](size_t _index) {
+        auto const& cell = sketch.m_cells[_index];
+        return (cell.count == 1 || cell.count == -1) && checkSum(cell.idSum) == cell.checkSum;
+    };
+    std::deque<size_t> pureCells;
+    for (size_t i = 0; i < sketch.m_cells.size(); ++i)
+    {
+        if (isPure(i))
+        {
+            pureCells.push_back(i);
+        }
+    }
+    // every id of a decodable difference is peeled once, and the difference can't be larger than
+    // the cell count, the crafted sketch of a peer may make the ids be peeled again and again
+    size_t peeledIds = 0;
+    while (!pureCells.empty())
+    {
+        if (peeledIds >= sketch.m_cells.size())
+        {
+            return false;
+        }
+        auto index = pureCells.front();
+        pureCells.pop_front();
+        if (!isPure(index))
+        {
+            continue;
+        }
+        auto shortId = sketch.m_cells[index].idSum;
+        auto count = sketch.m_cells[index].count;
+        if (count == 1)
+        {
+            _onlyLocal.insert(shortId);
+        }
+        else
+        {
+            _onlyRemote.insert(shortId);
+        }
+        sketch.update(shortId, -count);
+        peeledIds++;
+        for (size_t i = 0; i < c_hashCount; ++i)
+        {
+            auto peeled = sketch.cellIndex(shortId, i);
+            if (isPure(peeled))
+            {
+                pureCells.push_back(peeled);
+            }
+        }
+    }
+    for (auto const& cell : sketch.m_cells)
+    {
+        if (cell.count != 0 || cell.idSum != 0 || cell.checkSum != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void TxsSketch::encode(RLPStream& _s) const
+{
+    bytes data(m_cells.size() * c_cellBytes);
+    byte* out = data.data();
+    for (auto const& cell : m_cells)
+    {
+        putUint64(out, (uint64_t)cell.count);
+        putUint64(out + 8, cell.idSum);
+        putUint64(out + 16, cell.checkSum);
+        out += c_cellBytes;
+    }
+    _s.append(data);
+}
+
+TxsSketch::Ptr TxsSketch::decodeFrom(RLP const& _rlp)
+{
+    auto data = _rlp.toBytesConstRef();
+    if (data.size() == 0 || data.size() % (c_cellBytes * c_hashCount) != 0 ||
+        data.size() / c_cellBytes > c_maxSketchCells)
+    {
+        BOOST_THROW_EXCEPTION(InValidSyncPacket() << errinfo_comment("invalid sketch size"));
+    }
+    auto sketch = std::make_shared<TxsSketch>(data.size() / c_cellBytes);
+    byte const* in = data.data();
+    for (auto& cell : sketch->m_cells)
+    {
+        cell.count = (int64_t)getUint64(in);
+        cell.idSum = getUint64(in + 8);
+        cell.checkSum = getUint64(in + 16);
+        in += c_cellBytes;
+    }
+    return sketch;
+}
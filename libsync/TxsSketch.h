@@ -0,0 +1,105 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : sketch of the transaction set used by transaction reconciliation
+ * @file: TxsSketch.h
+ */
+#pragma once
+#include <libdevcore/FixedHash.h>
+#include <libdevcore/RLP.h>
+#include <libethcore/Transaction.h>
+#include <atomic>
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace dev
+{
+namespace sync
+{
+// the short id of a transaction is the first 8 bytes of its hash
+uint64_t txShortId(dev::h256 const& _txHash);
+
+/**
+ * @brief Invertible bloom lookup table of the transaction short ids.
+ * Two nodes with the sketches of the same size can compute the symmetric difference of their
+ * transaction sets from the difference of the sketches, if the difference is no larger than about
+ * 2/3 of the cell count. The size of the sketch is independent of the size of the sets.
+ */
+class TxsSketch
+{
+public:
+    using Ptr = std::shared_ptr<TxsSketch>;
+    explicit TxsSketch(size_t _cellCount);
+
+    void insert(uint64_t _shortId);
+    // this = this - _sketch, the cell counts must be the same
+    void subtract(TxsSketch const& _sketch);
+    /**
+     * @brief decode the difference, must be called after subtract
+     * @param _onlyLocal: the ids only in this sketch
+     * @param _onlyRemote: the ids only in the subtracted sketch
+     * @return false if the difference is too large to be decoded, or more ids than the cells
+     * are peeled
+     */
+    bool decode(std::set<uint64_t>& _onlyLocal, std::set<uint64_t>& _onlyRemote) const;
+
+    size_t cellCount() const { return m_cells.size(); }
+
+    void encode(RLPStream& _s) const;
+    static TxsSketch::Ptr decodeFrom(RLP const& _rlp);
+
+private:
+    struct Cell
+    {
+        int64_t count = 0;
+        uint64_t idSum = 0;
+        uint64_t checkSum = 0;
+    };
+    void update(uint64_t _shortId, int64_t _delta);
+    size_t cellIndex(uint64_t _shortId, size_t _hashIndex) const;
+    static uint64_t checkSum(uint64_t _shortId);
+
+    std::vector<Cell> m_cells;
+};
+
+// the sketch of the short ids of _txs
+TxsSketch::Ptr createTxsSketch(dev::eth::Transactions const& _txs, size_t _cellCount);
+
+/// bandwidth and latency counters of the transaction relay, for comparing the gossip of the
+/// transaction status with the reconciliation
+struct TxsRelayStatistics
+{
+    using Ptr = std::shared_ptr<TxsRelayStatistics>;
+    // txs status gossip
+    std::atomic<uint64_t> statusPackets = {0};
+    std::atomic<uint64_t> statusBytes = {0};
+    // reconciliation
+    std::atomic<uint64_t> reconcileRounds = {0};
+    std::atomic<uint64_t> reconcileFailures = {0};
+    // the rounds fell back to the txs status since the txs are more than c_maxReconcileTxs
+    std::atomic<uint64_t> reconcileFallbacks = {0};
+    std::atomic<uint64_t> sketchBytes = {0};
+    std::atomic<uint64_t> reconcileRequestBytes = {0};
+    std::atomic<uint64_t> reconcileDiffTxs = {0};
+    std::atomic<uint64_t> reconcileLatencyMs = {0};
+    // transactions pushed to or requested by the peers
+    std::atomic<uint64_t> sentTxs = {0};
+    std::atomic<uint64_t> sentTxsBytes = {0};
+};
+}  // namespace sync
+}  // namespace dev
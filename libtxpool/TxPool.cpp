@@ -231,18 +231,25 @@ ImportResult TxPool::import(Transaction::Ptr _tx, IfDropped)
                           << LOG_KV("txCapacity", _tx->capacity())
                           << LOG_KV("memoryLimit", m_maxMemoryLimit)
                           << LOG_KV("hash", _tx->sha3().abridged());
+        m_rejectedTxsMetric->inc();
         return ImportResult::OverGroupMemoryLimit;
     }
     UpgradableGuard l(m_lock);
     /// check the txpool size
     if (m_txsQueue.size() >= m_limit)
     {
+        m_rejectedTxsMetric->inc();
         return ImportResult::TransactionPoolIsFull;
     }
     /// check the verify result(nonce && signature check)
     ImportResult verify_ret = verify(_tx);
-    if (verify_ret == ImportResult::Success)
+    if (verify_ret != ImportResult::Success)
     {
+        m_rejectedTxsMetric->inc();
+    }
+    else
+    {
+        m_importedTxsMetric->inc();
         {
             UpgradeGuard ul(l);
             if (insert(_tx))
@@ -261,6 +268,60 @@ ImportResult TxPool::import(Transaction::Ptr _tx, IfDropped)
     return verify_ret;
 }
 
+std::vector<ImportResult> TxPool::batchImport(dev::eth::Transactions const& _txs)
+{
+    std::vector<ImportResult> results(_txs.size(), ImportResult::Success);
+    std::vector<dev::h256> importedTxs;
+    importedTxs.reserve(_txs.size());
+    {
+        WriteGuard l(m_lock);
+        for (size_t i = 0; i < _txs.size(); ++i)
+        {
+            auto const& tx = _txs[i];
+            tx->setImportTime(u256(utcTime()));
+            auto memoryUsed = m_usedMemorySize + tx->capacity();
+            if (memoryUsed > m_maxMemoryLimit)
+            {
+                TXPOOL_LOG(DEBUG) << LOG_DESC("batchImport: overMemoryLimit")
+                                  << LOG_KV("memoryUsed", memoryUsed)
+                                  << LOG_KV("txCapacity", tx->capacity())
+                                  << LOG_KV("memoryLimit", m_maxMemoryLimit)
+                                  << LOG_KV("hash", tx->sha3().abridged());
+                results[i] = ImportResult::OverGroupMemoryLimit;
+                continue;
+            }
+            if (m_txsQueue.size() >= m_limit)
+            {
+                results[i] = ImportResult::TransactionPoolIsFull;
+                continue;
+            }
+            results[i] = verify(tx);
+            if (results[i] != ImportResult::Success)
+            {
+                continue;
+            }
+            if (insert(tx))
+            {
+                m_txpoolNonceChecker->insertCache(*tx);
+                m_usedMemorySize += tx->capacity();
+            }
+            importedTxs.push_back(tx->sha3());
+        }
+    }
+    m_importedTxsMetric->inc(importedTxs.size());
+    m_rejectedTxsMetric->inc(_txs.size() - importedTxs.size());
+    if (importedTxs.empty())
+    {
+        return results;
+    }
+    {
+        WriteGuard txsLock(x_txsHashFilter);
+        m_txsHashFilter->insert(importedTxs.begin(), importedTxs.end());
+    }
+    m_onReady();
+    return results;
+}
+
 void TxPool::verifyAndSetSenderForBlock(dev::eth::Block& block)
 {
     auto trans_num = block.getTransactionSize();
@@ -406,7 +467,7 @@ bool TxPool::removeTrans(h256 const& _txHash, bool _needTriggerCallback,
             dev::bytesConstRef input = dev::bytesConstRef();
             if (_block && _block->transactionReceipts()->size() > _index)
             {
-                input = dev::bytesConstRef(transaction->data().data(), transaction->data().size());
+                input = transaction->dataRef();
                 pReceipt = constructTransactionReceipt((*(_block->transactions()))[_index],
                     (*(_block->transactionReceipts()))[_index], *_block, _index);
             }
@@ -439,8 +500,23 @@ bool TxPool::insert(Transaction::Ptr _tx)
     {
         return false;
     }
+    // the transaction decoded from a block outlives the block in the pool, copy it out of the
+    // buffer of the block instead of keeping the whole buffer alive
+    if (_tx->isView())
+    {
+        _tx = std::make_shared<Transaction>(*_tx);
+        _tx->detach();
+    }
     TransactionQueue::iterator p_tx = m_txsQueue.emplace(_tx).first;
     m_txsHash[tx_hash] = p_tx;
+    // the transaction may be inserted before the sealing cursor, fetch from the beginning
+    {
+        Guard l(x_sealingCursor);
+        if (m_sealingCursor.avoid && _tx->importTime() <= m_sealingCursor.importTime)
+        {
+            m_sealingCursor.avoid = nullptr;
+        }
+    }
     return true;
 }
 
@@ -602,8 +678,19 @@ std::shared_ptr<Transactions> TxPool::topTransactions(
     {
         WriteGuard wl(x_invalidTxs);
         ReadGuard l(m_lock);
-        for (auto it = m_txsQueue.begin(); txCnt < limit && it != m_txsQueue.end(); it++)
+        // only the caller collecting the returned transactions into _avoid can resume from the
+        // sealing cursor, the others scan from the beginning
+        std::unique_lock<std::mutex> cursorLock(x_sealingCursor, std::defer_lock);
+        auto it = m_txsQueue.begin();
+        if (_updateAvoid)
+        {
+            cursorLock.lock();
+            it = sealingCursor(_avoid);
+        }
+        auto lastVisited = m_txsQueue.end();
+        for (; txCnt < limit && it != m_txsQueue.end(); it++)
         {
+            lastVisited = it;
             if (m_invalidTxs->count((*it)->sha3()))
             {
                 continue;
@@ -624,6 +711,7 @@ std::shared_ptr<Transactions> TxPool::topTransactions(
             if (!m_txNonceCheck->isBlockLimitOk(*(*it)))
             {
                 m_invalidTxs->insert(std::pair<h256, u256>((*it)->sha3(), (*it)->nonce()));
+                invalidBlockLimitTxs.push_back((*it)->sha3());
                 TXPOOL_LOG(WARNING)
                     << LOG_DESC("Invalid blocklimit") << LOG_KV("hash", (*it)->sha3().abridged())
                     << LOG_KV("blockLimit", (*it)->blockLimit())
@@ -638,12 +726,45 @@ std::shared_ptr<Transactions> TxPool::topTransactions(
                     _avoid.insert((*it)->sha3());
             }
         }
+        if (_updateAvoid && lastVisited != m_txsQueue.end())
+        {
+            m_sealingCursor.avoid = &_avoid;
+            m_sealingCursor.avoidSize = _avoid.size();
+            m_sealingCursor.hash = (*lastVisited)->sha3();
+            m_sealingCursor.importTime = (*lastVisited)->importTime();
+        }
     }
     // TXPOOL_LOG(DEBUG) << "topTransaction done, ignore: " << ignoreCount;
-    m_workerPool->enqueue([this]() { removeInvalidTxs(); });
+    if (!invalidBlockLimitTxs.empty())
+    {
+        m_workerPool->enqueue([this]() { removeInvalidTxs(); });
+    }
     return ret;
 }
 
+/**
+ * @brief: the position to resume fetching the transactions for the sealer
+ * all the transactions before the cursor are in _avoid or invalid, so the sealer fetches the next
+ * N transactions in O(N) instead of rescanning the whole queue for every call
+ * @param _avoid: the transactions that have been returned to the sealer
+ */
+TxPool::TransactionQueue::iterator TxPool::sealingCursor(h256Hash const& _avoid)
+{
+    // the avoid set has been reset or updated by others since the last call
+    if (m_sealingCursor.avoid != &_avoid || m_sealingCursor.avoidSize != _avoid.size() ||
+        !_avoid.count(m_sealingCursor.hash))
+    {
+        return m_txsQueue.begin();
+    }
+    // the transaction at the cursor has been removed from the queue
+    auto it = m_txsHash.find(m_sealingCursor.hash);
+    if (it == m_txsHash.end())
+    {
+        return m_txsQueue.begin();
+    }
+    return std::next(it->second);
+}
+
 std::shared_ptr<Transactions> TxPool::topTransactionsCondition(
     uint64_t const& _limit, dev::h512 const&)
 {
@@ -703,6 +824,8 @@ void TxPool::clear()
     m_txsQueue.clear();
     m_txsHash.clear();
     m_dropped.clear();
+    Guard cursorGuard(x_sealingCursor);
+    m_sealingCursor.avoid = nullptr;
 }
 
 std::shared_ptr<Transactions> TxPool::obtainTransactions(std::vector<dev::h256> const& _reqTxs)
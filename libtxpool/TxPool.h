@@ -25,6 +25,7 @@
 #include "TransactionNonceCheck.h"
 #include "TxPoolInterface.h"
 #include <libblockchain/BlockChainInterface.h>
+#include <libdevcore/Metrics.h>
 #include <libdevcore/ThreadPool.h>
 #include <libethcore/Block.h>
 #include <libethcore/Common.h>
@@ -79,11 +80,15 @@ public:
         m_groupId = dev::eth::getGroupAndProtocol(m_protocolId).first;
         m_txNonceCheck = std::make_shared<TransactionNonceCheck>(m_blockChain);
         m_txpoolNonceChecker = std::make_shared<CommonTransactionNonceCheck>();
-        m_submitPool = std::make_shared<dev::ThreadPool>("submit-" + std::to_string(m_groupId), 1);
+        m_submitPool = dev::createSerialWorker("submit-" + std::to_string(m_groupId));
         m_workerPool =
             std::make_shared<dev::ThreadPool>("txPool-" + std::to_string(m_groupId), workThreads);
         m_invalidTxs = std::make_shared<std::map<dev::h256, dev::u256>>();
         m_txsHashFilter = std::make_shared<std::set<h256>>();
+        m_importedTxsMetric = MetricsRegistry::instance().counter("bcos_txpool_imported_total",
+            "transactions admitted to the txpool", metrics::groupLabel(m_groupId));
+        m_rejectedTxsMetric = MetricsRegistry::instance().counter("bcos_txpool_rejected_total",
+            "transactions rejected by the txpool", metrics::groupLabel(m_groupId));
     }
     void start() override {}
     void stop() override
@@ -186,6 +191,8 @@ protected:
      * @return ImportResult : Import result code.
      */
     ImportResult import(dev::eth::Transaction::Ptr _tx, IfDropped _ik = IfDropped::Ignore) override;
+    /// import the transactions with one acquisition of the lock
+    std::vector<ImportResult> batchImport(dev::eth::Transactions const& _txs) override;
     /// verify transaction
     virtual ImportResult verify(Transaction::Ptr trans, IfDropped _ik = IfDropped::Ignore);
     /// interface for filter check
@@ -245,6 +252,19 @@ private:
     using TransactionQueue = std::set<dev::eth::Transaction::Ptr, transactionCompare>;
     TransactionQueue m_txsQueue;
     std::unordered_map<h256, TransactionQueue::iterator> m_txsHash;
+    /// the last transaction visited by topTransactions with _updateAvoid
+    struct SealingCursor
+    {
+        /// the avoid set of the last call, nullptr if the cursor is invalid
+        h256Hash const* avoid = nullptr;
+        size_t avoidSize = 0;
+        h256 hash;
+        u256 importTime;
+    };
+    SealingCursor m_sealingCursor;
+    /// lock on m_sealingCursor, acquired after m_lock
+    Mutex x_sealingCursor;
+    TransactionQueue::iterator sealingCursor(h256Hash const& _avoid);
     mutable SharedMutex x_txsHashFilter;
     std::shared_ptr<std::set<h256>> m_txsHashFilter;
     /// hash of dropped transactions
@@ -263,6 +283,9 @@ private:
     std::atomic<int64_t> m_usedMemorySize = {0};
     int64_t m_maxMemoryLimit = 512 * 1024 * 1024;
 
+    MetricCounter::Ptr m_importedTxsMetric;
+    MetricCounter::Ptr m_rejectedTxsMetric;
+
     unsigned m_maxBlockLimit;
 };
 }  // namespace txpool
@@ -90,6 +90,21 @@ public:
      */
     virtual dev::eth::ImportResult import(
         dev::eth::Transaction::Ptr, dev::eth::IfDropped _ik = dev::eth::IfDropped::Ignore) = 0;
+    /**
+     * @brief : import a batch of transactions received from p2p, the senders of the transactions
+     * should have been recovered before calling this function
+     * @return the import result of every transaction
+     */
+    virtual std::vector<dev::eth::ImportResult> batchImport(dev::eth::Transactions const& _txs)
+    {
+        std::vector<dev::eth::ImportResult> results;
+        results.reserve(_txs.size());
+        for (auto const& tx : _txs)
+        {
+            results.push_back(import(tx));
+        }
+        return results;
+    }
     /// @returns the status of the transaction queue.
     virtual TxPoolStatus status() const = 0;
 
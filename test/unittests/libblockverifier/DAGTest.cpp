@@ -23,8 +23,10 @@
 #include <libblockverifier/DAG.h>
 #include <test/tools/libutils/TestOutputHelper.h>
 #include <boost/test/unit_test.hpp>
+#include <atomic>
 #include <iostream>
 #include <set>
+#include <thread>
 
 using namespace std;
 using namespace dev;
@@ -43,7 +45,7 @@ bool have(set<ID>& _set, ID _id)
 
 void consumeAndPush(DAG& _dag, ID _id, set<ID>& _topSet)
 {
-    ID top = _dag.consume(_id);
+    ID top = _dag.consume(_id, 0);
     if (top != INVALID_ID)
         _topSet.insert(top);
 }
@@ -69,7 +71,7 @@ BOOST_AUTO_TEST_CASE(DAGPopConsumeTest)
     set<ID> topSet;
     for (int i = 0; i < 9; i++)
     {
-        auto id = dag.waitPop(false);
+        auto id = dag.waitPop(0, false);
         std::cout << "pop " << id << std::endl;
         if (id == INVALID_ID)
         {
@@ -91,7 +93,7 @@ BOOST_AUTO_TEST_CASE(DAGPopConsumeTest)
 
     for (int i = 0; i < 9; i++)
     {
-        auto id = dag.waitPop(false);
+        auto id = dag.waitPop(0, false);
         std::cout << "pop " << id << std::endl;
         if (id == INVALID_ID)
         {
@@ -113,7 +115,7 @@ BOOST_AUTO_TEST_CASE(DAGPopConsumeTest)
 
     for (int i = 0; i < 9; i++)
     {
-        auto id = dag.waitPop(false);
+        auto id = dag.waitPop(0, false);
         std::cout << "pop " << id << std::endl;
         if (id == INVALID_ID)
         {
@@ -129,7 +131,7 @@ BOOST_AUTO_TEST_CASE(DAGPopConsumeTest)
 
     for (int i = 0; i < 9; i++)
     {
-        auto id = dag.waitPop(false);
+        auto id = dag.waitPop(0, false);
         std::cout << "pop " << id << std::endl;
         if (id == INVALID_ID)
         {
@@ -145,7 +147,7 @@ BOOST_AUTO_TEST_CASE(DAGPopConsumeTest)
 
     for (int i = 0; i < 9; i++)
     {
-        auto id = dag.waitPop(false);
+        auto id = dag.waitPop(0, false);
         std::cout << "pop " << id << std::endl;
         if (id == INVALID_ID)
         {
@@ -161,7 +163,7 @@ BOOST_AUTO_TEST_CASE(DAGPopConsumeTest)
 
     for (int i = 0; i < 9; i++)
     {
-        auto id = dag.waitPop(false);
+        auto id = dag.waitPop(0, false);
         std::cout << "pop " << id << std::endl;
         if (id == INVALID_ID)
         {
@@ -172,6 +174,79 @@ BOOST_AUTO_TEST_CASE(DAGPopConsumeTest)
     BOOST_CHECK_EQUAL(topSet.size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(DAGMultiWorkersTest)
+{
+    // every vertex depends on the last one of the same key, some vertexes on all before them
+    ID const vtxNum = 20000;
+    ID const keyNum = 50;
+    size_t const workerNum = 4;
+    std::vector<IDs> inEdges(vtxNum);
+    DAG dag;
+    dag.init(vtxNum, workerNum);
+    std::vector<ID> lastOfKey(keyNum, INVALID_ID);
+    for (ID id = 0; id < vtxNum; ++id)
+    {
+        if (id % 5000 == 4999)
+        {
+            for (auto& last : lastOfKey)
+            {
+                if (last != INVALID_ID)
+                {
+                    dag.addEdge(last, id);
+                    inEdges[id].push_back(last);
+                }
+                last = id;
+            }
+            continue;
+        }
+        auto& last = lastOfKey[(id * 7) % keyNum];
+        if (last != INVALID_ID)
+        {
+            dag.addEdge(last, id);
+            inEdges[id].push_back(last);
+        }
+        last = id;
+    }
+    dag.generate();
+
+    std::unique_ptr<std::atomic<int>[]> executed(new std::atomic<int>[vtxNum]);
+    for (ID id = 0; id < vtxNum; ++id)
+    {
+        executed[id] = 0;
+    }
+    std::atomic<bool> inOrder(true);
+    std::vector<std::thread> workers;
+    for (size_t worker = 0; worker < workerNum; ++worker)
+    {
+        workers.emplace_back([&, worker]() {
+            while (!dag.hasFinished())
+            {
+                for (ID id = dag.waitPop(worker); id != INVALID_ID; id = dag.consume(id, worker))
+                {
+                    for (auto from : inEdges[id])
+                    {
+                        if (executed[from] != 1)
+                        {
+                            inOrder = false;
+                        }
+                    }
+                    executed[id] += 1;
+                }
+            }
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    BOOST_CHECK(inOrder);
+    BOOST_CHECK_EQUAL(dag.consumedNumber(), vtxNum);
+    for (ID id = 0; id < vtxNum; ++id)
+    {
+        BOOST_CHECK_EQUAL(executed[id].load(), 1);
+    }
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace test
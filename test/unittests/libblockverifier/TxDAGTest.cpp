@@ -28,8 +28,10 @@
 #include <libprecompiled/extension/DagTransferPrecompiled.h>
 #include <test/tools/libutils/TestOutputHelper.h>
 #include <boost/test/unit_test.hpp>
+#include <atomic>
 #include <iostream>
 #include <set>
+#include <thread>
 
 using namespace std;
 using namespace dev;
@@ -132,7 +134,7 @@ BOOST_AUTO_TEST_CASE(PureParallelTxDAGTest)
     dev::executive::Executive::Ptr executive = std::make_shared<dev::executive::Executive>();
     while (!txDag->hasFinished())
     {
-        txDag->executeUnit(executive);
+        txDag->executeUnit(executive, 0);
     }
 
     BOOST_CHECK_EQUAL(exeTrans[0]->sha3(), (*trans)[0]->sha3());
@@ -168,7 +170,7 @@ BOOST_AUTO_TEST_CASE(NormalAndParallelTxDAGTest)
     dev::executive::Executive::Ptr executive = std::make_shared<dev::executive::Executive>();
     while (!txDag->hasFinished())
     {
-        txDag->executeUnit(executive);
+        txDag->executeUnit(executive, 0);
     }
 
     BOOST_CHECK_EQUAL(exeTrans[0]->sha3(), (*trans)[0]->sha3());
@@ -179,6 +181,100 @@ BOOST_AUTO_TEST_CASE(NormalAndParallelTxDAGTest)
     BOOST_CHECK_EQUAL(exeTrans[5]->sha3(), (*trans)[5]->sha3());
 }
 
+BOOST_AUTO_TEST_CASE(ConflictKeysTxDAGTest)
+{
+    shared_ptr<TxDAG> txDag = make_shared<TxDAG>();
+    ExecutiveContext::Ptr executiveContext = createCtx();
+
+    size_t const txNum = 300;
+    std::shared_ptr<Transactions> trans = std::make_shared<Transactions>();
+    for (size_t i = 0; i < txNum; ++i)
+    {
+        if (i % 37 == 36)
+        {
+            trans->emplace_back(createNormalTx());
+            continue;
+        }
+        trans->emplace_back(createParallelTransferTx(
+            "user" + to_string(i * 7 % 10), "user" + to_string(i * 13 % 17), 100));
+    }
+    std::vector<std::shared_ptr<std::vector<std::string>>> criticals;
+    for (auto const& tx : *trans)
+    {
+        criticals.emplace_back(executiveContext->getTxCriticals(*tx));
+    }
+    auto conflict = [&](size_t _i, size_t _j) {
+        if (!criticals[_i] || !criticals[_j])
+        {
+            return true;
+        }
+        for (auto const& critical : *criticals[_i])
+        {
+            if (std::find(criticals[_j]->begin(), criticals[_j]->end(), critical) !=
+                criticals[_j]->end())
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+    // the critical path is the longest chain of the conflicting transactions
+    std::vector<ID> levels(txNum, 1);
+    for (size_t i = 0; i < txNum; ++i)
+    {
+        for (size_t j = 0; j < i; ++j)
+        {
+            if (conflict(j, i))
+            {
+                levels[i] = std::max(levels[i], levels[j] + 1);
+            }
+        }
+    }
+
+    size_t const workerNum = 4;
+    txDag->init(executiveContext, trans, 0, workerNum);
+    BOOST_CHECK_EQUAL(txDag->criticalPath(), *std::max_element(levels.begin(), levels.end()));
+
+    // every transaction is executed after the conflicting ones before it
+    std::unique_ptr<std::atomic<int>[]> executed(new std::atomic<int>[txNum]);
+    for (size_t i = 0; i < txNum; ++i)
+    {
+        executed[i] = 0;
+    }
+    std::atomic<bool> inOrder(true);
+    txDag->setTxExecuteFunc([&](Transaction::Ptr, ID _txId, dev::executive::Executive::Ptr) {
+        for (size_t j = 0; j < _txId; ++j)
+        {
+            if (conflict(j, _txId) && executed[j] != 1)
+            {
+                inOrder = false;
+            }
+        }
+        executed[_txId] += 1;
+        return true;
+    });
+    std::vector<std::thread> workers;
+    for (size_t worker = 0; worker < workerNum; ++worker)
+    {
+        workers.emplace_back([&, worker]() {
+            auto executive = std::make_shared<dev::executive::Executive>();
+            while (!txDag->hasFinished())
+            {
+                txDag->executeUnit(executive, worker);
+            }
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    BOOST_CHECK(inOrder);
+    for (size_t i = 0; i < txNum; ++i)
+    {
+        BOOST_CHECK_EQUAL(executed[i].load(), 1);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace test
@@ -0,0 +1,89 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+
+/**
+ * @brief: unit test for ConflictPacker
+ * @file: ConflictPackerTest.cpp
+ */
+#include <libconsensus/ConflictPacker.h>
+#include <test/tools/libutils/TestOutputHelper.h>
+#include <boost/test/unit_test.hpp>
+
+using namespace dev::consensus;
+
+namespace dev
+{
+namespace test
+{
+BOOST_FIXTURE_TEST_SUITE(ConflictPackerTest, TestOutputHelperFixture)
+
+ConflictPacker::Criticals criticals(std::vector<std::string> const& _fields)
+{
+    return std::make_shared<std::vector<std::string>>(_fields);
+}
+
+BOOST_AUTO_TEST_CASE(testPackByCriticalPath)
+{
+    ConflictPacker packer(2);
+    // the transactions without conflicts are at the first level
+    BOOST_CHECK(packer.tryPack(criticals({"a"})));
+    BOOST_CHECK(packer.tryPack(criticals({"b"})));
+    BOOST_CHECK(packer.tryPack(criticals({"c"})));
+    BOOST_CHECK_EQUAL(packer.criticalPath(), 1);
+
+    // the conflicting transactions are chained
+    BOOST_CHECK_EQUAL(packer.level(criticals({"a", "d"})), 2);
+    BOOST_CHECK(packer.tryPack(criticals({"a", "d"})));
+    BOOST_CHECK_EQUAL(packer.criticalPath(), 2);
+    // deepen the critical path over the maxDepth
+    BOOST_CHECK(!packer.tryPack(criticals({"d"})));
+    BOOST_CHECK(packer.tryPack(criticals({"b"})));
+    BOOST_CHECK(packer.tryPack(criticals({})));
+    BOOST_CHECK_EQUAL(packer.packedTxs(), 6);
+    BOOST_CHECK_EQUAL(packer.parallelism(), 3);
+
+    // the expired transaction is packed regardless of the conflicts
+    BOOST_CHECK(packer.tryPack(criticals({"d"}), true));
+    BOOST_CHECK_EQUAL(packer.criticalPath(), 3);
+
+    packer.reset(1);
+    BOOST_CHECK_EQUAL(packer.criticalPath(), 0);
+    BOOST_CHECK_EQUAL(packer.packedTxs(), 0);
+    BOOST_CHECK(packer.tryPack(criticals({"d"})));
+}
+
+BOOST_AUTO_TEST_CASE(testPackSerialTransaction)
+{
+    ConflictPacker packer(3);
+    BOOST_CHECK(packer.tryPack(criticals({"a"})));
+    BOOST_CHECK(packer.tryPack(criticals({"a"})));
+    BOOST_CHECK(packer.tryPack(criticals({"b"})));
+    // the serial transaction depends on all the previous transactions
+    BOOST_CHECK_EQUAL(packer.level(nullptr), 3);
+    BOOST_CHECK(packer.tryPack(nullptr));
+    // and all the later transactions depend on it, even on the new fields
+    BOOST_CHECK_EQUAL(packer.level(criticals({"c"})), 4);
+    BOOST_CHECK(!packer.tryPack(criticals({"c"})));
+    BOOST_CHECK(!packer.tryPack(nullptr));
+    // the transaction without critical fields conflicts with nothing
+    BOOST_CHECK_EQUAL(packer.level(criticals({})), 1);
+    BOOST_CHECK_EQUAL(packer.criticalPath(), 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace dev
@@ -0,0 +1,204 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief unit test of the asynchronous logger
+ * @file AsyncLog.cpp
+ */
+#include <libdevcore/AsyncLog.h>
+#include <test/tools/libutils/TestOutputHelper.h>
+#include <boost/core/null_deleter.hpp>
+#include <boost/log/core.hpp>
+#include <boost/log/expressions.hpp>
+#include <boost/log/sinks/sync_frontend.hpp>
+#include <boost/log/sinks/text_ostream_backend.hpp>
+#include <boost/test/unit_test.hpp>
+#include <sstream>
+
+using namespace dev;
+using namespace std;
+
+namespace dev
+{
+namespace test
+{
+namespace
+{
+/// collect the records of the file logger
+class LogCollector
+{
+public:
+    using sink_t = boost::log::sinks::synchronous_sink<boost::log::sinks::text_ostream_backend>;
+    LogCollector() : m_sink(boost::make_shared<sink_t>())
+    {
+        m_sink->locked_backend()->add_stream(
+            boost::shared_ptr<std::ostream>(&m_stream, boost::null_deleter()));
+        m_sink->set_filter(boost::log::expressions::attr<std::string>("Channel") == FileLogger);
+        m_sink->set_formatter(
+            boost::log::expressions::stream
+            << boost::log::expressions::if_(boost::log::expressions::has_attr<std::string>(
+                   "GroupId"))[boost::log::expressions::stream
+                               << "[g:" << boost::log::expressions::attr<std::string>("GroupId")
+                               << "]"]
+            << boost::log::expressions::smessage);
+        boost::log::core::get()->add_sink(m_sink);
+    }
+    ~LogCollector() { boost::log::core::get()->remove_sink(m_sink); }
+
+    std::vector<std::string> lines()
+    {
+        m_sink->flush();
+        std::vector<std::string> result;
+        std::string line;
+        std::istringstream input(m_stream.str());
+        while (std::getline(input, line))
+        {
+            result.push_back(line);
+        }
+        return result;
+    }
+
+private:
+    std::ostringstream m_stream;
+    boost::shared_ptr<sink_t> m_sink;
+};
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(AsyncLogTest, TestOutputHelperFixture)
+
+BOOST_AUTO_TEST_CASE(testSyncLog)
+{
+    LogCollector collector;
+    auto level = c_fileLogLevel;
+    setFileLogLevel(LogLevel::INFO);
+    LOG(INFO) << LOG_BADGE("AsyncLogTest") << LOG_KV("hex", std::hex) << 255;
+    LOG(DEBUG) << LOG_BADGE("AsyncLogTest") << LOG_DESC("filtered");
+    LOG(INFO) << LOG_BADGE("AsyncLogTest") << LOG_KV("dec", 255);
+    setFileLogLevel(level);
+    auto lines = collector.lines();
+    BOOST_CHECK_EQUAL(lines.size(), 2);
+    BOOST_CHECK_EQUAL(lines[0], "[AsyncLogTest],hex=ff");
+    // the format of the stream is reset for the next record
+    BOOST_CHECK_EQUAL(lines[1], "[AsyncLogTest],dec=255");
+}
+
+BOOST_AUTO_TEST_CASE(testNestedLog)
+{
+    LogCollector collector;
+    auto inner = []() {
+        LOG(INFO) << LOG_DESC("inner");
+        return 1;
+    };
+    LOG(INFO) << LOG_DESC("outer") << LOG_KV("value", inner());
+    auto lines = collector.lines();
+    BOOST_CHECK_EQUAL(lines.size(), 2);
+    BOOST_CHECK_EQUAL(lines[0], "inner");
+    BOOST_CHECK_EQUAL(lines[1], "outer,value=1");
+}
+
+BOOST_AUTO_TEST_CASE(testAsyncLog)
+{
+    LogCollector collector;
+    size_t const threadNum = 4;
+    size_t const logNum = 1000;
+    auto droppedBefore = AsyncLogger::instance().droppedLogs();
+    AsyncLogger::instance().start(logNum);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadNum; ++i)
+    {
+        threads.emplace_back([i]() {
+            ScopedLogGroupId scopedGroupId(std::to_string(i + 1));
+            for (size_t j = 0; j < logNum; ++j)
+            {
+                LOG(INFO) << LOG_KV("thread", i) << LOG_KV("index", j);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    auto droppedLogs = AsyncLogger::instance().droppedLogs() - droppedBefore;
+    // write the buffered records
+    AsyncLogger::instance().stop();
+    BOOST_CHECK(!AsyncLogger::instance().running());
+
+    std::vector<size_t> nextIndex(threadNum, 0);
+    size_t writtenLogs = 0;
+    for (auto const& line : collector.lines())
+    {
+        size_t thread;
+        size_t index;
+        if (sscanf(line.c_str(), "[g:%*d],thread=%zu,index=%zu", &thread, &index) != 2)
+        {
+            continue;
+        }
+        BOOST_CHECK(line.find("[g:" + std::to_string(thread + 1) + "]") == 0);
+        // the records of a thread are in order
+        BOOST_CHECK(index >= nextIndex[thread]);
+        nextIndex[thread] = index + 1;
+        writtenLogs++;
+    }
+    BOOST_CHECK_EQUAL(writtenLogs + droppedLogs, threadNum * logNum);
+
+    // the records are written directly after stopped
+    LOG(INFO) << LOG_DESC("afterStop");
+    BOOST_CHECK_EQUAL(collector.lines().back(), "afterStop");
+}
+
+BOOST_AUTO_TEST_CASE(testStopWhileLogging)
+{
+    LogCollector collector;
+    size_t const threadNum = 4;
+    auto droppedBefore = AsyncLogger::instance().droppedLogs();
+    AsyncLogger::instance().start(1024);
+    std::atomic_bool logging = {true};
+    std::atomic<size_t> loggedNum = {0};
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadNum; ++i)
+    {
+        threads.emplace_back([&]() {
+            while (logging)
+            {
+                LOG(INFO) << LOG_DESC("stopWhileLogging");
+                loggedNum++;
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    // the records pushed during stop are either drained or written by the callers
+    AsyncLogger::instance().stop();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    logging = false;
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    size_t writtenLogs = 0;
+    for (auto const& line : collector.lines())
+    {
+        if (line == "stopWhileLogging")
+        {
+            writtenLogs++;
+        }
+    }
+    BOOST_CHECK_EQUAL(
+        writtenLogs + AsyncLogger::instance().droppedLogs() - droppedBefore, loggedNum);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace dev
@@ -0,0 +1,106 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief unit test of the block arena
+ * @file BlockArena.cpp
+ */
+#include <libdevcore/BlockArena.h>
+#include <test/tools/libutils/TestOutputHelper.h>
+#include <boost/test/unit_test.hpp>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <thread>
+
+using namespace dev;
+using namespace std;
+
+namespace dev
+{
+namespace test
+{
+BOOST_FIXTURE_TEST_SUITE(BlockArenaTest, TestOutputHelperFixture)
+
+BOOST_AUTO_TEST_CASE(testAllocate)
+{
+    BlockArena arena(1024);
+    for (size_t alignment : {1, 2, 8, 16, 64})
+    {
+        for (size_t size : {1, 7, 100, 300, 5000})
+        {
+            auto memory = arena.allocate(size, alignment);
+            BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(memory) % alignment, 0);
+            // the memory is writable and not overlapped by the later allocations
+            memset(memory, 0x5a, size);
+        }
+    }
+    BOOST_CHECK_EQUAL(arena.allocations(), 25);
+    BOOST_CHECK_EQUAL(arena.allocatedBytes(), 5 * (1 + 7 + 100 + 300 + 5000));
+    BOOST_CHECK(arena.reservedBytes() >= arena.allocatedBytes());
+}
+
+BOOST_AUTO_TEST_CASE(testMakeShared)
+{
+    auto arena = std::make_shared<BlockArena>();
+    std::weak_ptr<BlockArena> weakArena = arena;
+    auto object = makeShared<std::map<std::string, std::string>>(arena);
+    (*object)["key"] = "value";
+    BOOST_CHECK_EQUAL(arena->allocations(), 1);
+
+    // the object outliving the block keeps the arena
+    arena.reset();
+    BOOST_CHECK(!weakArena.expired());
+    BOOST_CHECK_EQUAL((*object)["key"], "value");
+    object.reset();
+    BOOST_CHECK(weakArena.expired());
+
+    // allocated by std::make_shared without the arena
+    auto heapObject = makeShared<std::string>(nullptr, "value");
+    BOOST_CHECK_EQUAL(*heapObject, "value");
+}
+
+BOOST_AUTO_TEST_CASE(testMultiThreads)
+{
+    auto arena = std::make_shared<BlockArena>(4096);
+    size_t const threadNum = 8;
+    size_t const allocNum = 10000;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadNum; ++i)
+    {
+        threads.emplace_back([arena, i]() {
+            std::vector<std::shared_ptr<uint64_t>> values;
+            for (size_t j = 0; j < allocNum; ++j)
+            {
+                values.push_back(makeShared<uint64_t>(arena, i * allocNum + j));
+            }
+            for (size_t j = 0; j < allocNum; ++j)
+            {
+                BOOST_CHECK_EQUAL(*values[j], i * allocNum + j);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    BOOST_CHECK_EQUAL(arena->allocations(), threadNum * allocNum);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace dev
@@ -0,0 +1,148 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief unit test of the shared executor and the strands
+ * @file Executor.cpp
+ */
+#include <libdevcore/Executor.h>
+#include <libdevcore/ThreadPool.h>
+#include <test/tools/libutils/TestOutputHelper.h>
+#include <boost/test/unit_test.hpp>
+
+using namespace dev;
+using namespace std;
+
+namespace dev
+{
+namespace test
+{
+BOOST_FIXTURE_TEST_SUITE(ExecutorTest, TestOutputHelperFixture)
+
+BOOST_AUTO_TEST_CASE(testStrandOrder)
+{
+    Executor executor;
+    executor.start(4);
+    size_t const strandNum = 8;
+    size_t const taskNum = 1000;
+    std::vector<Strand::Ptr> strands;
+    // every strand appends to its own vector without lock, the strand must be serial
+    std::vector<std::vector<size_t>> results(strandNum);
+    std::atomic<size_t> finished = {0};
+    for (size_t i = 0; i < strandNum; ++i)
+    {
+        strands.push_back(executor.createStrand("strand-" + std::to_string(i)));
+    }
+    for (size_t j = 0; j < taskNum; ++j)
+    {
+        for (size_t i = 0; i < strandNum; ++i)
+        {
+            strands[i]->post([&results, &finished, i, j]() {
+                results[i].push_back(j);
+                finished++;
+            });
+        }
+    }
+    while (finished < strandNum * taskNum)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    for (auto const& result : results)
+    {
+        BOOST_CHECK_EQUAL(result.size(), taskNum);
+        for (size_t j = 0; j < result.size(); ++j)
+        {
+            BOOST_CHECK_EQUAL(result[j], j);
+        }
+    }
+    auto statistics = executor.strandStatistics();
+    BOOST_CHECK_EQUAL(statistics.size(), strandNum);
+    for (auto const& strandStatistics : statistics)
+    {
+        BOOST_CHECK_EQUAL(strandStatistics.executedTasks, taskNum);
+        BOOST_CHECK_EQUAL(strandStatistics.queueDepth, 0);
+    }
+    // the statistics are exported by the metrics of the strands
+    auto labels = "strand=\"strand-0\"";
+    BOOST_CHECK_EQUAL(MetricsRegistry::instance()
+                          .counter("bcos_executor_strand_tasks_total", "", labels)
+                          ->value(),
+        taskNum);
+    BOOST_CHECK_EQUAL(MetricsRegistry::instance()
+                          .histogram("bcos_executor_strand_latency_us", "", labels)
+                          ->snapshot()
+                          .count,
+        taskNum);
+    BOOST_CHECK_EQUAL(
+        MetricsRegistry::instance().gauge("bcos_executor_strand_queue_depth", "", labels)->value(),
+        0);
+    executor.stop();
+}
+
+BOOST_AUTO_TEST_CASE(testStrandStop)
+{
+    Executor executor;
+    executor.start(2);
+    auto strand = executor.createStrand("stop-1");
+    std::atomic<size_t> executed = {0};
+    std::atomic_bool started = {false};
+    strand->post([&]() {
+        started = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        executed++;
+    });
+    for (size_t i = 0; i < 10; ++i)
+    {
+        strand->post([&]() { executed++; });
+    }
+    while (!started)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    // wait for the running task and drop the others
+    strand->stop();
+    BOOST_CHECK_EQUAL(executed, 1);
+    // the dropped tasks are no longer waiting
+    BOOST_CHECK_EQUAL(MetricsRegistry::instance()
+                          .gauge("bcos_executor_strand_queue_depth", "", "strand=\"stop-1\"")
+                          ->value(),
+        0);
+    strand->post([&]() { executed++; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    BOOST_CHECK_EQUAL(executed, 1);
+    executor.stop();
+}
+
+BOOST_AUTO_TEST_CASE(testSerialWorker)
+{
+    // the executor of the node is not started, the worker has its own thread
+    auto worker = createSerialWorker("worker-1");
+    std::atomic<size_t> executed = {0};
+    for (size_t i = 0; i < 10; ++i)
+    {
+        worker->enqueue([&]() { executed++; });
+    }
+    while (executed < 10)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    worker->stop();
+    BOOST_CHECK_EQUAL(executed, 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace dev
@@ -0,0 +1,141 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief unit test of the metrics registry
+ * @file Metrics.cpp
+ */
+#include <libdevcore/Metrics.h>
+#include <test/tools/libutils/TestOutputHelper.h>
+#include <boost/test/unit_test.hpp>
+#include <thread>
+
+using namespace dev;
+using namespace std;
+
+namespace dev
+{
+namespace test
+{
+BOOST_FIXTURE_TEST_SUITE(MetricsTest, TestOutputHelperFixture)
+
+BOOST_AUTO_TEST_CASE(testCounterAndGauge)
+{
+    auto counter = MetricsRegistry::instance().counter(
+        "test_metrics_counter_total", "counter of the test", metrics::groupLabel(1));
+    size_t const threadNum = 8;
+    size_t const incNum = 10000;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadNum; ++i)
+    {
+        threads.emplace_back([counter]() {
+            for (size_t j = 0; j < incNum; ++j)
+            {
+                counter->inc();
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    BOOST_CHECK_EQUAL(counter->value(), threadNum * incNum);
+
+    // the same name and labels return the same metric
+    auto sameCounter = MetricsRegistry::instance().counter(
+        "test_metrics_counter_total", "counter of the test", metrics::groupLabel(1));
+    BOOST_CHECK(sameCounter == counter);
+    auto otherCounter = MetricsRegistry::instance().counter(
+        "test_metrics_counter_total", "counter of the test", metrics::groupLabel(2));
+    BOOST_CHECK(otherCounter != counter);
+    BOOST_CHECK_EQUAL(otherCounter->value(), 0);
+
+    auto gauge = MetricsRegistry::instance().gauge("test_metrics_gauge", "gauge of the test");
+    gauge->set(10);
+    gauge->add(-15);
+    BOOST_CHECK_EQUAL(gauge->value(), -5);
+
+    // the name is registered with another type
+    BOOST_CHECK_THROW(
+        MetricsRegistry::instance().gauge("test_metrics_counter_total", "counter of the test"),
+        InvalidMetric);
+}
+
+BOOST_AUTO_TEST_CASE(testHistogramBuckets)
+{
+    // the small values have their own buckets
+    for (uint64_t value = 0; value < 8; ++value)
+    {
+        BOOST_CHECK_EQUAL(MetricHistogram::bucketIndex(value), value);
+        BOOST_CHECK_EQUAL(MetricHistogram::bucketUpperBound(value), value);
+    }
+    // every value is in the range of its bucket and the error is bounded
+    for (uint64_t value = 8; value < (uint64_t(1) << 20); value = value * 9 / 8 + 1)
+    {
+        auto index = MetricHistogram::bucketIndex(value);
+        auto upperBound = MetricHistogram::bucketUpperBound(index);
+        BOOST_CHECK(value <= upperBound);
+        BOOST_CHECK(value > MetricHistogram::bucketUpperBound(index - 1));
+        BOOST_CHECK(upperBound - value <= value / 8);
+    }
+    // the huge values are in the last bucket
+    BOOST_CHECK_EQUAL(
+        MetricHistogram::bucketIndex(uint64_t(1) << 62), metrics::c_histogramBuckets - 1);
+}
+
+BOOST_AUTO_TEST_CASE(testHistogramQuantile)
+{
+    MetricHistogram histogram;
+    BOOST_CHECK_EQUAL(histogram.snapshot().quantile(0.5), 0);
+    for (uint64_t value = 1; value <= 1000; ++value)
+    {
+        histogram.observe(value);
+    }
+    auto snapshot = histogram.snapshot();
+    BOOST_CHECK_EQUAL(snapshot.count, 1000);
+    BOOST_CHECK_EQUAL(snapshot.sum, 500500);
+    auto median = snapshot.quantile(0.5);
+    BOOST_CHECK(median >= 500 && median <= 500 + 500 / 8);
+    auto p99 = snapshot.quantile(0.99);
+    BOOST_CHECK(p99 >= 990 && p99 <= 990 + 990 / 8);
+    BOOST_CHECK(snapshot.quantile(1) >= 1000);
+}
+
+BOOST_AUTO_TEST_CASE(testPrometheusText)
+{
+    auto histogram = MetricsRegistry::instance().histogram(
+        "test_metrics_latency_us", "latency of the test", "method=\"test\"");
+    histogram->observe(100);
+    {
+        ScopedMetricTimer timer(histogram);
+    }
+    MetricsRegistry::instance().counter("test_metrics_text_total", "text of the test")->inc(3);
+
+    auto text = MetricsRegistry::instance().prometheusText();
+    BOOST_CHECK(text.find("# HELP test_metrics_latency_us latency of the test\n") !=
+                std::string::npos);
+    BOOST_CHECK(text.find("# TYPE test_metrics_latency_us summary\n") != std::string::npos);
+    BOOST_CHECK(text.find("test_metrics_latency_us{method=\"test\",quantile=\"0.5\"}") !=
+                std::string::npos);
+    BOOST_CHECK(text.find("test_metrics_latency_us_count{method=\"test\"} 2\n") !=
+                std::string::npos);
+    BOOST_CHECK(text.find("# TYPE test_metrics_text_total counter\n") != std::string::npos);
+    BOOST_CHECK(text.find("test_metrics_text_total 3\n") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace dev
@@ -0,0 +1,148 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief unit test of the fast verify path of SM2
+ * @file SM2.cpp
+ */
+#include "libdevcrypto/CryptoInterface.h"
+#include "libdevcrypto/SM2Signature.h"
+#include "libdevcrypto/sm2/sm2.h"
+#include <libdevcrypto/Common.h>
+#include <libdevcrypto/Exceptions.h>
+#include <test/tools/libutils/TestOutputHelper.h>
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace dev;
+
+namespace dev
+{
+namespace test
+{
+BOOST_FIXTURE_TEST_SUITE(SM_SM2Test, SM_CryptoTestFixture)
+
+static bytes signData(std::shared_ptr<crypto::Signature> _sig)
+{
+    bytes data(_sig->r.begin(), _sig->r.end());
+    data.insert(data.end(), _sig->s.begin(), _sig->s.end());
+    return data;
+}
+
+BOOST_AUTO_TEST_CASE(SM_testFastVerify)
+{
+    KeyPair keyPair = KeyPair::create();
+    h256 hash = crypto::Hash("fastVerify");
+    auto sig = crypto::Sign(keyPair, hash);
+    auto data = signData(sig);
+    // the same result as the legacy verify
+    BOOST_CHECK(SM2::getInstance().verify(
+        data.data(), data.size(), hash.data(), h256::size, keyPair.pub().data()));
+    BOOST_CHECK(SM2::getInstance().fastVerify(data.data(), hash.data(), h256::size, keyPair.pub()));
+    // verify again with the cached public key
+    BOOST_CHECK(SM2::getInstance().fastVerify(data.data(), hash.data(), h256::size, keyPair.pub()));
+
+    // wrong message
+    h256 wrongHash = crypto::Hash("wrong");
+    BOOST_CHECK(
+        !SM2::getInstance().fastVerify(data.data(), wrongHash.data(), h256::size, keyPair.pub()));
+    // wrong public key, and the public key not on the curve
+    BOOST_CHECK(!SM2::getInstance().fastVerify(
+        data.data(), hash.data(), h256::size, KeyPair::create().pub()));
+    BOOST_CHECK(
+        !SM2::getInstance().fastVerify(data.data(), hash.data(), h256::size, Public::random()));
+    // r = 0 and s = 0
+    bytes zeroData(64, 0);
+    BOOST_CHECK(
+        !SM2::getInstance().fastVerify(zeroData.data(), hash.data(), h256::size, keyPair.pub()));
+    // tampered s
+    data[63] ^= 1;
+    BOOST_CHECK(!SM2::getInstance().fastVerify(data.data(), hash.data(), h256::size, keyPair.pub()));
+}
+
+BOOST_AUTO_TEST_CASE(SM_testPrecomputedPublicKeys)
+{
+    KeyPair sealer = KeyPair::create();
+    KeyPair other = KeyPair::create();
+    sm2PrecomputePublicKeys(1, h512s{sealer.pub()});
+    for (size_t i = 0; i < 10; ++i)
+    {
+        h256 hash = crypto::Hash("precompute" + to_string(i));
+        BOOST_CHECK(sm2Verify(sealer.pub(), crypto::Sign(sealer, hash), hash));
+        BOOST_CHECK(sm2Verify(other.pub(), crypto::Sign(other, hash), hash));
+        BOOST_CHECK(!sm2Verify(sealer.pub(), crypto::Sign(other, hash), hash));
+        BOOST_CHECK(!sm2Verify(other.pub(), crypto::Sign(sealer, hash), hash));
+    }
+    // the sealer list changed
+    sm2PrecomputePublicKeys(1, h512s{other.pub()});
+    h256 hash = crypto::Hash("sealerChanged");
+    BOOST_CHECK(sm2Verify(sealer.pub(), crypto::Sign(sealer, hash), hash));
+    BOOST_CHECK(sm2Verify(other.pub(), crypto::Sign(other, hash), hash));
+    sm2PrecomputePublicKeys(1, h512s());
+}
+
+BOOST_AUTO_TEST_CASE(SM_testPrecomputedPublicKeysOfGroups)
+{
+    KeyPair sealer1 = KeyPair::create();
+    KeyPair sealer2 = KeyPair::create();
+    KeyPair shared = KeyPair::create();
+    // every group keeps the tables of its own sealers
+    sm2PrecomputePublicKeys(1, h512s{sealer1.pub(), shared.pub()});
+    sm2PrecomputePublicKeys(2, h512s{sealer2.pub(), shared.pub()});
+    BOOST_CHECK(SM2::getInstance().isPrecomputed(sealer1.pub()));
+    BOOST_CHECK(SM2::getInstance().isPrecomputed(sealer2.pub()));
+    BOOST_CHECK(SM2::getInstance().isPrecomputed(shared.pub()));
+
+    // the table of the public key is kept until no group has it
+    sm2PrecomputePublicKeys(1, h512s{sealer1.pub()});
+    BOOST_CHECK(SM2::getInstance().isPrecomputed(shared.pub()));
+    sm2PrecomputePublicKeys(2, h512s());
+    BOOST_CHECK(!SM2::getInstance().isPrecomputed(shared.pub()));
+    BOOST_CHECK(!SM2::getInstance().isPrecomputed(sealer2.pub()));
+    BOOST_CHECK(SM2::getInstance().isPrecomputed(sealer1.pub()));
+    h256 hash = crypto::Hash("groups");
+    BOOST_CHECK(sm2Verify(sealer1.pub(), crypto::Sign(sealer1, hash), hash));
+    BOOST_CHECK(sm2Verify(shared.pub(), crypto::Sign(shared, hash), hash));
+    sm2PrecomputePublicKeys(1, h512s());
+    BOOST_CHECK(!SM2::getInstance().isPrecomputed(sealer1.pub()));
+}
+
+BOOST_AUTO_TEST_CASE(SM_testBatchVerify)
+{
+    h512s pubKeys;
+    std::vector<std::shared_ptr<crypto::Signature>> sigs;
+    h256s hashes;
+    for (size_t i = 0; i < 20; ++i)
+    {
+        KeyPair keyPair = KeyPair::create();
+        h256 hash = crypto::Hash("batchVerify" + to_string(i));
+        pubKeys.push_back(keyPair.pub());
+        sigs.push_back(crypto::Sign(keyPair, hash));
+        hashes.push_back(hash);
+    }
+    BOOST_CHECK(sm2BatchVerify(pubKeys, sigs, hashes).empty());
+
+    hashes[3] = crypto::Hash("invalid");
+    pubKeys[17] = pubKeys[0];
+    auto invalidIndexes = sm2BatchVerify(pubKeys, sigs, hashes);
+    BOOST_CHECK(invalidIndexes == std::vector<size_t>({3, 17}));
+
+    hashes.pop_back();
+    BOOST_CHECK_THROW(sm2BatchVerify(pubKeys, sigs, hashes), crypto::CryptoException);
+}
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace dev
@@ -168,6 +168,37 @@ BOOST_FIXTURE_TEST_CASE(SM_testCreateTxByRLP, SM_CryptoTestFixture)
     g_BCOSConfig.setSupportedVersion(supportedVersion, version);
 }
 
+BOOST_AUTO_TEST_CASE(testDecodeTxAsView)
+{
+    std::string str = "test transaction";
+    bytes data(str.begin(), str.end());
+    Transaction tx(u256(100), u256(0), u256(100000000), toAddress(KeyPair::create().pub()), data);
+    tx.updateSignature(dev::crypto::Sign(KeyPair::create(), tx.sha3(WithoutSignature)));
+    bytes encodeBytes;
+    tx.encode(encodeBytes, eth::IncludeSignature::WithSignature);
+
+    /// the payload of the decoded transaction refers to the shared buffer
+    auto buffer = std::make_shared<bytes const>(encodeBytes);
+    Transaction viewTx;
+    viewTx.decode(buffer, ref(*buffer));
+    BOOST_CHECK(viewTx.isView());
+    auto dataRef = viewTx.dataRef();
+    BOOST_CHECK(dataRef.data() >= buffer->data());
+    BOOST_CHECK(dataRef.data() + dataRef.size() <= buffer->data() + buffer->size());
+    BOOST_CHECK(viewTx.data() == data);
+    BOOST_CHECK(viewTx.rlp() == encodeBytes);
+    BOOST_CHECK(viewTx.sha3() == tx.sha3());
+    BOOST_CHECK(viewTx == tx);
+
+    /// the detached transaction outlives the buffer
+    viewTx.detach();
+    buffer.reset();
+    BOOST_CHECK(!viewTx.isView());
+    BOOST_CHECK(viewTx.data() == data);
+    BOOST_CHECK(viewTx.rlp() == encodeBytes);
+    BOOST_CHECK(viewTx.sha3() == tx.sha3());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace test
 }  // namespace dev
@@ -203,6 +203,38 @@ BOOST_AUTO_TEST_CASE(testAcquireWithBurstSupported)
     BOOST_CHECK(rateLimiter->lastPermitsUpdateTime() == updatedLastTime + intervalPerPermit);
 }
 
+BOOST_AUTO_TEST_CASE(testReleasePermits)
+{
+    int64_t qpsLimit = 50000;
+    int64_t intervalPerPermit = 1000000 / qpsLimit;
+    int64_t maxPermits = 2000;
+    auto rateLimiter = std::make_shared<RateLimiterTest>(qpsLimit);
+    rateLimiter->setMaxPermitsSize(maxPermits);
+
+    auto now = rateLimiter->lastPermitsUpdateTime() + maxPermits * intervalPerPermit;
+    BOOST_CHECK(rateLimiter->tryAcquire(1000, now) == true);
+    BOOST_CHECK(rateLimiter->currentStoredPermits() == 1000);
+    BOOST_CHECK(rateLimiter->lastPermitsUpdateTime() == now);
+
+    // the released permits are stored again, but no more than maxPermits
+    rateLimiter->releasePermits(500, now);
+    BOOST_CHECK(rateLimiter->currentStoredPermits() == 1500);
+    rateLimiter->releasePermits(1000, now);
+    BOOST_CHECK(rateLimiter->currentStoredPermits() == maxPermits);
+    rateLimiter->releasePermits(0, now);
+    BOOST_CHECK(rateLimiter->currentStoredPermits() == maxPermits);
+
+    // borrow 100 permits from the future
+    BOOST_CHECK(rateLimiter->tryAcquire(maxPermits + 100, now) == true);
+    BOOST_CHECK(rateLimiter->currentStoredPermits() == 0);
+    BOOST_CHECK(rateLimiter->lastPermitsUpdateTime() == now + 100 * intervalPerPermit);
+
+    // the borrowed permits are returned first, the rest are stored
+    rateLimiter->releasePermits(150, now);
+    BOOST_CHECK(rateLimiter->lastPermitsUpdateTime() == now);
+    BOOST_CHECK(rateLimiter->currentStoredPermits() == 50);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace test
 }  // namespace dev
\ No newline at end of file
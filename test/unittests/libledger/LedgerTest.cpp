@@ -262,6 +262,40 @@ BOOST_AUTO_TEST_CASE(testInitLedger)
     BOOST_CHECK(ledgerManager->blockChain(groupId)->number() == 1);
 }
 
+/// test the cold group initialized on the first access
+BOOST_AUTO_TEST_CASE(testColdGroup)
+{
+    TxPoolFixture txpool_creator;
+    KeyPair key_pair = KeyPair::create();
+    std::shared_ptr<LedgerManager> ledgerManager = std::make_shared<LedgerManager>();
+    dev::GROUP_ID groupId = 10;
+    std::string configurationPath = getTestPath().string() + "/fisco-bcos-data/group.10.genesis";
+    size_t loadTimes = 0;
+    ledgerManager->setColdGroupLoader([&](dev::GROUP_ID const& _groupId) {
+        loadTimes++;
+        std::shared_ptr<LedgerInterface> ledger = std::make_shared<FakeLedgerForTest>(
+            txpool_creator.m_topicService, _groupId, key_pair, "");
+        auto ledgerParams = std::make_shared<LedgerParam>();
+        ledgerParams->init(configurationPath);
+        ledger->initLedger(ledgerParams);
+        ledgerManager->insertLedger(_groupId, ledger);
+    });
+    ledgerManager->addColdGroup(groupId);
+    BOOST_CHECK(ledgerManager->isColdGroup(groupId));
+    BOOST_CHECK(ledgerManager->getGroupListForRpc().count(groupId));
+    BOOST_CHECK(ledgerManager->getGroupList().empty());
+    // the unknown group is not loaded
+    BOOST_CHECK(ledgerManager->blockChain(groupId + 1) == nullptr);
+    BOOST_CHECK_EQUAL(loadTimes, 0);
+    // the first access initializes the cold group
+    BOOST_CHECK(ledgerManager->blockChain(groupId) != nullptr);
+    BOOST_CHECK_EQUAL(loadTimes, 1);
+    BOOST_CHECK(!ledgerManager->isColdGroup(groupId));
+    BOOST_CHECK(ledgerManager->txPool(groupId) != nullptr);
+    BOOST_CHECK_EQUAL(loadTimes, 1);
+    BOOST_CHECK(ledgerManager->getGroupList().count(groupId));
+}
+
 void initChannel(std::shared_ptr<LedgerInterface> ledger)
 {
     auto channelServer = std::make_shared<ChannelRPCServer>();
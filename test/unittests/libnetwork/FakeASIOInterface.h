@@ -110,8 +110,8 @@ public:
         }
     }
 
-    void asyncWrite(std::shared_ptr<SocketFace> socket, boost::asio::mutable_buffers_1 buffers,
-        ReadWriteHandler handler) override
+    void asyncWrite(std::shared_ptr<SocketFace> socket,
+        std::vector<boost::asio::const_buffer> buffers, ReadWriteHandler handler) override
     {
         m_ioService->post([socket, buffers, handler]() {
             if (socket->isConnected())
@@ -119,7 +119,7 @@ public:
                 auto fakeSocket = std::dynamic_pointer_cast<FakeSocket>(socket);
                 fakeSocket->write(buffers);
                 boost::system::error_code ec;
-                handler(ec, buffers.size());
+                handler(ec, boost::asio::buffer_size(buffers));
             }
         });
     }
@@ -28,6 +28,7 @@
 
 #include <libdevcore/Assertions.h>
 #include <libp2p/P2PMessage.h>
+#include <libp2p/P2PMessageRC2.h>
 #include <test/tools/libutils/TestOutputHelper.h>
 #include <boost/test/unit_test.hpp>
 
@@ -135,6 +136,45 @@ BOOST_AUTO_TEST_CASE(testMessage)
     BOOST_CHECK_EQUAL("topic", t);*/
 }
 
+BOOST_AUTO_TEST_CASE(testEncodedMessage)
+{
+    auto msg = std::make_shared<p2p::P2PMessageRC2>();
+    msg->setProtocolID(2);
+    msg->setPacketType(3);
+    msg->setSeq(1);
+    std::string s = "hello world!";
+    msg->setBuffer(std::make_shared<bytes>(s.begin(), s.end()));
+
+    auto encoded = msg->encodedMessage();
+    BOOST_CHECK(encoded->header.size() == p2p::P2PMessageRC2::HEADER_LENGTH);
+    BOOST_CHECK_EQUAL(encoded->size(), msg->length());
+    bytes buffer;
+    msg->encode(buffer);
+    bytes joined = encoded->header;
+    joined.insert(joined.end(), encoded->payload->begin(), encoded->payload->end());
+    BOOST_CHECK(joined == buffer);
+
+    /// the payload is shared by all the encoded messages, only the header changes with the seq
+    msg->setSeq(2);
+    auto encodedAgain = msg->encodedMessage();
+    BOOST_CHECK(encodedAgain->payload == encoded->payload);
+    BOOST_CHECK(encodedAgain->header != encoded->header);
+
+    joined = encodedAgain->header;
+    joined.insert(joined.end(), encodedAgain->payload->begin(), encodedAgain->payload->end());
+    auto message = std::make_shared<p2p::P2PMessageRC2>();
+    BOOST_CHECK_EQUAL(message->decode(joined.data(), joined.size()), (ssize_t)joined.size());
+    BOOST_CHECK_EQUAL(message->seq(), 2);
+    BOOST_CHECK_EQUAL(message->packetType(), 3);
+    BOOST_CHECK(*message->buffer() == bytes(s.begin(), s.end()));
+
+    /// a new buffer invalidates the shared payload
+    msg->setBuffer(std::make_shared<bytes>(s.begin(), s.begin() + 5));
+    auto encodedNew = msg->encodedMessage();
+    BOOST_CHECK(encodedNew->payload != encoded->payload);
+    BOOST_CHECK_EQUAL(encodedNew->payload->size(), 5);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace test
 }  // namespace dev
@@ -19,7 +19,9 @@
 #include "libstoragestate/StorageStateFactory.h"
 #include <libblockverifier/ExecutiveContextFactory.h>
 #include <libdevcrypto/Common.h>
+#include <libconfig/GlobalConfigure.h>
 #include <libethcore/ABI.h>
+#include <libprecompiled/CompiledCondition.h>
 #include <libprecompiled/CRUDPrecompiled.h>
 #include <libprecompiled/TableFactoryPrecompiled.h>
 #include <libstorage/MemoryTable.h>
@@ -279,6 +281,163 @@ BOOST_AUTO_TEST_CASE(CRUD)
     BOOST_TEST(funcResult == CODE_UNKNOW_FUNCTION_CALL);
 }
 
+BOOST_AUTO_TEST_CASE(CRUD_ABI)
+{
+    auto version = g_BCOSConfig.version();
+    auto supportedVersion = g_BCOSConfig.supportedVersion();
+    g_BCOSConfig.setSupportedVersion("2.7.0", V2_7_0);
+
+    dev::eth::ContractABI abi;
+    std::string tableName = "t_test_abi", tableName2 = "t_demo_abi", key = "name",
+                valueField = "item_id,item_name";
+    bytes param = abi.abiIn("createTable(string,string,string)", tableName, key, valueField);
+    auto callResult = tableFactoryPrecompiled->call(context, bytesConstRef(&param));
+    bytes out = callResult->execResult();
+    u256 createResult = 0;
+    abi.abiOut(&out, createResult);
+    BOOST_TEST(createResult == 0u);
+
+    // insert
+    std::string insertFunc = "insert(string,string,string[],string[],string)";
+    std::vector<std::string> fields = {"item_id", "name", "item_name"};
+    std::vector<std::string> values = {"1", "fruit", "apple"};
+    param = abi.abiIn(insertFunc, tableName, key, fields, values, std::string(""));
+    callResult = crudPrecompiled->call(context, bytesConstRef(&param));
+    out = callResult->execResult();
+    u256 result = 0;
+    abi.abiOut(&out, result);
+    BOOST_TEST(result == 1u);
+    values = {"2", "fruit", "banana"};
+    param = abi.abiIn(insertFunc, tableName, key, fields, values, std::string(""));
+    callResult = crudPrecompiled->call(context, bytesConstRef(&param));
+    out = callResult->execResult();
+    abi.abiOut(&out, result);
+    BOOST_TEST(result == 1u);
+
+    // insert table not exist
+    param = abi.abiIn(insertFunc, tableName2, key, fields, values, std::string(""));
+    callResult = crudPrecompiled->call(context, bytesConstRef(&param));
+    out = callResult->execResult();
+    abi.abiOut(&out, result);
+    BOOST_TEST(result == CODE_TABLE_NOT_EXIST);
+
+    // insert entry error
+    values = {"1", "fruit"};
+    param = abi.abiIn(insertFunc, tableName, key, fields, values, std::string(""));
+    callResult = crudPrecompiled->call(context, bytesConstRef(&param));
+    out = callResult->execResult();
+    abi.abiOut(&out, result);
+    BOOST_TEST(result == CODE_PARSE_ENTRY_ERROR);
+
+    // select
+    std::string selectFunc = "select(string,string,string[],int256[],string[],string)";
+    std::vector<std::string> conditionFields = {"item_id", "limit"};
+    std::vector<s256> conditionOps = {
+        s256(int(InterfaceOpcode::EQ)), s256(int(InterfaceOpcode::Limit))};
+    std::vector<std::string> conditionValues = {"1", "0,1"};
+    param = abi.abiIn(
+        selectFunc, tableName, key, conditionFields, conditionOps, conditionValues, std::string(""));
+    callResult = crudPrecompiled->call(context, bytesConstRef(&param));
+    out = callResult->execResult();
+    std::vector<std::string> selectFields, selectValues;
+    abi.abiOut(&out, selectFields, selectValues);
+    BOOST_TEST(selectFields.size() > 0u);
+    BOOST_TEST(selectValues.size() == selectFields.size());
+    auto it = std::find(selectFields.begin(), selectFields.end(), "item_name");
+    BOOST_TEST((it != selectFields.end()));
+    BOOST_TEST(selectValues[it - selectFields.begin()] == "apple");
+
+    // select all rows
+    param = abi.abiIn(selectFunc, tableName, key, std::vector<std::string>(),
+        std::vector<s256>(), std::vector<std::string>(), std::string(""));
+    callResult = crudPrecompiled->call(context, bytesConstRef(&param));
+    out = callResult->execResult();
+    abi.abiOut(&out, selectFields, selectValues);
+    BOOST_TEST(selectValues.size() == selectFields.size() * 2);
+
+    // select condition operation undefined
+    conditionOps = {s256(100), s256(int(InterfaceOpcode::Limit))};
+    param = abi.abiIn(
+        selectFunc, tableName, key, conditionFields, conditionOps, conditionValues, std::string(""));
+    callResult = crudPrecompiled->call(context, bytesConstRef(&param));
+    out = callResult->execResult();
+    abi.abiOut(&out, result);
+    BOOST_TEST(result == CODE_CONDITION_OPERATION_UNDEFINED);
+
+    // select limit error
+    conditionOps = {s256(int(InterfaceOpcode::EQ)), s256(int(InterfaceOpcode::Limit))};
+    conditionValues = {"1", "0"};
+    param = abi.abiIn(
+        selectFunc, tableName, key, conditionFields, conditionOps, conditionValues, std::string(""));
+    callResult = crudPrecompiled->call(context, bytesConstRef(&param));
+    out = callResult->execResult();
+    abi.abiOut(&out, result);
+    BOOST_TEST(result == CODE_PARSE_CONDITION_ERROR);
+
+    // update
+    std::string updateFunc =
+        "update(string,string,string[],string[],string[],int256[],string[],string)";
+    fields = {"item_name"};
+    values = {"orange"};
+    conditionFields = {"item_id"};
+    conditionOps = {s256(int(InterfaceOpcode::EQ))};
+    conditionValues = {"1"};
+    param = abi.abiIn(updateFunc, tableName, key, fields, values, conditionFields, conditionOps,
+        conditionValues, std::string(""));
+    callResult = crudPrecompiled->call(context, bytesConstRef(&param));
+    out = callResult->execResult();
+    abi.abiOut(&out, result);
+    BOOST_TEST(result == 1u);
+
+    // remove
+    std::string removeFunc = "remove(string,string,string[],int256[],string[],string)";
+    conditionFields = {"item_name"};
+    conditionValues = {"orange"};
+    param = abi.abiIn(
+        removeFunc, tableName, key, conditionFields, conditionOps, conditionValues, std::string(""));
+    callResult = crudPrecompiled->call(context, bytesConstRef(&param));
+    out = callResult->execResult();
+    abi.abiOut(&out, result);
+    BOOST_TEST(result == 1u);
+
+    // the ABI interface is not supported before 2.7.0
+    g_BCOSConfig.setSupportedVersion("2.6.0", V2_6_0);
+    callResult = crudPrecompiled->call(context, bytesConstRef(&param));
+    out = callResult->execResult();
+    abi.abiOut(&out, result);
+    BOOST_TEST(result == CODE_UNKNOW_FUNCTION_CALL);
+
+    g_BCOSConfig.setSupportedVersion(supportedVersion, version);
+}
+
+BOOST_AUTO_TEST_CASE(compiledCache)
+{
+    clearCompiledCache();
+    std::string conditionStr = "{\"item_id\":{\"eq\":\"1\"},\"limit\":{\"limit\":\"0,1\"}}";
+    auto condition = compileCondition(conditionStr);
+    BOOST_TEST(condition->errorCode == CODE_SUCCESS);
+    BOOST_TEST(condition->operations.size() == 2u);
+    BOOST_TEST(condition->operations[0].op == InterfaceOpcode::EQ);
+    BOOST_TEST(condition->operations[1].op == InterfaceOpcode::Limit);
+    BOOST_TEST(condition->operations[1].count == 1);
+    BOOST_TEST(compileCondition(conditionStr) == condition);
+    BOOST_TEST(compiledCacheSize() == 1u);
+
+    auto undefined = compileCondition(std::string("{\"item_id\":{\"eqq\":\"1\"}}"));
+    BOOST_TEST(undefined->errorCode == CODE_CONDITION_OPERATION_UNDEFINED);
+
+    std::string entryStr = "{\"item_id\":\"1\",\"name\":\"fruit\",\"item_name\":\"apple\"}";
+    auto entry = compileEntry(entryStr);
+    BOOST_TEST(entry->errorCode == CODE_SUCCESS);
+    BOOST_TEST(entry->fields.size() == 3u);
+    BOOST_TEST(compileEntry(entryStr) == entry);
+    BOOST_TEST(compileEntry(std::string("{\"item_id\"1\"}"))->errorCode == CODE_PARSE_ENTRY_ERROR);
+    BOOST_TEST(compiledCacheSize() == 4u);
+
+    clearCompiledCache();
+    BOOST_TEST(compiledCacheSize() == 0u);
+}
+
 BOOST_AUTO_TEST_CASE(toString)
 {
     BOOST_TEST(crudPrecompiled->toString() == "CRUD");
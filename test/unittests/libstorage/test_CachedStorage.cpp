@@ -24,6 +24,7 @@
 #include "MemoryStorage2.h"
 #include <libdevcore/FixedHash.h>
 #include <libstorage/CachedStorage.h>
+#include <libstorage/CompressedCache.h>
 #include <libstorage/StorageException.h>
 #include <libstorage/Table.h>
 #include <tbb/parallel_for.h>
@@ -208,6 +209,13 @@ public:
     tbb::concurrent_unordered_map<std::string, Entry::Ptr> tableKey2Entry;
 };
 
+class EvictableCachedStorage : public CachedStorage
+{
+public:
+    using CachedStorage::evictCache;
+    using CachedStorage::mruSize;
+};
+
 struct CachedStorageFixture
 {
     CachedStorageFixture()
@@ -585,6 +593,219 @@ BOOST_AUTO_TEST_CASE(checkAndClear)
     select_condition_invoker();
 }
 
+BOOST_AUTO_TEST_CASE(mergeTasks)
+{
+    auto tableInfo = std::make_shared<TableInfo>();
+    tableInfo->key = "Name";
+    tableInfo->name = "t_test";
+    auto createEntry = [](uint64_t _id, const std::string& _value) {
+        auto entry = std::make_shared<Entry>();
+        entry->setID(_id);
+        entry->setField("Name", "LiSi");
+        entry->setField("value", _value);
+        return entry;
+    };
+
+    std::vector<Task::Ptr> tasks;
+    for (int64_t num = 1; num <= 3; ++num)
+    {
+        auto task = std::make_shared<Task>();
+        task->num = num;
+        task->datas = std::make_shared<std::vector<TableData::Ptr>>();
+        auto data = std::make_shared<TableData>();
+        data->info = tableInfo;
+        // every block inserts a new entry and updates the entry inserted by the previous block
+        data->newEntries->addEntry(createEntry(num, "new" + std::to_string(num)));
+        if (num > 1)
+        {
+            data->dirtyEntries->addEntry(createEntry(num - 1, "dirty" + std::to_string(num)));
+        }
+        // the entry 100 is updated by every block
+        data->dirtyEntries->addEntry(createEntry(100, "dirty" + std::to_string(num)));
+        task->datas->push_back(data);
+        tasks.push_back(task);
+    }
+
+    auto task = CachedStorage::mergeTasks(tasks);
+    BOOST_TEST(task->num == 3);
+    BOOST_TEST(task->datas->size() == 1u);
+    auto data = (*(task->datas))[0];
+    BOOST_TEST(data->newEntries->size() == 3u);
+    BOOST_TEST(data->newEntries->get(0)->getField("value") == "dirty2");
+    BOOST_TEST(data->newEntries->get(1)->getField("value") == "dirty3");
+    BOOST_TEST(data->newEntries->get(2)->getField("value") == "new3");
+    BOOST_TEST(data->dirtyEntries->size() == 1u);
+    BOOST_TEST(data->dirtyEntries->get(0)->getID() == 100u);
+    BOOST_TEST(data->dirtyEntries->get(0)->getField("value") == "dirty3");
+}
+
+BOOST_AUTO_TEST_CASE(clockShard)
+{
+    ClockShard shard;
+    BOOST_TEST(shard.sweep(10).empty());
+
+    shard.touch("t_test", "a");
+    shard.touch("t_test", "b");
+    shard.touch("t_test", "c");
+    shard.touch("t_test", "a");
+    BOOST_TEST(shard.size() == 3u);
+
+    // the referenced key gets a second chance
+    auto keys = shard.sweep(2);
+    BOOST_TEST(keys.size() == 2u);
+    BOOST_TEST(keys[0].second == "b");
+    BOOST_TEST(keys[1].second == "c");
+
+    // the new key is inserted behind the hand
+    shard.touch("t_test", "d");
+    keys = shard.sweep(10);
+    BOOST_TEST(keys.size() == 2u);
+    BOOST_TEST(keys[0].second == "a");
+    BOOST_TEST(keys[1].second == "d");
+    BOOST_TEST(shard.size() == 0u);
+
+    // the hand moves on if the key under it is erased
+    shard.touch("t_test", "e");
+    shard.touch("t_test", "f");
+    shard.erase("t_test", "e");
+    shard.erase("t_test", "g");
+    BOOST_TEST(shard.size() == 1u);
+    keys = shard.sweep(10);
+    BOOST_TEST(keys.size() == 1u);
+    BOOST_TEST(keys[0].second == "f");
+}
+
+BOOST_AUTO_TEST_CASE(compressedCache)
+{
+    auto createEntries = [](size_t _id) {
+        auto entries = std::make_shared<Entries>();
+        for (size_t i = 0; i < 3; ++i)
+        {
+            Entry::Ptr entry = std::make_shared<Entry>();
+            entry->setID(_id + i);
+            entry->setNum(_id);
+            entry->setField("Name", "LiSi" + boost::lexical_cast<std::string>(_id));
+            entry->setField("value", std::string(100, 'a' + i));
+            entry->setStatus(i == 2 ? Entry::Status::DELETED : Entry::Status::NORMAL);
+            entry->setDirty(false);
+            entries->addEntry(entry);
+        }
+        return entries;
+    };
+
+    auto compressedCache = std::make_shared<CompressedCache>(1024);
+    auto entries = createEntries(1);
+    compressedCache->put("t_test", "1", entries);
+    BOOST_TEST(compressedCache->size() == 1u);
+    // the repeated values are compressed
+    BOOST_TEST(compressedCache->capacity() < 300);
+
+    auto takeEntries = compressedCache->take("t_test", "1");
+    BOOST_TEST(takeEntries != nullptr);
+    BOOST_TEST(takeEntries->size() == entries->size());
+    for (size_t i = 0; i < entries->size(); ++i)
+    {
+        auto entry = entries->get(i);
+        auto takeEntry = takeEntries->get(i);
+        BOOST_TEST(takeEntry->getID() == entry->getID());
+        BOOST_TEST(takeEntry->num() == entry->num());
+        BOOST_TEST(takeEntry->getStatus() == entry->getStatus());
+        BOOST_TEST(takeEntry->dirty() == entry->dirty());
+        BOOST_TEST(takeEntry->getField("Name") == entry->getField("Name"));
+        BOOST_TEST(takeEntry->getField("value") == entry->getField("value"));
+        BOOST_TEST(takeEntry->capacity() == entry->capacity());
+    }
+    // the promoted entries are removed from the compressed tier
+    BOOST_TEST(compressedCache->take("t_test", "1") == nullptr);
+    BOOST_TEST(compressedCache->size() == 0u);
+    BOOST_TEST(compressedCache->capacity() == 0);
+
+    // the oldest entries are evicted when exceeding the capacity
+    for (size_t i = 0; i < 100; ++i)
+    {
+        compressedCache->put(
+            "t_test", boost::lexical_cast<std::string>(i), createEntries(i));
+        BOOST_TEST(compressedCache->capacity() <= compressedCache->maxCapacity());
+    }
+    BOOST_TEST(compressedCache->size() < 100u);
+    BOOST_TEST(compressedCache->take("t_test", "0") == nullptr);
+    BOOST_TEST(compressedCache->take("t_test", "99") != nullptr);
+
+    compressedCache->put("t_test", "1", createEntries(1));
+    compressedCache->erase("t_test", "1");
+    BOOST_TEST(compressedCache->take("t_test", "1") == nullptr);
+
+    // the rows joined into the same string by "_" are different keys
+    compressedCache->put("_user_t", "x_y", createEntries(1));
+    BOOST_TEST(compressedCache->take("_user_t_x", "y") == nullptr);
+    compressedCache->put("_user_t_x", "y", createEntries(2));
+    auto xyEntries = compressedCache->take("_user_t", "x_y");
+    BOOST_TEST(xyEntries != nullptr);
+    BOOST_TEST(xyEntries->get(0)->getField("Name") == "LiSi1");
+    auto yEntries = compressedCache->take("_user_t_x", "y");
+    BOOST_TEST(yEntries != nullptr);
+    BOOST_TEST(yEntries->get(0)->getField("Name") == "LiSi2");
+}
+
+BOOST_AUTO_TEST_CASE(evictRemovedCache)
+{
+    auto storage = std::make_shared<EvictableCachedStorage>();
+    storage->setBackend(mockStorage);
+    storage->setMaxCompressedCapacity(1024 * 1024);
+    auto tableInfo = std::make_shared<TableInfo>();
+    tableInfo->key = "Name";
+    tableInfo->name = "t_test";
+
+    // the key swept out of a shard without a cache leaves nothing in the compressed tier
+    BOOST_TEST(storage->evictCache("t_test", "LiSi"));
+    auto entries = storage->select(0, tableInfo, "LiSi", std::make_shared<Condition>());
+    BOOST_TEST(entries->size() == 1u);
+    BOOST_TEST(entries->get(0)->getField("id") == "1");
+
+    // the evicted rows are promoted from the compressed tier
+    BOOST_TEST(storage->evictCache("t_test", "LiSi"));
+    BOOST_TEST(storage->evictCache("t_test", "LiSi"));
+    entries = storage->select(0, tableInfo, "LiSi", std::make_shared<Condition>());
+    BOOST_TEST(entries->size() == 1u);
+    BOOST_TEST(entries->get(0)->getField("id") == "1");
+    storage->stop();
+}
+
+BOOST_AUTO_TEST_CASE(evictTouchedAfterSweep)
+{
+    auto storage = std::make_shared<EvictableCachedStorage>();
+    storage->setBackend(mockStorage);
+    storage->setMaxCompressedCapacity(1024 * 1024);
+    auto tableInfo = std::make_shared<TableInfo>();
+    tableInfo->key = "Name";
+    tableInfo->name = "t_test";
+
+    std::atomic<bool> running = {true};
+    std::thread selectThread([&]() {
+        while (running)
+        {
+            auto entries = storage->select(0, tableInfo, "LiSi", std::make_shared<Condition>());
+            BOOST_CHECK(entries->size() == 1u);
+        }
+    });
+    // the select touches the key again between the sweep and the eviction
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        storage->select(0, tableInfo, "LiSi", std::make_shared<Condition>());
+        BOOST_TEST(storage->evictCache("t_test", "LiSi"));
+    }
+    running = false;
+    selectThread.join();
+
+    // no key is left in the shards without a cache
+    BOOST_TEST(storage->evictCache("t_test", "LiSi"));
+    BOOST_TEST(storage->mruSize() == 0u);
+    auto entries = storage->select(0, tableInfo, "LiSi", std::make_shared<Condition>());
+    BOOST_TEST(entries->size() == 1u);
+    BOOST_TEST(entries->get(0)->getField("id") == "1");
+    storage->stop();
+}
+
 BOOST_AUTO_TEST_CASE(dirtyAndNew)
 {
 #if 0
@@ -109,6 +109,59 @@ BOOST_AUTO_TEST_CASE(update_select)
     g_BCOSConfig.setSupportedVersion(m_supportedVersion, m_version);
 }
 
+BOOST_AUTO_TEST_CASE(entryHash)
+{
+    auto version = g_BCOSConfig.version();
+    auto supportedVersion = g_BCOSConfig.supportedVersion();
+    g_BCOSConfig.setSupportedVersion("2.7.0", V2_7_0);
+
+    auto createTable = [this]() {
+        auto table = std::make_shared<MemoryTable2>();
+        table->setTableInfo(m_table->tableInfo());
+        table->setStateStorage(std::make_shared<MemoryStorage2>());
+        table->setRecorder(
+            [&](Table::Ptr, Change::Kind, string const&, vector<Change::Record>&) {});
+        return table;
+    };
+    auto insert = [](MemoryTable2::Ptr _table, std::string const& _key,
+                      std::string const& _value) {
+        auto entry = std::make_shared<storage::Entry>();
+        entry->setField("value", _value);
+        _table->insert(_key, entry);
+    };
+    auto table1 = createTable();
+    auto table2 = createTable();
+    for (size_t i = 0; i < 100; ++i)
+    {
+        insert(table1, "key" + to_string(i % 10), to_string(i));
+        insert(table2, "key" + to_string((99 - i) % 10), to_string(99 - i));
+    }
+    // the hash and the order of the entries are independent of the order of the inserting
+    BOOST_CHECK(table1->hash() != h256());
+    BOOST_CHECK_EQUAL(table1->hash(), table2->hash());
+    auto data1 = table1->dump();
+    auto data2 = table2->dump();
+    BOOST_CHECK_EQUAL(data1->newEntries->size(), 100u);
+    for (size_t i = 0; i < data1->newEntries->size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(data1->newEntries->get(i)->getField("value"),
+            data2->newEntries->get(i)->getField("value"));
+    }
+
+    // the field boundaries are in the digest
+    auto table3 = createTable();
+    auto table4 = createTable();
+    insert(table3, "a", "valueb");
+    insert(table4, "avalue", "b");
+    BOOST_CHECK(table3->hash() != table4->hash());
+
+    // the hash changes with the entries
+    auto hash = table1->hash();
+    insert(table1, "key0", "100");
+    BOOST_CHECK(table1->hash() != hash);
+
+    g_BCOSConfig.setSupportedVersion(supportedVersion, version);
+}
 
 BOOST_AUTO_TEST_SUITE_END()
 
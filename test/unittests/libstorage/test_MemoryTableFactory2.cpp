@@ -21,6 +21,7 @@
 #include <libstorage/MemoryTable.h>
 #include <libstorage/MemoryTableFactory2.h>
 #include <libstorage/Storage.h>
+#include <libstorage/StorageException.h>
 #include <libstorage/Table.h>
 #include <tbb/parallel_for.h>
 #include <boost/test/unit_test.hpp>
@@ -60,6 +61,14 @@ struct MemoryTableFactoryFixture2
         BOOST_TEST_TRUE(memoryDBFactory->stateStorage() == mockAMOPDB);
     }
 
+    // the system tables of the factory depend on the supported version
+    void resetFactory()
+    {
+        auto stateStorage = memoryDBFactory->stateStorage();
+        memoryDBFactory = std::make_shared<dev::storage::MemoryTableFactory2>();
+        memoryDBFactory->setStateStorage(stateStorage);
+    }
+
     dev::storage::MemoryTableFactory2::Ptr memoryDBFactory;
 };
 
@@ -264,6 +273,157 @@ BOOST_AUTO_TEST_CASE(init)
     }
 }
 
+BOOST_AUTO_TEST_CASE(createIndexedTable)
+{
+    auto version = g_BCOSConfig.version();
+    auto supportedVersion = g_BCOSConfig.supportedVersion();
+    g_BCOSConfig.setSupportedVersion("2.7.0", V2_7_0);
+    resetFactory();
+
+    BOOST_CHECK_THROW(memoryDBFactory->createIndexedTable(
+                          "t_index", "name", "item,price", {"count"}, false),
+        StorageException);
+    auto table =
+        memoryDBFactory->createIndexedTable("t_index", "name", "item,price", {"item"}, false);
+    BOOST_TEST(table != nullptr);
+    BOOST_TEST(table->tableInfo()->indices.size() == 1u);
+    BOOST_TEST(memoryDBFactory->openTable(dev::storage::MemoryTableFactory2::getIndexTableName(
+                   "t_index", "item")) != nullptr);
+    BOOST_TEST(memoryDBFactory->createIndexedTable(
+                   "t_index", "name", "item,price", {"item"}, false) == nullptr);
+
+    auto entry = table->newEntry();
+    entry->setField("item", "apple");
+    entry->setField("price", "1");
+    table->insert("fruit", entry);
+    entry = table->newEntry();
+    entry->setField("item", "pear");
+    entry->setField("price", "2");
+    table->insert("fruit", entry);
+
+    auto selectItem = [&](const std::string& _item) {
+        auto condition = table->newCondition();
+        condition->EQ("item", _item);
+        return table->select("fruit", condition)->size();
+    };
+    BOOST_TEST(selectItem("apple") == 1u);
+    BOOST_TEST(selectItem("pear") == 1u);
+    BOOST_TEST(selectItem("peach") == 0u);
+    BOOST_TEST(table->select("fruit", table->newCondition())->size() == 2u);
+
+    // update the indexed field
+    entry = table->newEntry();
+    entry->setField("item", "peach");
+    auto condition = table->newCondition();
+    condition->EQ("item", "apple");
+    BOOST_TEST(table->update("fruit", entry, condition) == 1);
+    BOOST_TEST(selectItem("apple") == 0u);
+    BOOST_TEST(selectItem("peach") == 1u);
+
+    // remove and rollback
+    auto savepoint = memoryDBFactory->savepoint();
+    condition = table->newCondition();
+    condition->EQ("item", "peach");
+    BOOST_TEST(table->remove("fruit", condition) == 1);
+    BOOST_TEST(selectItem("peach") == 0u);
+    memoryDBFactory->rollback(savepoint);
+    BOOST_TEST(selectItem("peach") == 1u);
+    BOOST_TEST(selectItem("pear") == 1u);
+
+    g_BCOSConfig.setSupportedVersion(supportedVersion, version);
+}
+
+BOOST_AUTO_TEST_CASE(indicesCache)
+{
+    auto version = g_BCOSConfig.version();
+    auto supportedVersion = g_BCOSConfig.supportedVersion();
+    g_BCOSConfig.setSupportedVersion("2.7.0", V2_7_0);
+    resetFactory();
+    auto indicesCache = std::make_shared<TableIndicesCache>();
+    memoryDBFactory->setIndicesCache(indicesCache);
+
+    auto table =
+        memoryDBFactory->createIndexedTable("t_cached", "name", "item,price", {"item"}, false);
+    BOOST_TEST(table->tableInfo()->indices.size() == 1u);
+    TableIndicesCache::Indices indices;
+    BOOST_TEST(indicesCache->get("t_cached", indices));
+    BOOST_TEST(indices.size() == 1u);
+    BOOST_TEST(indices[0].first == "item");
+
+    // the stale indices are dropped when the table is created
+    indicesCache->set("t_plain", indices);
+    table = memoryDBFactory->createTable("t_plain", "name", "item,price", false);
+    BOOST_TEST(table->tableInfo()->indices.empty());
+    BOOST_TEST(indicesCache->get("t_plain", indices));
+    BOOST_TEST(indices.empty());
+
+    // the contract tables never look up the indices
+    table = memoryDBFactory->createTable("c_contract", "key", "value", false);
+    BOOST_TEST(table != nullptr);
+    BOOST_TEST(!indicesCache->get("c_contract", indices));
+
+    g_BCOSConfig.setSupportedVersion(supportedVersion, version);
+}
+
+BOOST_AUTO_TEST_CASE(indexAbsentField)
+{
+    auto version = g_BCOSConfig.version();
+    auto supportedVersion = g_BCOSConfig.supportedVersion();
+    g_BCOSConfig.setSupportedVersion("2.7.0", V2_7_0);
+    resetFactory();
+
+    // the index answers the EQ conditions as the rows are scanned by Condition::process
+    auto indexed = memoryDBFactory->createIndexedTable(
+        "t_absent", "name", "item,price,item_", {"item", "item_"}, false);
+    auto plain = memoryDBFactory->createTable("t_plain", "name", "item,price,item_", false);
+    for (auto table : {indexed, plain})
+    {
+        auto entry = table->newEntry();
+        entry->setField("price", "1");
+        entry->setField("item_", "apple");
+        table->insert("fruit", entry);
+    }
+    auto selectItem = [&](Table::Ptr _table, const std::string& _field, const std::string& _item) {
+        auto condition = _table->newCondition();
+        condition->EQ(_field, _item);
+        return _table->select("fruit", condition)->size();
+    };
+    // the row without the field
+    BOOST_TEST(selectItem(indexed, "item", "") == selectItem(plain, "item", ""));
+    BOOST_TEST(selectItem(indexed, "item", "apple") == selectItem(plain, "item", "apple"));
+    // the condition on the field not hashed is skipped
+    BOOST_TEST(selectItem(plain, "item_", "pear") == 1u);
+    BOOST_TEST(selectItem(indexed, "item_", "pear") == 1u);
+
+    // the field is set on the row without it
+    for (auto table : {indexed, plain})
+    {
+        auto entry = table->newEntry();
+        entry->setField("item", "pear");
+        BOOST_TEST(table->update("fruit", entry, table->newCondition()) == 1);
+    }
+    BOOST_TEST(selectItem(indexed, "item", "pear") == 1u);
+    BOOST_TEST(selectItem(indexed, "item", "apple") == selectItem(plain, "item", "apple"));
+
+    g_BCOSConfig.setSupportedVersion(supportedVersion, version);
+}
+
+BOOST_AUTO_TEST_CASE(indicesTableVersion)
+{
+    auto version = g_BCOSConfig.version();
+    auto supportedVersion = g_BCOSConfig.supportedVersion();
+    g_BCOSConfig.setSupportedVersion("2.6.0", V2_6_0);
+    resetFactory();
+    // not a system table before the indices are supported
+    BOOST_TEST(memoryDBFactory->openTable(SYS_TABLE_INDICES) == nullptr);
+
+    g_BCOSConfig.setSupportedVersion("2.7.0", V2_7_0);
+    resetFactory();
+    BOOST_TEST(memoryDBFactory->openTable(SYS_TABLE_INDICES) != nullptr);
+
+    g_BCOSConfig.setSupportedVersion(supportedVersion, version);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace test_MemoryTableFactory2
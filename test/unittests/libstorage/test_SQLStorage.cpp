@@ -23,6 +23,7 @@
 
 #include <libchannelserver/ChannelRPCServer.h>
 #include <libdevcore/FixedHash.h>
+#include <libstorage/AMDBCodec.h>
 #include <libstorage/Common.h>
 #include <libstorage/SQLStorage.h>
 #include <libstorage/StorageException.h>
@@ -43,6 +44,23 @@ public:
     {
         BOOST_TEST(timeout > 0);
 
+        bytes responseData;
+        Json::Value responseJson;
+        bytesConstRef requestData(message->data(), message->dataSize());
+        if (AMDBCodec::isBinaryFrame(requestData))
+        {
+            BOOST_CHECK(binary);
+            committed.clear();
+            AMDBCodec::decodeCommit(requestData, committed);
+            if (binaryCommitResult)
+            {
+                AMDBCodec::encodeCommitResult(0, committed.size(), responseData);
+            }
+            responseJson["result"]["count"] = (Json::UInt64)committed.size();
+            responseJson["code"] = 0;
+            return response(message, responseJson, responseData);
+        }
+
         std::string jsonStr(message->data(), message->data() + message->dataSize());
 
         std::stringstream ssIn;
@@ -51,8 +69,12 @@ public:
         Json::Value requestJson;
         ssIn >> requestJson;
 
-        Json::Value responseJson;
-
+        // the proxy supporting the binary framing
+        if (requestJson["op"].asString() == "protocol" && binary)
+        {
+            responseJson["code"] = 0;
+            responseJson["result"]["version"] = AMDBCodec::c_binaryProtocolVersion;
+        }
 
         if (requestJson["op"].asString() == "select")
         {
@@ -102,6 +124,17 @@ public:
             {
                 responseJson["code"] = 0;
             }
+            else if (requestJson["params"]["format"].asString() == "binary")
+            {
+                Entries entries;
+                auto entry = std::make_shared<Entry>();
+                entry->setField("Name", "LiSi");
+                entry->setField("id", "1");
+                entry->setID(1);
+                entry->setNum(1);
+                entries.addEntry(entry);
+                AMDBCodec::encodeRows(0, entries, responseData);
+            }
             else
             {
                 responseJson["code"] = 0;
@@ -133,18 +166,32 @@ public:
             responseJson["code"] = 0;
         }
 
-        std::string responseStr = responseJson.toStyledString();
-        LOG(TRACE) << "AMOP Storage response:" << responseStr;
+        return response(message, responseJson, responseData);
+    }
+
+    dev::channel::TopicChannelMessage::Ptr response(dev::channel::TopicChannelMessage::Ptr message,
+        const Json::Value& responseJson, bytes& responseData)
+    {
+        if (responseData.empty())
+        {
+            std::string responseStr = responseJson.toStyledString();
+            LOG(TRACE) << "AMOP Storage response:" << responseStr;
+            responseData.assign(responseStr.begin(), responseStr.end());
+        }
 
         auto response = std::make_shared<dev::channel::TopicChannelMessage>();
         response->setResult(0);
         response->setSeq(message->seq());
         response->setType(dev::channel::AMOP_RESPONSE);
-        response->setTopicData(
-            message->topic(), (const unsigned char*)responseStr.data(), responseStr.size());
+        response->setTopicData(message->topic(), responseData.data(), responseData.size());
 
         return response;
     }
+
+    bool binary = false;
+    // answer the commit with the binary frame instead of json
+    bool binaryCommitResult = false;
+    std::vector<TableData::Ptr> committed;
 };
 
 struct SQLStorageFixture
@@ -152,8 +199,7 @@ struct SQLStorageFixture
     SQLStorageFixture()
     {
         sqlStorage = std::make_shared<dev::storage::SQLStorage>();
-        std::shared_ptr<MockChannelRPCServer> mockChannel =
-            std::make_shared<MockChannelRPCServer>();
+        mockChannel = std::make_shared<MockChannelRPCServer>();
         sqlStorage->setChannelRPCServer(mockChannel);
         sqlStorage->setMaxRetry(20);
     }
@@ -167,6 +213,7 @@ struct SQLStorageFixture
         return entries;
     }
     dev::storage::SQLStorage::Ptr sqlStorage;
+    std::shared_ptr<MockChannelRPCServer> mockChannel;
 };
 
 BOOST_FIXTURE_TEST_SUITE(SQLStorageTest, SQLStorageFixture)
@@ -232,6 +279,143 @@ BOOST_AUTO_TEST_CASE(commit)
     tableInfo->name = table;
     entries = sqlStorage->select(num, tableInfo, key, std::make_shared<Condition>());
     BOOST_CHECK_EQUAL(entries->size(), 1u);
+    // the proxy doesn't support the binary framing
+    BOOST_CHECK(mockChannel->committed.empty());
+}
+
+BOOST_AUTO_TEST_CASE(binaryCommit)
+{
+    mockChannel->binary = true;
+    std::vector<dev::storage::TableData::Ptr> datas;
+    auto tableData = std::make_shared<dev::storage::TableData>();
+    tableData->info->name = "t_test";
+    tableData->info->key = "Name";
+    tableData->info->fields.push_back("id");
+    tableData->newEntries = getEntries();
+    auto entry = std::make_shared<Entry>();
+    entry->setField("Name", "ZhangSan");
+    entry->setID(2);
+    tableData->dirtyEntries->addEntry(entry);
+    datas.push_back(tableData);
+    // the empty table is not committed
+    datas.push_back(std::make_shared<dev::storage::TableData>());
+    BOOST_CHECK_EQUAL(sqlStorage->commit(1, datas), 1u);
+
+    BOOST_CHECK_EQUAL(mockChannel->committed.size(), 1u);
+    auto committed = mockChannel->committed[0];
+    BOOST_CHECK_EQUAL(committed->info->name, "t_test");
+    BOOST_CHECK_EQUAL(committed->newEntries->size(), 2u);
+    BOOST_CHECK_EQUAL(committed->newEntries->get(0)->getField("Name"), "ZhangSan");
+    BOOST_CHECK_EQUAL(committed->newEntries->get(0)->getID(), 2u);
+    BOOST_CHECK_EQUAL(committed->newEntries->get(0)->getField("id"), "");
+    BOOST_CHECK_EQUAL(committed->newEntries->get(1)->getField("Name"), "LiSi");
+    BOOST_CHECK_EQUAL(committed->newEntries->get(1)->getField("id"), "1");
+
+    auto tableInfo = std::make_shared<TableInfo>();
+    tableInfo->name = "t_test";
+    auto entries = sqlStorage->select(1, tableInfo, "LiSi", std::make_shared<Condition>());
+    BOOST_CHECK_EQUAL(entries->size(), 1u);
+    BOOST_CHECK_EQUAL(entries->get(0)->getField("Name"), "LiSi");
+    BOOST_CHECK_EQUAL(entries->get(0)->getID(), 1u);
+    BOOST_CHECK_EQUAL(entries->get(0)->num(), 1u);
+    BOOST_CHECK_EQUAL(entries->get(0)->dirty(), false);
+}
+
+BOOST_AUTO_TEST_CASE(binaryCommitResult)
+{
+    mockChannel->binary = true;
+    mockChannel->binaryCommitResult = true;
+    std::vector<dev::storage::TableData::Ptr> datas;
+    for (auto const& name : {"t_test", "t_other"})
+    {
+        auto tableData = std::make_shared<dev::storage::TableData>();
+        tableData->info->name = name;
+        tableData->info->key = "Name";
+        tableData->info->fields.push_back("id");
+        tableData->newEntries = getEntries();
+        datas.push_back(tableData);
+    }
+    // the count is decoded from the binary response
+    BOOST_CHECK_EQUAL(sqlStorage->commit(1, datas), 2u);
+    BOOST_CHECK_EQUAL(mockChannel->committed.size(), 2u);
+
+    bytes frame;
+    AMDBCodec::encodeCommitResult(0, 1024, frame);
+    BOOST_CHECK(AMDBCodec::isBinaryFrame(ref(frame)));
+    BOOST_CHECK_EQUAL(AMDBCodec::decodeCode(ref(frame)), 0);
+    BOOST_CHECK_EQUAL(AMDBCodec::decodeCommitResult(ref(frame)), 1024);
+    frame.resize(frame.size() - 1);
+    BOOST_CHECK_THROW(AMDBCodec::decodeCommitResult(ref(frame)), StorageException);
+}
+
+BOOST_AUTO_TEST_CASE(binarySelectFields)
+{
+    auto tableInfo = std::make_shared<TableInfo>();
+    tableInfo->name = "t_test";
+    auto jsonEntries = sqlStorage->select(1, tableInfo, "LiSi", std::make_shared<Condition>());
+
+    // a new storage negotiates the binary framing with the proxy
+    mockChannel->binary = true;
+    auto binaryStorage = std::make_shared<dev::storage::SQLStorage>();
+    binaryStorage->setChannelRPCServer(mockChannel);
+    binaryStorage->setMaxRetry(20);
+    auto binaryEntries =
+        binaryStorage->select(1, tableInfo, "LiSi", std::make_shared<Condition>());
+
+    // the system fields are kept as fields by both framings, BlockChainImp reads the number of
+    // the block by getField(NUM_FIELD)
+    BOOST_CHECK_EQUAL(jsonEntries->size(), 1u);
+    BOOST_CHECK_EQUAL(binaryEntries->size(), 1u);
+    for (auto const& field : {std::string("Name"), std::string("id"), ID_FIELD, NUM_FIELD, STATUS})
+    {
+        BOOST_CHECK_EQUAL(
+            binaryEntries->get(0)->getField(field), jsonEntries->get(0)->getField(field));
+    }
+    BOOST_CHECK_EQUAL(binaryEntries->get(0)->getField(NUM_FIELD), "1");
+    BOOST_CHECK_EQUAL(binaryEntries->get(0)->num(), jsonEntries->get(0)->num());
+    BOOST_CHECK_EQUAL(binaryEntries->get(0)->getID(), jsonEntries->get(0)->getID());
+}
+
+BOOST_AUTO_TEST_CASE(binaryFrame)
+{
+    Entries entries;
+    auto entry = std::make_shared<Entry>();
+    std::string value("\0\1binary", 8);
+    entry->setField("value", value);
+    entry->setID(3);
+    entry->setNum(5);
+    entry->setStatus(1);
+    entries.addEntry(entry);
+    entry = std::make_shared<Entry>();
+    entry->setField("key", "k");
+    entries.addEntry(entry);
+
+    bytes frame;
+    AMDBCodec::encodeRows(0, entries, frame);
+    BOOST_CHECK(AMDBCodec::isBinaryFrame(ref(frame)));
+    BOOST_CHECK_EQUAL(AMDBCodec::decodeCode(ref(frame)), 0);
+    auto decoded = std::make_shared<Entries>();
+    BOOST_CHECK_EQUAL(AMDBCodec::decodeRows(ref(frame), decoded), 0);
+    BOOST_CHECK_EQUAL(decoded->size(), 2u);
+    BOOST_CHECK_EQUAL(decoded->get(0)->getField("value"), value);
+    BOOST_CHECK_EQUAL(decoded->get(0)->getID(), 3u);
+    BOOST_CHECK_EQUAL(decoded->get(0)->num(), 5u);
+    BOOST_CHECK_EQUAL(decoded->get(0)->getStatus(), 1);
+    BOOST_CHECK_EQUAL(decoded->get(0)->getField(ID_FIELD), "3");
+    BOOST_CHECK_EQUAL(decoded->get(0)->getField(NUM_FIELD), "5");
+    BOOST_CHECK_EQUAL(decoded->get(0)->getField(STATUS), "1");
+    BOOST_CHECK_EQUAL(decoded->get(1)->getField("key"), "k");
+    BOOST_CHECK_EQUAL(decoded->get(1)->getField("value"), "");
+
+    frame.clear();
+    AMDBCodec::encodeRows(-1, Entries(), frame);
+    BOOST_CHECK_EQUAL(AMDBCodec::decodeCode(ref(frame)), -1);
+
+    // a truncated frame
+    frame.resize(frame.size() - 1);
+    BOOST_CHECK_THROW(AMDBCodec::decodeRows(ref(frame), decoded), StorageException);
+    std::string json("{\"code\":0}");
+    BOOST_CHECK(!AMDBCodec::isBinaryFrame(bytesConstRef((const byte*)json.data(), json.size())));
 }
 
 BOOST_AUTO_TEST_CASE(exception)
@@ -155,6 +155,47 @@ BOOST_AUTO_TEST_CASE(commit)
 }
 
 BOOST_AUTO_TEST_CASE(exception) {}
+
+BOOST_AUTO_TEST_CASE(batchRows)
+{
+    BOOST_CHECK(SQLBasicAccess::BatchRows(0, 5).empty());
+    auto batchRows = SQLBasicAccess::BatchRows(37, 5);
+    BOOST_CHECK(batchRows == std::vector<size_t>({32, 4, 1}));
+
+    // the placeholders of a statement are limited
+    size_t maxRows = maxPlaceHolderCnt / 6;
+    batchRows = SQLBasicAccess::BatchRows(maxRows * 2 + 3, 6);
+    BOOST_CHECK(batchRows == std::vector<size_t>({maxRows, maxRows, 2, 1}));
+}
+
+BOOST_AUTO_TEST_CASE(splitCommitTables)
+{
+    std::vector<dev::storage::TableData::Ptr> datas;
+    std::vector<size_t> rows = {1, 10, 1, 6, 4};
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+        auto tableData = std::make_shared<dev::storage::TableData>();
+        tableData->info->name = "t_test" + std::to_string(i);
+        for (size_t j = 0; j < rows[i]; ++j)
+        {
+            tableData->newEntries->addEntry(std::make_shared<Entry>());
+        }
+        datas.push_back(tableData);
+    }
+    datas[2]->info->name = SYS_CURRENT_STATE;
+
+    auto branches = SQLBasicAccess::SplitCommitTables(datas, 1);
+    BOOST_CHECK(branches == std::vector<std::vector<size_t>>({{0, 1, 2, 3, 4}}));
+
+    // the current state is in the first branch, and the larger tables are split
+    branches = SQLBasicAccess::SplitCommitTables(datas, 3);
+    BOOST_CHECK(branches == std::vector<std::vector<size_t>>({{0, 2, 4}, {1}, {3}}));
+
+    // no more branches than the tables
+    branches = SQLBasicAccess::SplitCommitTables(datas, 8);
+    BOOST_CHECK_EQUAL(branches.size(), 5u);
+    BOOST_CHECK(branches[0] == std::vector<size_t>({2}));
+}
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace test_zdbStorage
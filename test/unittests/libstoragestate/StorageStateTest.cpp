@@ -23,6 +23,7 @@
 
 #include "libstoragestate/StorageState.h"
 #include "../libstorage/MemoryStorage.h"
+#include "libconfig/GlobalConfigure.h"
 #include "libdevcrypto/CryptoInterface.h"
 #include "libstorage/MemoryTableFactory2.h"
 #include <boost/test/unit_test.hpp>
@@ -105,6 +106,27 @@ BOOST_AUTO_TEST_CASE(Storage)
     m_state.clearStorage(addr1);
 }
 
+BOOST_AUTO_TEST_CASE(TypedStorage)
+{
+    auto version = g_BCOSConfig.version();
+    auto supportedVersion = g_BCOSConfig.supportedVersion();
+    g_BCOSConfig.setSupportedVersion("2.7.0", V2_7_0);
+
+    Address addr1(0x100001);
+    m_state.addBalance(addr1, u256(10));
+    BOOST_TEST(m_state.storage(addr1, u256(123)) == u256());
+    m_state.setStorage(addr1, u256(123), u256(456));
+    BOOST_TEST(m_state.storage(addr1, u256(123)) == u256(456));
+    u256 maxValue = ~u256(0);
+    m_state.setStorage(addr1, maxValue, maxValue);
+    BOOST_TEST(m_state.storage(addr1, maxValue) == maxValue);
+    m_state.setStorage(addr1, u256(123), u256(0));
+    BOOST_TEST(m_state.storage(addr1, u256(123)) == u256(0));
+    BOOST_TEST(m_state.storage(addr1, maxValue) == maxValue);
+
+    g_BCOSConfig.setSupportedVersion(supportedVersion, version);
+}
+
 BOOST_AUTO_TEST_CASE(Code)
 {
     Address addr1(0x100001);
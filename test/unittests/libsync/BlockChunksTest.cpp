@@ -0,0 +1,154 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : unit test of reassembling the streamed blocks
+ * @file: BlockChunksTest.cpp
+ */
+#include <libdevcore/RLP.h>
+#include <libsync/BlockChunks.h>
+#include <test/tools/libutils/TestOutputHelper.h>
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace dev;
+using namespace dev::eth;
+using namespace dev::sync;
+
+namespace dev
+{
+namespace test
+{
+namespace
+{
+// a block with a legal header and _payloadSize bytes of transactions
+bytes fakeBlockRLP(int64_t _number, size_t _payloadSize)
+{
+    BlockHeader header;
+    header.setNumber(_number);
+    bytes headerRLP;
+    header.encode(headerRLP);
+    RLPStream block;
+    block.appendList(3);
+    block.appendRaw(headerRLP);
+    block.append(bytes(_payloadSize, 0x5a));
+    block.append(h256(_number));
+    bytes blockRLP;
+    block.swapOut(blockRLP);
+    return blockRLP;
+}
+
+BlockChunksAssembler::Result pushChunks(BlockChunksAssembler& _assembler, NodeID const& _peer,
+    int64_t _number, bytes const& _blockRLP, size_t _chunkSize, bytes& _blocks,
+    size_t& _pushedSize)
+{
+    auto result = BlockChunksAssembler::Result::Pending;
+    for (_pushedSize = 0; _pushedSize < _blockRLP.size();)
+    {
+        auto size = std::min(_chunkSize, _blockRLP.size() - _pushedSize);
+        result = _assembler.push(_peer, _number, _blockRLP.size(), _pushedSize,
+            bytesConstRef(_blockRLP.data() + _pushedSize, size), _blocks);
+        _pushedSize += size;
+        if (result != BlockChunksAssembler::Result::Pending)
+        {
+            break;
+        }
+    }
+    return result;
+}
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(BlockChunksTest, TestOutputHelperFixture)
+
+BOOST_AUTO_TEST_CASE(reassemble)
+{
+    BlockChunksAssembler assembler([](BlockHeader const& _header) { return _header.number() > 5; });
+    NodeID peer = NodeID::random();
+    for (auto payloadSize : {10, 100000})
+    {
+        auto blockRLP = fakeBlockRLP(10, payloadSize);
+        bytes blocks;
+        size_t pushedSize = 0;
+        auto result = pushChunks(assembler, peer, 10, blockRLP, 1024, blocks, pushedSize);
+        BOOST_CHECK(result == BlockChunksAssembler::Result::Completed);
+        // the reassembled block is laid out as a BlocksPacket
+        RLP rlps(blocks);
+        BOOST_CHECK_EQUAL(rlps.itemCount(), 1);
+        BOOST_CHECK(rlps[0].toBytes() == blockRLP);
+        BOOST_CHECK_EQUAL(assembler.size(), 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(dropByHeader)
+{
+    BlockChunksAssembler assembler([](BlockHeader const& _header) { return _header.number() > 5; });
+    NodeID peer = NodeID::random();
+    auto blockRLP = fakeBlockRLP(3, 100000);
+    bytes blocks;
+    size_t pushedSize = 0;
+    // the committed block is dropped once its header arrives
+    auto result = pushChunks(assembler, peer, 3, blockRLP, 1024, blocks, pushedSize);
+    BOOST_CHECK(result == BlockChunksAssembler::Result::Dropped);
+    BOOST_CHECK(pushedSize < blockRLP.size());
+    BOOST_CHECK_EQUAL(assembler.size(), 0);
+
+    // the number of the header mismatches the stream
+    blockRLP = fakeBlockRLP(10, 100000);
+    result = pushChunks(assembler, peer, 11, blockRLP, 1024, blocks, pushedSize);
+    BOOST_CHECK(result == BlockChunksAssembler::Result::Dropped);
+    BOOST_CHECK(pushedSize < blockRLP.size());
+}
+
+BOOST_AUTO_TEST_CASE(dropBrokenStream)
+{
+    BlockChunksAssembler assembler(nullptr);
+    NodeID peer = NodeID::random();
+    auto blockRLP = fakeBlockRLP(10, 10000);
+    bytes blocks;
+    auto chunk = [&](size_t _offset, size_t _size) {
+        return bytesConstRef(blockRLP.data() + _offset, _size);
+    };
+    BOOST_CHECK(assembler.push(peer, 10, blockRLP.size(), 0, chunk(0, 1000), blocks) ==
+                BlockChunksAssembler::Result::Pending);
+    // a chunk is lost
+    BOOST_CHECK(assembler.push(peer, 10, blockRLP.size(), 2000, chunk(2000, 1000), blocks) ==
+                BlockChunksAssembler::Result::Dropped);
+    // the rest of the dropped stream is ignored
+    BOOST_CHECK(assembler.push(peer, 10, blockRLP.size(), 3000, chunk(3000, 1000), blocks) ==
+                BlockChunksAssembler::Result::Dropped);
+
+    // the chunk exceeds the size of the block
+    BOOST_CHECK(assembler.push(peer, 10, 500, 0, chunk(0, 1000), blocks) ==
+                BlockChunksAssembler::Result::Dropped);
+
+    // the block is larger than the limit
+    assembler.setMaxBlockSize(1000);
+    BOOST_CHECK(assembler.push(peer, 10, blockRLP.size(), 0, chunk(0, 1000), blocks) ==
+                BlockChunksAssembler::Result::Dropped);
+    BOOST_CHECK_EQUAL(assembler.size(), 0);
+
+    // a new stream from the same peer replaces the unfinished one
+    assembler.setMaxBlockSize(blockRLP.size());
+    BOOST_CHECK(assembler.push(peer, 9, blockRLP.size(), 0, chunk(0, 10), blocks) ==
+                BlockChunksAssembler::Result::Pending);
+    size_t pushedSize = 0;
+    BOOST_CHECK(pushChunks(assembler, peer, 10, blockRLP, 4096, blocks, pushedSize) ==
+                BlockChunksAssembler::Result::Completed);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace dev
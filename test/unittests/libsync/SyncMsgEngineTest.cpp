@@ -240,6 +240,33 @@ BOOST_AUTO_TEST_CASE(SyncTransactionPacketTest)
     // TODO: this unit test may cause fatal error randomly
 }
 
+BOOST_AUTO_TEST_CASE(TxsStatusReconcileTest)
+{
+    auto statistics = fakeMsgEngine.relayStatistics();
+    auto fakeSessionPtr = fakeSyncToolsSet.createSession();
+    auto sendTxsStatus = [&](TxsStatusReason _reason) {
+        SyncTxsStatusPacket txsStatusPacket;
+        txsStatusPacket.encode(0, make_shared<set<h256>>(), _reason);
+        auto msgPtr = txsStatusPacket.toMessage(0x01);
+        fakeMsgEngine.messageHandler(fakeException, fakeSessionPtr, msgPtr);
+    };
+
+    // the gossiped status crossing the sketch doesn't finish the round
+    fakeMsgEngine.sendTxsSketch(NodeID());
+    sendTxsStatus(TxsStatusReason::Gossip);
+    // the fallback of the large txpool finishes the round without a failure
+    sendTxsStatus(TxsStatusReason::TooManyTxs);
+    BOOST_CHECK_EQUAL(statistics->reconcileFailures.load(), 0u);
+
+    fakeMsgEngine.sendTxsSketch(NodeID());
+    BOOST_CHECK_EQUAL(statistics->reconcileRounds.load(), 2u);
+    sendTxsStatus(TxsStatusReason::SketchDecodeFailed);
+    BOOST_CHECK_EQUAL(statistics->reconcileFailures.load(), 1u);
+    // no round is pending any more
+    sendTxsStatus(TxsStatusReason::SketchDecodeFailed);
+    BOOST_CHECK_EQUAL(statistics->reconcileFailures.load(), 1u);
+}
+
 BOOST_AUTO_TEST_CASE(SyncBlocksPacketTest)
 {
     SyncBlocksPacket blocksPacket;
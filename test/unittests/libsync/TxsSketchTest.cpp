@@ -0,0 +1,138 @@
+/*
+ * @CopyRight:
+ * FISCO-BCOS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FISCO-BCOS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FISCO-BCOS.  If not, see <http://www.gnu.org/licenses/>
+ * (c) 2016-2020 fisco-dev contributors.
+ */
+/**
+ * @brief : unit test of the sketch used by transaction reconciliation
+ * @file: TxsSketchTest.cpp
+ */
+#include <libsync/Common.h>
+#include <libsync/TxsSketch.h>
+#include <test/tools/libutils/TestOutputHelper.h>
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace dev;
+using namespace dev::sync;
+
+namespace dev
+{
+namespace test
+{
+BOOST_FIXTURE_TEST_SUITE(TxsSketchTest, TestOutputHelperFixture)
+
+BOOST_AUTO_TEST_CASE(reconcile)
+{
+    // large enough to decode the difference of 8 ids with overwhelming probability
+    TxsSketch local(4 * c_minSketchCells);
+    TxsSketch remote(4 * c_minSketchCells);
+    std::set<uint64_t> localIds;
+    std::set<uint64_t> remoteIds;
+    // 1000 shared txs
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        auto id = txShortId(h256::random());
+        local.insert(id);
+        remote.insert(id);
+    }
+    for (size_t i = 0; i < 5; ++i)
+    {
+        auto id = txShortId(h256::random());
+        local.insert(id);
+        localIds.insert(id);
+    }
+    for (size_t i = 0; i < 3; ++i)
+    {
+        auto id = txShortId(h256::random());
+        remote.insert(id);
+        remoteIds.insert(id);
+    }
+
+    // encode and decode the remote sketch
+    RLPStream s;
+    remote.encode(s);
+    auto data = s.out();
+    auto decoded = TxsSketch::decodeFrom(RLP(ref(data)));
+    BOOST_CHECK_EQUAL(decoded->cellCount(), remote.cellCount());
+
+    local.subtract(*decoded);
+    std::set<uint64_t> onlyLocal;
+    std::set<uint64_t> onlyRemote;
+    BOOST_CHECK(local.decode(onlyLocal, onlyRemote));
+    BOOST_CHECK(onlyLocal == localIds);
+    BOOST_CHECK(onlyRemote == remoteIds);
+}
+
+BOOST_AUTO_TEST_CASE(differenceTooLarge)
+{
+    TxsSketch local(c_minSketchCells);
+    TxsSketch remote(c_minSketchCells);
+    for (size_t i = 0; i < 10 * c_minSketchCells; ++i)
+    {
+        local.insert(txShortId(h256::random()));
+    }
+    local.subtract(remote);
+    std::set<uint64_t> onlyLocal;
+    std::set<uint64_t> onlyRemote;
+    BOOST_CHECK(!local.decode(onlyLocal, onlyRemote));
+
+    // the sketches of different sizes can't be subtracted
+    TxsSketch larger(2 * c_minSketchCells);
+    BOOST_CHECK_THROW(local.subtract(larger), InValidSyncPacket);
+}
+
+BOOST_AUTO_TEST_CASE(peelingBounded)
+{
+    // keep only the first of the cells of an id, peeling the id makes its other cells pure, and
+    // peeling them makes the first cell pure again
+    TxsSketch sketch(c_minSketchCells);
+    sketch.insert(txShortId(h256::random()));
+    RLPStream s;
+    sketch.encode(s);
+    auto data = s.out();
+    auto cells = RLP(ref(data)).toBytes();
+    bool kept = false;
+    for (size_t i = 0; i < cells.size(); i += 24)
+    {
+        if (cells[i + 7] == 0)
+        {
+            continue;
+        }
+        if (kept)
+        {
+            std::fill(cells.begin() + i, cells.begin() + i + 24, 0);
+        }
+        kept = true;
+    }
+    RLPStream crafted;
+    crafted.append(cells);
+    data = crafted.out();
+    auto decoded = TxsSketch::decodeFrom(RLP(ref(data)));
+    std::set<uint64_t> onlyLocal;
+    std::set<uint64_t> onlyRemote;
+    BOOST_CHECK(!decoded->decode(onlyLocal, onlyRemote));
+}
+
+BOOST_AUTO_TEST_CASE(invalidSketch)
+{
+    RLPStream s;
+    s.append(bytes(25, 1));
+    auto data = s.out();
+    BOOST_CHECK_THROW(TxsSketch::decodeFrom(RLP(ref(data))), InValidSyncPacket);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace dev
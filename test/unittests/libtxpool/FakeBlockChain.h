@@ -120,6 +120,11 @@ public:
     {
         return TxPool::import(_tx, _ik);
     }
+
+    std::vector<ImportResult> batchImport(dev::eth::Transactions const& _txs) override
+    {
+        return TxPool::batchImport(_txs);
+    }
 };
 
 class FakeBlockChain : public BlockChainInterface
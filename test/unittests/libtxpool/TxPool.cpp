@@ -132,6 +132,91 @@ BOOST_AUTO_TEST_CASE(testImportAndSubmit)
     BOOST_CHECK(pool_test.m_txPool->maxBlockLimit() == 100);
 }
 
+BOOST_AUTO_TEST_CASE(testBatchImport)
+{
+    TxPoolFixture pool_test(5, 5);
+    Transactions transaction_vec =
+        *(pool_test.m_blockChain->getBlockByHash(pool_test.m_blockChain->numberHash(0))
+                ->transactions());
+    size_t i = 0;
+    for (auto tx : transaction_vec)
+    {
+        tx->setNonce(tx->nonce() + u256(i) + u256(100));
+        tx->setBlockLimit(pool_test.m_blockChain->number() + u256(100));
+        auto sig = crypto::Sign(pool_test.m_blockChain->m_keyPair, tx->sha3(WithoutSignature));
+        tx->updateSignature(sig);
+        i++;
+    }
+    // the duplicated tx in the same batch is refused
+    transaction_vec.push_back(transaction_vec[0]);
+    auto results = pool_test.m_txPool->batchImport(transaction_vec);
+    BOOST_CHECK(results.size() == 6);
+    for (size_t i = 0; i < 5; i++)
+    {
+        BOOST_CHECK(results[i] == ImportResult::Success);
+    }
+    BOOST_CHECK(results[5] == ImportResult::AlreadyKnown);
+    BOOST_CHECK(pool_test.m_txPool->pendingSize() == 5);
+
+    // the imported txs are refused
+    results = pool_test.m_txPool->batchImport(transaction_vec);
+    for (auto const& result : results)
+    {
+        BOOST_CHECK(result == ImportResult::AlreadyKnown);
+    }
+    BOOST_CHECK(pool_test.m_txPool->pendingSize() == 5);
+}
+
+BOOST_AUTO_TEST_CASE(testTopTransactionsCursor)
+{
+    TxPoolFixture pool_test(5, 5);
+    Transactions transaction_vec =
+        *(pool_test.m_blockChain->getBlockByHash(pool_test.m_blockChain->numberHash(0))
+                ->transactions());
+    size_t i = 0;
+    for (auto tx : transaction_vec)
+    {
+        tx->setNonce(tx->nonce() + u256(i) + u256(100));
+        tx->setBlockLimit(pool_test.m_blockChain->number() + u256(100));
+        auto sig = crypto::Sign(pool_test.m_blockChain->m_keyPair, tx->sha3(WithoutSignature));
+        tx->updateSignature(sig);
+        i++;
+    }
+    pool_test.m_txPool->batchImport(transaction_vec);
+    Transactions pending_list = *(pool_test.m_txPool->pendingList());
+    BOOST_CHECK(pending_list.size() == 5);
+
+    // fetch the transactions from where the last fetch stopped
+    h256Hash avoid;
+    Transactions fetched;
+    for (size_t round = 0; round < 3; round++)
+    {
+        auto txs = pool_test.m_txPool->topTransactions(2, avoid, true);
+        fetched.insert(fetched.end(), txs->begin(), txs->end());
+    }
+    BOOST_CHECK(fetched.size() == 5);
+    for (i = 0; i < fetched.size(); i++)
+    {
+        BOOST_CHECK(fetched[i]->sha3() == pending_list[i]->sha3());
+    }
+    BOOST_CHECK(pool_test.m_txPool->topTransactions(2, avoid, true)->size() == 0);
+
+    // the avoid set has been reset, fetch from the beginning
+    avoid.clear();
+    avoid.insert(pending_list[0]->sha3());
+    auto txs = pool_test.m_txPool->topTransactions(5, avoid, true);
+    BOOST_CHECK(txs->size() == 4);
+    BOOST_CHECK((*txs)[0]->sha3() == pending_list[1]->sha3());
+
+    // the transaction at the cursor has been dropped
+    avoid.clear();
+    txs = pool_test.m_txPool->topTransactions(2, avoid, true);
+    BOOST_CHECK(pool_test.m_txPool->drop(pending_list[1]->sha3()));
+    txs = pool_test.m_txPool->topTransactions(5, avoid, true);
+    BOOST_CHECK(txs->size() == 3);
+    BOOST_CHECK((*txs)[0]->sha3() == pending_list[2]->sha3());
+}
+
 BOOST_AUTO_TEST_CASE(BlockLimitCheck)
 {
     TxPoolFixture pool_test(5, 5);
@@ -538,6 +538,9 @@ generate_config_ini()
     channel_listen_port=$(( offset + port_array[1] ))
     jsonrpc_listen_ip=${listen_ip}
     jsonrpc_listen_port=$(( offset + port_array[2] ))
+    ; serve the metrics in the Prometheus text format at http://metrics_listen_ip:metrics_listen_port/metrics
+    ;metrics_listen_ip=127.0.0.1
+    ;metrics_listen_port=8914
 [p2p]
     listen_ip=${default_listen_ip}
     listen_port=$(( offset + port_array[0] ))
@@ -555,6 +558,10 @@ generate_config_ini()
 [group]
     group_data_path=data/
     group_config_path=${conf_path}/
+    ; the number of the groups initialized concurrently at startup
+    ;init_parallelism=4
+    ; the groups initialized on the first access by RPC or P2P, e.g. 3,5,7
+    ;cold_groups=
 
 [network_security]
     ; directory the certificates located in
@@ -594,6 +601,10 @@ generate_config_ini()
     ; MB
     max_log_file_size=200
     flush=${auto_flush}
+    ; format the logs on the callers and write them on a background thread
+    ;enable_async_log=false
+    ; the logs buffered by every thread, the logs are dropped if the buffer is full
+    ;async_ring_size=1024
 
 [flow_control]
     ; restrict QPS of the node
@@ -602,6 +613,14 @@ generate_config_ini()
     ; Mb, can be a decimal
     ; when the outgoing bandwidth exceeds the limit, the block synchronization operation will not proceed
     ;outgoing_bandwidth_limit=2
+
+[executor]
+    ; run the serial workers of all the groups on one shared thread pool
+    ;enable=true
+    ; default is the number of the cpus
+    ;thread_num=8
+    ; bind the threads to the cpus, e.g. the cpus of one NUMA node
+    ;cpu_affinity=0-7
 EOF
     printf "  [%d] p2p:%-5d  channel:%-5d  jsonrpc:%-5d\n" "${node_index}" $(( offset + port_array[0] )) $(( offset + port_array[1] )) $(( offset + port_array[2] )) >>"${logfile}"
 }
@@ -674,7 +693,13 @@ function generate_group_ini()
     cached_storage=true
     ; max cache memeory, MB
     max_capacity=32
+    ; max memory of the compressed cache for the evicted entries, MB, 0 means disabled
+    max_compressed_capacity=0
     max_forward_block=10
+    ; max blocks merged into one commit of mysql, only for mysql
+    max_batch_block=10
+    ; max connections committing the tables of a block in parallel, only for mysql
+    commit_connections=4
     ; only for external, deprecated in v2.3.0
     max_retry=60
     topic=DB
@@ -691,6 +716,13 @@ function generate_group_ini()
     ; number of threads responsible for transaction notification,
     ; default is 2, not recommended for more than 8
     notify_worker_num=2
+[tx_execute]
+    ; pack the transactions to shorten the dependency chains of parallel execution
+    conflict_aware_packing=false
+    ; ms, the transactions waited longer are packed regardless of the conflicts
+    max_packing_delay=1000
+    ; allocate the short-lived objects of the executed block in a per-block arena
+    enable_block_arena=true
 [sync]
     ; max memory size used for block sync, must >= 32MB
     max_block_sync_memory_size=512
@@ -706,6 +738,15 @@ function generate_group_ini()
     gossip_peers_number=3
     ; max number of nodes that broadcast txs status to, recommended less than 5
     txs_max_gossip_peers_num=5
+    ; reconcile the pending txs with one consensus node every interval instead of
+    ; gossiping the txs status, 0 means disabled, must between 100 to 60000 if enabled
+    ;txs_reconcile_interval_ms=500
+    ; request the blocks streamed in chunks of the size, 0 means disabled, must between
+    ; 16 to 512 if enabled, all the nodes of the group must support it
+    ;block_chunk_size_kb=256
+    ; the upload bandwidth limit(Mbit/s) of responding blocks to every peer, 0 means
+    ; unlimited
+    ;peer_upload_bandwidth_limit=10
 [flow_control]
     ; restrict QPS of the group
     ;limit_req=1000